@@ -0,0 +1,588 @@
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "closure.h"
+#include "bytecode_file.h"
+
+#include "aot.h"
+
+
+
+static struct aot_module *AOT_MODULES = NULL;
+
+
+void aot_register(struct aot_module *module)
+{
+    module->next = AOT_MODULES;
+    AOT_MODULES = module;
+}
+
+
+/*
+ * Loads the linked in module of the given name and returns its
+ * thunk's prototype with one reference held for the caller, or
+ * EMPTY_LIST if there is no such module.
+ */
+objptr_t aot_load(const char *name)
+{
+    struct aot_module *module;
+
+    for (module = AOT_MODULES; module != NULL; module = module->next) {
+        if (strcmp(module->name, name) == 0) {
+            return read_bytecode_memory(module->data, module->size,
+                                        module->natives, module->native_count);
+        }
+    }
+
+    return EMPTY_LIST;
+}
+
+
+
+/*
+ * Generator
+ *
+ * Every prototype becomes a C function. Within straight-line code
+ * the operand stack is kept in temporaries t0, t1, ... (t0 at the
+ * bottom), which own a reference each. PUSH_CONST, LOOKUP_CONST and
+ * POP only move temporaries, the inlined builtins have fast paths on
+ * them: fixnum arithmetic and comparisons, car and cdr of pairs, and
+ * a comparison followed by JMP_IF_NOT branches directly. A fast
+ * path is only taken while the builtin's name is bound to it, see
+ * PRIMITIVE_INLINE_GUARDS.
+ *
+ * Everything else calls the interpreter's handler: the temporaries
+ * are pushed onto the fiber's stack first, and the handler's result
+ * is popped into one afterwards. Jump targets start with an empty
+ * set of temporaries. The function may be entered at every offset,
+ * so each one has an entry which pops the temporaries live there.
+ */
+
+
+struct generator {
+    FILE *out;
+    struct code *code;
+    bool *targets;         // Offsets which are jump targets
+    unsigned int *depths;  // Temporaries live at each offset
+    unsigned int depth;    // Temporaries live now
+    unsigned int max_depth;
+    bool dispatches;       // A handler may jump
+    bool loops;            // There are backward jumps
+    bool fixnums;          // Fixnum fast paths are used
+    bool arithmetic;       // ... and ones with a fixnum result
+};
+
+
+static void write_data(FILE *out, const char *name,
+                       const unsigned char *data, size_t size)
+{
+    size_t i;
+
+    fprintf(out, "static const unsigned char aot_%s_data[] = {", name);
+    for (i = 0; i < size; i++) {
+        fprintf(out, i % 12 == 0 ? "\n    0x%02x," : " 0x%02x,", data[i]);
+    }
+    fprintf(out, "\n};\n\n\n");
+}
+
+
+static void use_temporaries(struct generator *g, unsigned int count)
+{
+    if (count > g->max_depth) g->max_depth = count;
+}
+
+
+// Pushes all but the top KEEP temporaries onto the fiber's stack
+static void spill(struct generator *g, unsigned int keep)
+{
+    unsigned int i, count;
+
+    count = g->depth - keep;
+    if (count == 0) return;
+
+    for (i = 0; i < count; i++) {
+        fprintf(g->out, "    aot_push(fib, t%u);\n", i);
+    }
+    for (i = 0; i < keep; i++) {
+        fprintf(g->out, "    t%u = t%u;\n", i, i + count);
+    }
+    g->depth = keep;
+}
+
+
+// Makes sure the top COUNT values are in temporaries
+static void load(struct generator *g, unsigned int count)
+{
+    unsigned int missing, i;
+
+    if (g->depth >= count) return;
+
+    missing = count - g->depth;
+    for (i = g->depth; i > 0; i--) {
+        fprintf(g->out, "    t%u = t%u;\n", i - 1 + missing, i - 1);
+    }
+    for (i = missing; i > 0; i--) {
+        fprintf(g->out, "    t%u = fiber_pop(fib);\n", i - 1);
+    }
+    g->depth = count;
+    use_temporaries(g, count);
+}
+
+
+static void write_jump(struct generator *g, const char *indent,
+                       unsigned int from, unsigned int target)
+{
+    if (target > g->code->code_size) {
+        fprintf(g->out, "%sfib->instr_pointer.offset = %u;\n", indent, target);
+        fprintf(g->out, "%sreturn;\n", indent);
+        return;
+    }
+    if (target <= from) {
+        // Only backward jumps can loop
+        fprintf(g->out, "%sif (--budget == 0) {\n", indent);
+        fprintf(g->out, "%s    fib->instr_pointer.offset = %u;\n", indent, target);
+        fprintf(g->out, "%s    return;\n", indent);
+        fprintf(g->out, "%s}\n", indent);
+        g->loops = true;
+    }
+    fprintf(g->out, "%sgoto i%u;\n", indent, target);
+}
+
+
+/*
+ * Calls the handler with the temporaries on the fiber's stack, and
+ * leaves when it left the procedure or jumped
+ */
+static void write_handler(struct generator *g, const char *indent,
+                          unsigned int opcode, unsigned int argument,
+                          unsigned int next)
+{
+    fprintf(g->out, "%sfib->instr_pointer.offset = %u;\n", indent, next);
+    if (FIBER_OP_NAMES[opcode] != NULL) {
+        fprintf(g->out, "%sfiber_op_%s(fib, %u);\n", indent, FIBER_OP_NAMES[opcode], argument);
+    }
+
+    if (opcode == INSTR_HALT) {
+        fprintf(g->out, "%sreturn;\n", indent);
+    } else if (!jit_is_straight_instruction(opcode)) {
+        fprintf(g->out, "%sif (fib->instr_pointer.code != code) return;\n", indent);
+        fprintf(g->out, "%sif (fib->instr_pointer.offset != %u) goto jumped;\n", indent, next);
+        g->dispatches = true;
+    }
+}
+
+
+// The slow path of an inlined builtin with COUNT operands in temporaries
+static void write_slow_path(struct generator *g, unsigned int opcode,
+                            unsigned int argument, unsigned int next,
+                            unsigned int count)
+{
+    unsigned int i;
+
+    fprintf(g->out, "    } else {\n");
+    for (i = 0; i < count; i++) {
+        fprintf(g->out, "        aot_push(fib, t%u);\n", i);
+    }
+    write_handler(g, "        ", opcode, argument, next);
+    fprintf(g->out, "        t0 = fiber_pop(fib);\n");
+    fprintf(g->out, "    }\n");
+}
+
+
+static bool is_fixnum_instruction(unsigned int opcode)
+{
+    return opcode == INSTR_ADD || opcode == INSTR_SUB
+        || opcode == INSTR_LT || opcode == INSTR_NUM_EQ;
+}
+
+
+/*
+ * Fixnum arithmetic and comparisons. A comparison followed by
+ * JMP_IF_NOT at BRANCH (0 if there is none) jumps directly.
+ */
+static void write_fixnum_instruction(struct generator *g, unsigned int opcode,
+                                     unsigned int argument, unsigned int offset,
+                                     unsigned int branch)
+{
+    const char *name;
+    unsigned int target;
+
+    name = FIBER_OP_NAMES[opcode];
+    load(g, 2);
+    spill(g, 2);
+    g->fixnums = true;
+
+    fprintf(g->out, "    if (PRIMITIVE_INLINE_GUARDS[INSTR_%s] && aot_fixnum(t0, &a) && aot_fixnum(t1, &b)", name);
+    if (opcode == INSTR_ADD) {
+        fprintf(g->out, "\n        && !__builtin_add_overflow(a, b, &r)");
+    } else if (opcode == INSTR_SUB) {
+        fprintf(g->out, "\n        && !__builtin_sub_overflow(a, b, &r)");
+    }
+    if (opcode == INSTR_ADD || opcode == INSTR_SUB) g->arithmetic = true;
+    fprintf(g->out, ") {\n");
+    fprintf(g->out, "        decrease_refcount(t0);\n");
+    fprintf(g->out, "        decrease_refcount(t1);\n");
+
+    if (branch != 0) {
+        target = ARGUMENT_PART(g->code->codes[branch]);
+        fprintf(g->out, "        if (%s) goto i%u;\n",
+                (opcode == INSTR_LT) ? "a < b" : "a == b", branch + 1);
+        write_jump(g, "        ", branch, target);
+    } else if (opcode == INSTR_ADD || opcode == INSTR_SUB) {
+        fprintf(g->out, "        t0 = make_integer(r);\n");
+        fprintf(g->out, "        increase_refcount(t0);\n");
+    } else {
+        fprintf(g->out, "        t0 = (%s) ? NIL_TRUE : NIL_FALSE;\n",
+                (opcode == INSTR_LT) ? "a < b" : "a == b");
+        fprintf(g->out, "        increase_refcount(t0);\n");
+    }
+
+    write_slow_path(g, opcode, argument, offset + 1, 2);
+    g->depth = 1;
+}
+
+
+static void write_instruction(struct generator *g, unsigned int opcode,
+                              unsigned int argument, unsigned int offset,
+                              unsigned int next)
+{
+    unsigned int i;
+
+    switch (opcode) {
+    case INSTR_PUSH_CONST:
+        fprintf(g->out, "    t%u = code_pointer_get_constant(&(fib->instr_pointer), %u);\n",
+                g->depth, argument);
+        fprintf(g->out, "    increase_refcount(t%u);\n", g->depth);
+        use_temporaries(g, ++(g->depth));
+        return;
+
+    case INSTR_LOOKUP_CONST:
+        fprintf(g->out, "    t%u = environment_get_binding(fib->environment,\n", g->depth);
+        fprintf(g->out, "        code_pointer_get_constant(&(fib->instr_pointer), %u));\n",
+                argument);
+        fprintf(g->out, "    increase_refcount(t%u);\n", g->depth);
+        use_temporaries(g, ++(g->depth));
+        return;
+
+    case INSTR_POP:
+        for (i = 0; i < argument && g->depth > 0; i++) {
+            fprintf(g->out, "    decrease_refcount(t%u);\n", --(g->depth));
+        }
+        if (i < argument) write_handler(g, "    ", opcode, argument - i, next);
+        return;
+
+    case INSTR_JMP:
+        spill(g, 0);
+        write_jump(g, "    ", offset, argument);
+        return;
+
+    case INSTR_JMP_IF_NOT:
+        load(g, 1);
+        spill(g, 1);
+        fprintf(g->out, "    decrease_refcount(t0);\n");
+        fprintf(g->out, "    if (t0 == NIL_FALSE) {\n");
+        write_jump(g, "        ", offset, argument);
+        fprintf(g->out, "    }\n");
+        g->depth = 0;
+        return;
+
+    case INSTR_CAR:
+    case INSTR_CDR:
+        load(g, 1);
+        spill(g, 1);
+        use_temporaries(g, 2);
+        fprintf(g->out, "    if (PRIMITIVE_INLINE_GUARDS[INSTR_%s] && is_of_type(t0, &TYPE_PAIR)) {\n",
+                FIBER_OP_NAMES[opcode]);
+        fprintf(g->out, "        t1 = %s(t0);\n", (opcode == INSTR_CAR) ? "get_car" : "get_cdr");
+        fprintf(g->out, "        increase_refcount(t1);\n");
+        fprintf(g->out, "        decrease_refcount(t0);\n");
+        fprintf(g->out, "        t0 = t1;\n");
+        write_slow_path(g, opcode, argument, next, 1);
+        return;
+
+    case INSTR_NULL:
+    case INSTR_NOT:
+        load(g, 1);
+        spill(g, 1);
+        fprintf(g->out, "    if (PRIMITIVE_INLINE_GUARDS[INSTR_%s]) {\n", FIBER_OP_NAMES[opcode]);
+        fprintf(g->out, "        decrease_refcount(t0);\n");
+        fprintf(g->out, "        t0 = (t0 == %s) ? NIL_TRUE : NIL_FALSE;\n",
+                (opcode == INSTR_NULL) ? "EMPTY_LIST" : "NIL_FALSE");
+        fprintf(g->out, "        increase_refcount(t0);\n");
+        write_slow_path(g, opcode, argument, next, 1);
+        return;
+
+    case INSTR_CONS:
+    case INSTR_EQ:
+        load(g, 2);
+        spill(g, 2);
+        use_temporaries(g, 3);
+        fprintf(g->out, "    if (PRIMITIVE_INLINE_GUARDS[INSTR_%s]) {\n", FIBER_OP_NAMES[opcode]);
+        if (opcode == INSTR_CONS) {
+            fprintf(g->out, "        t2 = cons(t0, t1);\n");
+        } else {
+            fprintf(g->out, "        t2 = eqv(t0, t1, EQ_STRICT) ? NIL_TRUE : NIL_FALSE;\n");
+        }
+        fprintf(g->out, "        increase_refcount(t2);\n");
+        fprintf(g->out, "        decrease_refcount(t0);\n");
+        fprintf(g->out, "        decrease_refcount(t1);\n");
+        fprintf(g->out, "        t0 = t2;\n");
+        write_slow_path(g, opcode, argument, next, 2);
+        g->depth = 1;
+        return;
+
+    case INSTR_ADD:
+    case INSTR_SUB:
+    case INSTR_LT:
+    case INSTR_NUM_EQ:
+        write_fixnum_instruction(g, opcode, argument, offset, 0);
+        return;
+
+    // The first parts never leave the procedure, see bytecode.h
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS)                      \
+    case INSTR_##NAME:                                                         \
+        write_instruction(g, INSTR_##FIRST,                                    \
+                          SUPERINSTRUCTION_FIRST_ARGUMENT(argument, BITS),     \
+                          offset, next);                                       \
+        write_instruction(g, INSTR_##SECOND,                                   \
+                          SUPERINSTRUCTION_SECOND_ARGUMENT(argument, BITS),    \
+                          offset, next);                                       \
+        return;
+
+    SUPERINSTRUCTION_TABLE
+
+#undef SUPERINSTRUCTION
+
+    default:
+        spill(g, 0);
+        write_handler(g, "    ", opcode, argument, next);
+        return;
+    }
+}
+
+
+/*
+ * Returns whether the instruction is a conditional jump, or ends in
+ * one, and stores its target.
+ */
+static bool is_conditional_jump(unsigned int opcode, unsigned int argument,
+                                unsigned int *target)
+{
+    switch (opcode) {
+    case INSTR_JMP_IF_NOT:
+        *target = argument;
+        return true;
+
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS)                  \
+    case INSTR_##NAME:                                                     \
+        *target = SUPERINSTRUCTION_SECOND_ARGUMENT(argument, BITS);        \
+        return INSTR_##SECOND == INSTR_JMP_IF_NOT;
+
+    SUPERINSTRUCTION_TABLE
+
+#undef SUPERINSTRUCTION
+
+    default:
+        return false;
+    }
+}
+
+
+// Returns false if there is no memory
+static bool write_function(FILE *out, const char *name, unsigned int index,
+                           struct code *code)
+{
+    struct generator g;
+    char *body;
+    size_t body_size;
+    unsigned int i, opcode, argument, target;
+
+    body = NULL;
+    g.out = open_memstream(&body, &body_size);
+    g.code = code;
+    g.targets = calloc(code->code_size + 1, sizeof(bool));
+    g.depths = calloc(code->code_size + 1, sizeof(unsigned int));
+    if (g.out == NULL || g.targets == NULL || g.depths == NULL) {
+        if (g.out != NULL) fclose(g.out);
+        free(body);
+        free(g.targets);
+        free(g.depths);
+        return false;
+    }
+    g.depth = 0;
+    g.max_depth = 0;
+    g.dispatches = false;
+    g.loops = false;
+    g.fixnums = false;
+    g.arithmetic = false;
+
+    for (i = 0; i < code->code_size; i++) {
+        opcode = INSTRUCTION_PART(code->codes[i]);
+        argument = ARGUMENT_PART(code->codes[i]);
+        if (opcode == INSTR_JMP) {
+            target = argument;
+        } else if (!is_conditional_jump(opcode, argument, &target)) {
+            continue;
+        }
+        if (target <= code->code_size) g.targets[target] = true;
+    }
+
+    for (i = 0; i < code->code_size; i++) {
+        opcode = INSTRUCTION_PART(code->codes[i]);
+        argument = ARGUMENT_PART(code->codes[i]);
+
+        if (g.targets[i]) spill(&g, 0);
+        g.depths[i] = g.depth;
+        fprintf(g.out, "i%u:\n", i);
+
+        if (is_fixnum_instruction(opcode)
+            && (opcode == INSTR_LT || opcode == INSTR_NUM_EQ)
+            && i + 1 < code->code_size
+            && INSTRUCTION_PART(code->codes[i + 1]) == INSTR_JMP_IF_NOT) {
+            write_fixnum_instruction(&g, opcode, argument, i, i + 1);
+        } else {
+            write_instruction(&g, opcode, argument, i, i + 1);
+        }
+    }
+    spill(&g, 0);
+    fprintf(g.out, "i%u:\n", code->code_size);
+    fprintf(g.out, "    fib->instr_pointer.offset = %u;\n", code->code_size);
+    fprintf(g.out, "    return;  // Returned from the procedure\n");
+
+    // Entries at offsets with live temporaries
+    for (i = 0; i < code->code_size; i++) {
+        if (g.depths[i] == 0) continue;
+        fprintf(g.out, "\ne%u:\n", i);
+        for (target = g.depths[i]; target > 0; target--) {
+            fprintf(g.out, "    t%u = fiber_pop(fib);\n", target - 1);
+        }
+        fprintf(g.out, "    goto i%u;\n", i);
+    }
+
+    if (g.dispatches) {
+        fprintf(g.out, "\njumped:\n");
+        fprintf(g.out, "    if (--budget == 0) return;\n");
+        fprintf(g.out, "    goto dispatch;\n");
+    }
+    fclose(g.out);
+
+    // Only declare what the procedure uses, the generated code
+    // compiles without warnings
+    fprintf(out, "static void aot_%s_%u(struct fiber *fib)\n{\n", name, index);
+    if (g.dispatches) {
+        fprintf(out, "    struct code *code = fib->instr_pointer.code;\n");
+    }
+    if (g.dispatches || g.loops) {
+        fprintf(out, "    unsigned int budget = JIT_JUMP_BUDGET;\n");
+    }
+    for (i = 0; i < g.max_depth; i++) {
+        fprintf(out, (i == 0) ? "    objptr_t t%u" : ", t%u", i);
+    }
+    if (g.max_depth > 0) fprintf(out, ";\n");
+    if (g.fixnums) fprintf(out, g.arithmetic ? "    int a, b, r;\n" : "    int a, b;\n");
+    fprintf(out, "\n");
+
+    if (g.dispatches) fprintf(out, "dispatch:\n");
+    fprintf(out, "    switch (fib->instr_pointer.offset) {\n");
+    for (i = 0; i <= code->code_size; i++) {
+        fprintf(out, "    case %u: goto %c%u;\n", i, (g.depths[i] > 0) ? 'e' : 'i', i);
+    }
+    fprintf(out, "    default: return;\n");
+    fprintf(out, "    }\n\n");
+
+    fwrite(body, 1, body_size, out);
+    fprintf(out, "}\n\n\n");
+
+    free(body);
+    free(g.targets);
+    free(g.depths);
+    return true;
+}
+
+
+/*
+ * Compiles the first form of the source file to a C file holding a
+ * module of the given name. The name is used in identifiers, other
+ * characters than letters and digits become underscores.
+ */
+bool compile_file_to_c(const char *source, const char *destination,
+                       const char *module_name)
+{
+    FILE *stream, *out;
+    char *data, *name;
+    size_t size, i;
+    objptr_t prototype, *prototypes;
+    unsigned int count, j;
+    bool result;
+
+    prototype = compile_source_to_prototype(source);
+    if (prototype == EMPTY_LIST) return false;
+
+    data = NULL;
+    size = 0;
+    stream = open_memstream(&data, &size);
+    if (stream == NULL) {
+        decrease_refcount(prototype);
+        return false;
+    }
+    result = write_bytecode_stream(stream, prototype, &prototypes, &count);
+    if (fclose(stream) != 0) result = false;
+
+    out = fopen(destination, "w");
+    if (out == NULL) result = false;
+
+    name = strdup(module_name);
+    if (name == NULL) {
+        result = false;
+    } else {
+        for (i = 0; name[i] != '\0'; i++) {
+            if (!isalnum((unsigned char) name[i])) name[i] = '_';
+        }
+    }
+
+    if (result) {
+        fprintf(out, "/* Generated from %s, do not edit */\n\n", source);
+        fprintf(out, "#include \"aot.h\"\n\n\n");
+
+        write_data(out, name, (unsigned char*) data, size);
+        for (j = 0; j < count && result; j++) {
+            result = write_function(out, name, j,
+                                    &((struct closure_prototype*) dereference(prototypes[j]))->code);
+        }
+    }
+
+    if (result) {
+
+        fprintf(out, "static struct jit_code aot_%s_natives[] = {\n", name);
+        for (j = 0; j < count; j++) {
+            fprintf(out, "    { 0, aot_%s_%u },\n", name, j);
+        }
+        fprintf(out, "};\n\n\n");
+
+        fprintf(out, "static struct aot_module aot_%s_module = {\n", name);
+        fprintf(out, "    \"%s\",\n", name);
+        fprintf(out, "    aot_%s_data,\n", name);
+        fprintf(out, "    sizeof(aot_%s_data),\n", name);
+        fprintf(out, "    aot_%s_natives,\n", name);
+        fprintf(out, "    %u,\n", count);
+        fprintf(out, "    NULL\n");
+        fprintf(out, "};\n\n\n");
+
+        fprintf(out, "__attribute__((constructor))\n");
+        fprintf(out, "static void aot_%s_register()\n{\n", name);
+        fprintf(out, "    aot_register(&aot_%s_module);\n", name);
+        fprintf(out, "}\n");
+    }
+
+    if (out != NULL && fclose(out) != 0) result = false;
+    if (!result && out != NULL) remove(destination);
+
+    free(name);
+    free(prototypes);
+    free(data);
+    decrease_refcount(prototype);
+
+    return result;
+}
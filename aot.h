@@ -0,0 +1,78 @@
+#pragma once
+
+#ifndef AOT_H_
+#define AOT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "environment.h"
+#include "fiber.h"
+#include "jit.h"
+#include "number.h"
+#include "object.h"
+#include "pair.h"
+#include "primitive.h"
+
+
+/*
+ * Ahead-of-time compilation
+ *
+ * A library can be compiled to a C file and linked into the
+ * executable. The C file holds the library in the format of a
+ * compiled code file, plus one function per prototype. Within
+ * straight-line code the function keeps operands in local
+ * variables instead of the fiber's stack, and inlined builtins run
+ * guarded fast paths for fixnums and pairs; the other instructions
+ * call the interpreter's handlers, see aot.c. Jumps within the
+ * procedure are gotos. Loading the module restores the prototypes
+ * and attaches these functions as their native code.
+ *
+ * Modules register themselves when the program starts, see
+ * compile_file_to_c().
+ */
+
+struct aot_module {
+    const char *name;
+    const unsigned char *data;
+    size_t size;
+    struct jit_code *natives;
+    unsigned int native_count;
+
+    struct aot_module *next;
+};
+
+
+/*
+ * Used by the generated code
+ */
+
+// Moves the caller's reference onto the fiber's stack
+static inline void aot_push(struct fiber *fib, objptr_t object)
+{
+    fiber_push(fib, object);
+    decrease_refcount(object);
+}
+
+
+// Stores the value of a number which is a plain int
+static inline bool aot_fixnum(objptr_t object, int *value)
+{
+    struct number buffer;
+    struct number *number;
+
+    if (!is_of_type(object, &TYPE_NUMBER)) return false;
+    number = number_view(object, &buffer);
+    if (number->type != NUMBER_INTEGER) return false;
+    *value = number->value.integer;
+    return true;
+}
+
+
+void aot_register(struct aot_module*);
+objptr_t aot_load(const char*);
+
+bool compile_file_to_c(const char*, const char*, const char*);
+
+
+#endif
@@ -1,119 +1,748 @@
 #include <ctype.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include "symbol.h"
 #include "pair.h"
 #include "vector.h"
+#include "bytevector.h"
+#include "string_object.h"
+#include "typed_vector.h"
 #include "character.h"
 #include "closure.h"
+#include "number.h"
+#include "primitive.h"
+#include "string_kernels.h"
 
 #include "baby_io.h"
 
 
 
-static bool is_whitespace_char(int c)
+enum frame_state {
+    READ_ELEMENTS,
+    READ_DOTTED_TAIL,  // After the dot
+    READ_CLOSING       // After the dotted tail
+};
+
+
+struct read_frame {
+    objptr_t head;          // The list or vector being read
+    objptr_t tail;          // The last pair of a list
+    unsigned int quotes;    // Quotes in front of the opening parenthesis
+    bool is_vector;
+    enum frame_state state;
+};
+
+
+
+/*
+ * Input
+ */
+
+
+static void init_reader(struct baby_reader *reader)
+{
+    reader->position = NULL;
+    reader->end = NULL;
+    reader->start = NULL;
+    reader->start_offset = 0;
+    reader->stream = NULL;
+    reader->buffer = NULL;
+    reader->mapping = NULL;
+    reader->mapped_length = 0;
+    reader->token = NULL;
+    reader->token_length = 0;
+    reader->token_alloc = 0;
+    reader->codes = NULL;
+    reader->code_count = 0;
+    reader->code_alloc = 0;
+    reader->character = 0;
+    reader->frames = NULL;
+    reader->frame_alloc = 0;
+}
+
+
+/*
+ * Maps the file at PATH. Returns false if it can't be read.
+ */
+bool open_file_reader(struct baby_reader *reader, const char *path)
+{
+    struct stat info;
+    void *mapping;
+    int fd;
+
+    init_reader(reader);
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return false;
+    }
+
+    // Empty files can't be mapped
+    if (info.st_size > 0) {
+        mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            return false;
+        }
+        reader->mapping = mapping;
+        reader->mapped_length = info.st_size;
+        reader->position = mapping;
+        reader->end = reader->position + info.st_size;
+        reader->start = reader->position;
+    }
+    close(fd);
+
+    return true;
+}
+
+
+/*
+ * Reads from STREAM. Returns false if there is no memory for the
+ * buffer.
+ */
+bool open_stream_reader(struct baby_reader *reader, FILE *stream)
+{
+    init_reader(reader);
+
+    reader->buffer = malloc(READER_BUFFER_SIZE);
+    if (reader->buffer == NULL) return false;
+    reader->stream = stream;
+    reader->position = reader->buffer;
+    reader->end = reader->buffer;
+    reader->start = reader->buffer;
+    return true;
+}
+
+
+/*
+ * Reads from the SIZE bytes at DATA, which must stay valid until the
+ * reader is closed.
+ */
+void open_buffer_reader(struct baby_reader *reader, const char *data, size_t size)
 {
-    return (c == ' ') || (c == '\t') || (c == '\n');
+    init_reader(reader);
+
+    reader->position = data;
+    reader->end = data + size;
+    reader->start = data;
 }
 
 
-static bool is_digit(int c)
+/*
+ * Stream readers hand the input they buffered but didn't parse back
+ * to the stream, as far as it can seek.
+ */
+void close_reader(struct baby_reader *reader)
 {
-    return isdigit(c);
+    if (reader->stream != NULL && reader->position < reader->end) {
+        fseek(reader->stream, -(long) (reader->end - reader->position), SEEK_CUR);
+    }
+    if (reader->mapping != NULL) {
+        munmap(reader->mapping, reader->mapped_length);
+    }
+    free(reader->buffer);
+    free(reader->token);
+    free(reader->codes);
+    free(reader->frames);
+
+    init_reader(reader);
 }
 
 
+static bool refill(struct baby_reader *reader)
+{
+    size_t count;
+
+    if (reader->stream == NULL) return false;
+
+    count = fread(reader->buffer, 1, READER_BUFFER_SIZE, reader->stream);
+    reader->start_offset += reader->end - reader->start;
+    reader->start = reader->buffer;
+    reader->position = reader->buffer;
+    reader->end = reader->buffer + count;
+    return count > 0;
+}
+
 
-static void slurp_whitespace(FILE *f)
+static inline int peek_char(struct baby_reader *reader)
+{
+    if (reader->position == reader->end && !refill(reader)) return EOF;
+    return (unsigned char) *reader->position;
+}
+
+
+static inline int next_char(struct baby_reader *reader)
 {
     int c;
 
-    do {
-        c = fgetc(f);
-    } while(is_whitespace_char(c));
-    
-    ungetc(c, f);
+    c = peek_char(reader);
+    if (c != EOF) reader->position++;
+    return c;
+}
+
+
+
+/*
+ * Tokens
+ *
+ * The lexer only fills the reader's buffers and never touches the
+ * heap, so readers on separate threads may run it at the same time.
+ */
+
+
+static bool is_whitespace_char(int c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n')
+        || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+
+static bool is_delimiter(int c)
+{
+    return (c == EOF) || is_whitespace_char(c)
+        || (c == '(') || (c == ')') || (c == '"') || (c == ';') || (c == '\'');
 }
 
 
-static objptr_t read_symbol(FILE *f, bool *fail)
+// Skips whitespace and comments
+static void skip_whitespace(struct baby_reader *reader)
 {
     int c;
-    unsigned int i;
-    char symbol[64];
-
-    for (i = 0; i < sizeof(symbol) - 1; i++)
-    {
-        c = fgetc(f);
-        if (c == EOF || is_whitespace_char(c) || c == ')') {
-            ungetc(c, f);
-            break;
+
+    for (;;) {
+        c = peek_char(reader);
+        if (c == ';') {
+            do {
+                c = next_char(reader);
+            } while (c != '\n' && c != EOF);
+        } else if (is_whitespace_char(c)) {
+            reader->position++;
         } else {
-            symbol[i] = c;
+            return;
         }
     }
-    
-    symbol[i] = '\0';
+}
+
+
+static bool reserve_token(struct baby_reader *reader, size_t size)
+{
+    size_t alloc;
+    char *token;
+
+    if (size <= reader->token_alloc) return true;
+
+    alloc = (reader->token_alloc < 64) ? 64 : 2 * reader->token_alloc;
+    if (alloc < size) alloc = size;
+    token = realloc(reader->token, alloc);
+    if (token == NULL) return false;
+
+    reader->token = token;
+    reader->token_alloc = alloc;
+    return true;
+}
+
+
+/*
+ * Reads FIRST and the characters up to the next delimiter into the
+ * token. Returns false if it doesn't fit into memory.
+ */
+static bool read_token(struct baby_reader *reader, int first)
+{
+    size_t length;
+    int c;
 
-    if (strcmp(symbol, "#t") == 0) {
-        return NIL_TRUE;
-    } else if (strcmp(symbol, "#f") == 0) {
-        return NIL_FALSE;
+    if (!reserve_token(reader, 2)) return false;
+    reader->token[0] = (char) first;
+    length = 1;
+    for (;;) {
+        c = peek_char(reader);
+        if (is_delimiter(c)) break;
+
+        if (!reserve_token(reader, length + 2)) return false;
+        reader->token[length++] = (char) c;
+        reader->position++;
     }
-    
-    *fail = (i == 0);
-    return c_string_to_symbol(symbol);
+
+    reader->token[length] = '\0';
+    reader->token_length = length;
+    return true;
 }
 
 
-static objptr_t read_list(FILE *f, bool *fail)
+static int parse_hex_code(struct baby_reader *reader, size_t start, size_t length)
 {
-    unsigned int c;
-    objptr_t obj;
+    unsigned long code;
+    char *end;
 
-    slurp_whitespace(f);
-    c = fgetc(f);
+    if (length <= start) return -1;
+    code = strtoul(reader->token + start, &end, 16);
+    return (end == reader->token + length && code <= 0x10ffff) ? (int) code : -1;
+}
 
-    if (c == ')') {
-        return EMPTY_LIST;
-    } else if (c == '.') {
-        obj = baby_read(f, fail);
-        if (*fail) return EMPTY_LIST;
-        slurp_whitespace(f);
-        c = fgetc(f);
-        *fail = !(c == ')');
-        return obj;
+
+// Reads a character after #\ like #\a, #\space or #\x41
+static bool read_character(struct baby_reader *reader)
+{
+    int code;
+
+    // The first character may be a delimiter, like in #\(
+    code = next_char(reader);
+    if (code == EOF || !read_token(reader, code)) return false;
+
+    if (reader->token_length == 1) {
+        code = (unsigned char) code;
+    } else if (strcmp(reader->token, "space") == 0) {
+        code = ' ';
+    } else if (strcmp(reader->token, "newline") == 0) {
+        code = '\n';
+    } else if (strcmp(reader->token, "tab") == 0) {
+        code = '\t';
+    } else if (strcmp(reader->token, "return") == 0) {
+        code = '\r';
+    } else if (strcmp(reader->token, "null") == 0) {
+        code = '\0';
+    } else if (reader->token[0] == 'x') {
+        code = parse_hex_code(reader, 1, reader->token_length);
     } else {
-        ungetc(c, f);
-        obj = baby_read(f, fail);
-        if (*fail) return EMPTY_LIST;
-        return cons(obj, read_list(f, fail));
+        code = -1;
     }
+
+    reader->character = code;
+    return code >= 0;
 }
 
 
-objptr_t baby_read(FILE *f, bool *fail)
+static bool append_code(struct baby_reader *reader, unichar_t code)
+{
+    unichar_t *codes;
+    size_t alloc;
+
+    if (reader->code_count == reader->code_alloc) {
+        alloc = (reader->code_alloc < 64) ? 64 : 2 * reader->code_alloc;
+        codes = realloc(reader->codes, alloc * sizeof(unichar_t));
+        if (codes == NULL) return false;
+        reader->codes = codes;
+        reader->code_alloc = alloc;
+    }
+
+    reader->codes[reader->code_count++] = code;
+    return true;
+}
+
+
+// Reads the rest of a string after the opening quote into the codes
+static bool read_string(struct baby_reader *reader)
+{
+    size_t length;
+    int c;
+
+    reader->code_count = 0;
+    for (;;) {
+        c = next_char(reader);
+        if (c == '"') return true;
+
+        if (c == '\\') {
+            c = next_char(reader);
+            switch (c) {
+            case 'n': c = '\n'; break;
+            case 't': c = '\t'; break;
+            case 'r': c = '\r'; break;
+            case 'a': c = '\a'; break;
+            case '0': c = '\0'; break;
+            case 'x':
+                // \x41; up to the semicolon
+                for (length = 0; (c = next_char(reader)) != ';' && isxdigit(c); length++) {
+                    if (!reserve_token(reader, length + 2)) return false;
+                    reader->token[length] = (char) c;
+                }
+                if (!reserve_token(reader, length + 1)) return false;
+                reader->token[length] = '\0';
+                c = (c == ';') ? parse_hex_code(reader, 0, length) : -1;
+                break;
+            default: break;
+            }
+        }
+
+        // EOF, a bad escape or no memory
+        if (c < 0 || !append_code(reader, c)) return false;
+    }
+}
+
+
+/*
+ * Reads the next token. Strings are left in the codes, characters in
+ * the character and atoms in the token.
+ */
+enum token_type reader_next_token(struct baby_reader *reader)
 {
     int c;
 
+    skip_whitespace(reader);
+    c = next_char(reader);
+
+    switch (c) {
+    case EOF: return TOKEN_END;
+    case '\'': return TOKEN_QUOTE;
+    case '(': return TOKEN_OPEN;
+    case ')': return TOKEN_CLOSE;
+    case '"': return read_string(reader) ? TOKEN_STRING : TOKEN_ERROR;
+    case '#':
+        if (peek_char(reader) == '(') {
+            reader->position++;
+            return TOKEN_OPEN_VECTOR;
+        } else if (peek_char(reader) == '\\') {
+            reader->position++;
+            return read_character(reader) ? TOKEN_CHARACTER : TOKEN_ERROR;
+        }
+        break;
+    default: break;
+    }
+
+    if (!read_token(reader, c)) return TOKEN_ERROR;
+    return (strcmp(reader->token, ".") == 0) ? TOKEN_DOT : TOKEN_ATOM;
+}
+
+
+
+/*
+ * Atoms
+ */
+
+
+#define DIGITS "0123456789"
+
+
+/*
+ * Tells what the NUL-terminated atom TOKEN stands for. Numbers are
+ * only taken apart here: integers and rationals by their digits,
+ * reals already converted.
+ */
+void classify_atom(const char *token, size_t length, struct atom_syntax *atom)
+{
+    const char *p;
+    char *end;
+
+    atom->negative = false;
+    atom->digits = NULL;
+    atom->digit_count = 0;
+    atom->denominator = NULL;
+    atom->denominator_count = 0;
+    atom->real = 0;
+
+    if (strcmp(token, "#t") == 0 || strcmp(token, "#true") == 0) {
+        atom->type = ATOM_TRUE;
+        return;
+    } else if (strcmp(token, "#f") == 0 || strcmp(token, "#false") == 0) {
+        atom->type = ATOM_FALSE;
+        return;
+    }
+
+    p = token;
+    atom->negative = (*p == '-');
+    if (*p == '+' || *p == '-') p++;
+
+    atom->digits = p;
+    atom->digit_count = strspn(p, DIGITS);
+    if (atom->digit_count > 0 && p[atom->digit_count] == '\0') {
+        atom->type = ATOM_INTEGER;
+        return;
+    }
+
+    if (atom->digit_count > 0 && p[atom->digit_count] == '/') {
+        atom->denominator = p + atom->digit_count + 1;
+        atom->denominator_count = strspn(atom->denominator, DIGITS);
+        if (atom->denominator_count > 0
+            && atom->denominator[atom->denominator_count] == '\0'
+            && strspn(atom->denominator, "0") < atom->denominator_count) {
+            atom->type = ATOM_RATIONAL;
+            return;
+        }
+        atom->type = (token[0] == '#') ? ATOM_INVALID : ATOM_SYMBOL;
+        return;
+    }
+
+    if (p != token && strcmp(p, "inf.0") == 0) {
+        atom->type = ATOM_REAL;
+        atom->real = atom->negative ? -INFINITY : INFINITY;
+        return;
+    } else if (p != token && strcmp(p, "nan.0") == 0) {
+        atom->type = ATOM_REAL;
+        atom->real = NAN;
+        return;
+    }
+
+    // strtod() would also take hexadecimal numbers and names
+    if ((isdigit((unsigned char) p[0]) || (p[0] == '.' && isdigit((unsigned char) p[1])))
+        && p[strspn(p, DIGITS ".eE+-")] == '\0') {
+        atom->real = strtod(token, &end);
+        if (end == token + length) {
+            atom->type = ATOM_REAL;
+            return;
+        }
+    }
+
+    atom->type = (token[0] == '#') ? ATOM_INVALID : ATOM_SYMBOL;
+}
+
+
+
+/*
+ * Parsing
+ */
+
+
+// Frees a fresh object nothing refers to
+static void release(objptr_t ptr)
+{
+    increase_refcount(ptr);
+    decrease_refcount(ptr);
+}
+
+
+// Returns EMPTY_LIST if there is no memory for the number
+static objptr_t parse_integer(const char *digits, size_t count, bool negative)
+{
+    unsigned long long value;
+    limb_t *limbs;
+    size_t i;
+
+    // Up to 18 digits fit into a long long
+    if (count <= 18) {
+        value = 0;
+        for (i = 0; i < count; i++) {
+            value = 10 * value + (digits[i] - '0');
+        }
+        return make_integer_from_long_long(negative ? -(long long) value : (long long) value);
+    }
+
+    limbs = malloc((count / 9 + 1) * sizeof(limb_t));
+    if (limbs == NULL) return EMPTY_LIST;
+    return make_integer_from_limbs(negative, limbs,
+                                   bignum_from_decimal(limbs, digits, count));
+}
+
+
+static objptr_t parse_atom(const char *token, size_t length, bool *fail)
+{
+    struct atom_syntax atom;
+    objptr_t numerator, denominator, result;
+
+    classify_atom(token, length, &atom);
+    switch (atom.type) {
+    case ATOM_TRUE: return NIL_TRUE;
+    case ATOM_FALSE: return NIL_FALSE;
+    case ATOM_INTEGER:
+        result = parse_integer(atom.digits, atom.digit_count, atom.negative);
+        *fail = (result == EMPTY_LIST);
+        return result;
+    case ATOM_RATIONAL:
+        numerator = parse_integer(atom.digits, atom.digit_count, atom.negative);
+        denominator = parse_integer(atom.denominator, atom.denominator_count, false);
+        result = (numerator == EMPTY_LIST || denominator == EMPTY_LIST)
+            ? EMPTY_LIST : number_divide(numerator, denominator);
+        release(numerator);
+        release(denominator);
+        *fail = (result == EMPTY_LIST);
+        return result;
+    case ATOM_REAL: return make_real(atom.real);
+    case ATOM_SYMBOL:
+        return latin1_to_symbol(token, length, units8_hash((const uint8_t*) token, length));
+    default:
+        *fail = true;
+        return EMPTY_LIST;
+    }
+}
+
+
+static struct read_frame *push_frame(struct baby_reader *reader,
+                                     unsigned int depth)
+{
+    struct read_frame *frames;
+    unsigned int alloc;
+
+    if (depth >= reader->frame_alloc) {
+        alloc = (reader->frame_alloc < 16) ? 16 : 2 * reader->frame_alloc;
+        frames = realloc(reader->frames, alloc * sizeof(struct read_frame));
+        if (frames == NULL) return NULL;
+        reader->frames = frames;
+        reader->frame_alloc = alloc;
+    }
+
+    return &reader->frames[depth];
+}
+
+
+static objptr_t quote(objptr_t datum, unsigned int quotes)
+{
+    for (; quotes > 0; quotes--) {
+        datum = cons(SYMBOL_QUOTE, cons(datum, EMPTY_LIST));
+    }
+    return datum;
+}
+
+
+static objptr_t make_literal_string(struct baby_reader *reader)
+{
+    objptr_t result;
+
+    result = make_string_from_codes(reader->codes, reader->code_count);
+    if (result != EMPTY_LIST) {
+        ((struct string*) dereference(result))->is_immutable = true;
+    }
+    return result;
+}
+
+
+/*
+ * Reads the next datum. Sets FAIL on syntax errors and at the end of
+ * the input.
+ */
+objptr_t reader_read(struct baby_reader *reader, bool *fail)
+{
+    struct read_frame *frame;
+    unsigned int depth, quotes;
+    objptr_t datum, pair;
+    enum token_type token;
+
     *fail = false;
-    
-    slurp_whitespace(f);
-    c = fgetc(f);
-
-    if (c == '(') {
-        return read_list(f, fail);
-    } else if (is_digit(c)) {
-        // TODO
+    depth = 0;
+    quotes = 0;
+
+    for (;;) {
+        token = reader_next_token(reader);
+
+        switch (token) {
+        case TOKEN_QUOTE:
+            quotes++;
+            continue;
+        case TOKEN_OPEN:
+        case TOKEN_OPEN_VECTOR:
+            frame = push_frame(reader, depth++);
+            if (frame == NULL) {
+                *fail = true;
+                return EMPTY_LIST;
+            }
+            frame->is_vector = (token == TOKEN_OPEN_VECTOR);
+            frame->head = frame->is_vector ? make_vector(EMPTY_LIST, 0) : EMPTY_LIST;
+            frame->tail = EMPTY_LIST;
+            frame->quotes = quotes;
+            frame->state = READ_ELEMENTS;
+            quotes = 0;
+            continue;
+        case TOKEN_CLOSE:
+            if (depth == 0 || quotes > 0) {
+                *fail = true;
+                return EMPTY_LIST;
+            }
+            frame = &reader->frames[--depth];
+            if (frame->state == READ_DOTTED_TAIL) {
+                *fail = true;
+                return EMPTY_LIST;
+            }
+            datum = quote(frame->head, frame->quotes);
+            break;
+        case TOKEN_DOT:
+            // The dot before the tail of a list
+            frame = (depth > 0) ? &reader->frames[depth - 1] : NULL;
+            if (frame == NULL || frame->is_vector || frame->head == EMPTY_LIST
+                || frame->state != READ_ELEMENTS || quotes > 0) {
+                *fail = true;
+                return EMPTY_LIST;
+            }
+            frame->state = READ_DOTTED_TAIL;
+            continue;
+        case TOKEN_STRING:
+            datum = make_literal_string(reader);
+            *fail = (datum == EMPTY_LIST);
+            datum = quote(datum, quotes);
+            quotes = 0;
+            break;
+        case TOKEN_CHARACTER:
+            datum = quote(get_character(reader->character), quotes);
+            quotes = 0;
+            break;
+        case TOKEN_ATOM:
+            datum = quote(parse_atom(reader->token, reader->token_length, fail), quotes);
+            quotes = 0;
+            break;
+        default:
+            *fail = true;
+            return EMPTY_LIST;
+        }
+
+        if (*fail) return EMPTY_LIST;
+        if (depth == 0) return datum;
+
+        // Add the datum to the enclosing list or vector
+        frame = &reader->frames[depth - 1];
+        if (frame->is_vector) {
+            vector_append(frame->head, datum);
+        } else if (frame->state == READ_DOTTED_TAIL) {
+            set_cdr(frame->tail, datum);
+            frame->state = READ_CLOSING;
+        } else if (frame->state == READ_CLOSING) {
+            *fail = true;
+            return EMPTY_LIST;
+        } else {
+            pair = cons(datum, EMPTY_LIST);
+            if (frame->head == EMPTY_LIST) {
+                frame->head = pair;
+            } else {
+                set_cdr(frame->tail, pair);
+            }
+            frame->tail = pair;
+        }
+    }
+}
+
+
+/*
+ * Returns true if only whitespace and comments are left.
+ */
+bool reader_at_end(struct baby_reader *reader)
+{
+    skip_whitespace(reader);
+    return peek_char(reader) == EOF;
+}
+
+
+/*
+ * Returns the number of input bytes consumed so far.
+ */
+size_t reader_offset(struct baby_reader *reader)
+{
+    return reader->start_offset + (reader->position - reader->start);
+}
+
+
+/*
+ * Reads one datum from the stream.
+ */
+objptr_t baby_read(FILE *f, bool *fail)
+{
+    struct baby_reader reader;
+    objptr_t datum;
+
+    if (!open_stream_reader(&reader, f)) {
+        *fail = true;
         return EMPTY_LIST;
-    } else if (c == '\'') {
-        return cons(SYMBOL_QUOTE, cons(baby_read(f, fail), EMPTY_LIST));
-    } else {
-        ungetc(c, f);
-        return read_symbol(f, fail);
     }
+    datum = reader_read(&reader, fail);
+    close_reader(&reader);
+
+    return datum;
 }
 
+
 void baby_print(objptr_t expr)
 {
     if (is_of_type(expr, &TYPE_PAIR)) {
@@ -123,18 +752,84 @@ void baby_print(objptr_t expr)
         baby_print(get_cdr(expr));
         putchar(')');
     } else if (is_of_type(expr, &TYPE_SYMBOL)) {
-        struct symbol *symb = (struct symbol*) dereference(expr);
-        for (unsigned int i = 0; i < vector_length(symb->name_string); i++) {
-            putchar(character_value(vector_get(symb->name_string, i)));
-        }
+        string_print(symbol_to_string(expr), stdout);
+    } else if (is_of_type(expr, &TYPE_STRING)) {
+        putchar('"');
+        string_print(expr, stdout);
+        putchar('"');
     } else if (is_of_type(expr, &TYPE_CLOSURE)) {
-        printf("#<closure:%x>", expr);
+        printf("#<closure:%x>", (unsigned int) expr);
+    } else if (is_of_type(expr, &TYPE_PRIMITIVE)) {
+        printf("#<primitive:");
+        baby_print(((struct primitive*) dereference(expr))->name);
+        putchar('>');
+    } else if (is_of_type(expr, &TYPE_NUMBER)) {
+        struct number buffer;
+        struct number *num = number_view(expr, &buffer);
+        switch (num->type) {
+        case NUMBER_INTEGER:
+            printf("%d", num->value.integer);
+            break;
+        case NUMBER_RATIONAL:
+            printf("%d/%u", num->value.rational.numerator,
+                   num->value.rational.denominator);
+            break;
+        case NUMBER_REAL:
+            // The sign of a NaN isn't kept with -DNIL_NAN_BOXING
+            printf("%g", isnan(num->value.real) ? NAN : num->value.real);
+            break;
+        case NUMBER_COMPLEX:
+            printf("%g%+gi", num->value.complex.real,
+                   num->value.complex.imaginary);
+            break;
+        case NUMBER_BIGNUM: {
+            char *digits = bignum_to_decimal(num->value.bignum.limbs,
+                                             num->value.bignum.length);
+            if (digits != NULL) {
+                printf("%s%s", num->value.bignum.negative ? "-" : "", digits);
+            } else {
+                printf("#<bignum:%x>", (unsigned int) expr);
+            }
+            free(digits);
+            break;
+        }
+        case NUMBER_BIG_RATIONAL: {
+            char *numerator = bignum_to_decimal(num->value.big_rational.numerator,
+                                                num->value.big_rational.numerator_length);
+            char *denominator = bignum_to_decimal(num->value.big_rational.denominator,
+                                                  num->value.big_rational.denominator_length);
+            if (numerator != NULL && denominator != NULL) {
+                printf("%s%s/%s", num->value.big_rational.negative ? "-" : "",
+                       numerator, denominator);
+            } else {
+                printf("#<rational:%x>", (unsigned int) expr);
+            }
+            free(numerator);
+            free(denominator);
+            break;
+        }
+        }
     } else if (is_of_type(expr, &TYPE_CLOSURE_PROTOTYPE)) {
-        printf("#<closure-prototype:%x>", expr);
+        printf("#<closure-prototype:%x>", (unsigned int) expr);
     } else if (is_of_type(expr, &TYPE_CHARACTER)) {
-        printf("#<character:%x>", expr);
+        printf("#<character:%x>", (unsigned int) expr);
+    } else if (is_of_type(expr, &TYPE_BYTEVECTOR)) {
+        printf("#u8(");
+        for (size_t i = 0; i < bytevector_length(expr); i++) {
+            if (i > 0) putchar(' ');
+            printf("%d", bytevector_ref(expr, i));
+        }
+        putchar(')');
+    } else if (is_of_type(expr, &TYPE_TYPED_VECTOR)) {
+        struct typed_vector *vector = (struct typed_vector*) dereference(expr);
+        printf("#%s(", typed_vector_tag(vector->type));
+        for (unsigned int i = 0; i < vector->length; i++) {
+            if (i > 0) putchar(' ');
+            baby_print(typed_vector_ref(expr, i));
+        }
+        putchar(')');
     } else if (is_of_type(expr, &TYPE_VECTOR)) {
-        printf("#<vector:%x>", expr);
+        printf("#<vector:%x>", (unsigned int) expr);
     } else if (expr == EMPTY_LIST) {
         printf("()");
     } else if (expr == NIL_TRUE) {
@@ -6,9 +6,102 @@
 #include <stdio.h>
 #include <stdbool.h>
 
+#include "character.h"
 #include "object.h"
 
 
+/*
+ * Readers
+ *
+ * A reader parses data out of a buffer, which holds a mapping of a
+ * whole file, memory given by the caller or the last chunk read
+ * from a stream. Nested lists and vectors are kept on an explicit
+ * stack, so their depth and length are only limited by memory.
+ */
+
+#define READER_BUFFER_SIZE 65536
+
+
+struct read_frame;
+
+
+struct baby_reader {
+    const char *position;
+    const char *end;
+
+    // The buffer's start and its offset in the input
+    const char *start;
+    size_t start_offset;
+
+    FILE *stream;          // Refills the buffer unless NULL
+    char *buffer;          // Owned by stream readers
+    void *mapping;         // Owned by file readers
+    size_t mapped_length;
+
+    // The characters of the current atom
+    char *token;
+    size_t token_length;
+    size_t token_alloc;
+
+    // The characters of the current string, or character
+    unichar_t *codes;
+    size_t code_count;
+    size_t code_alloc;
+    unichar_t character;
+
+    struct read_frame *frames;
+    unsigned int frame_alloc;
+};
+
+
+enum token_type {
+    TOKEN_END,
+    TOKEN_ERROR,
+    TOKEN_OPEN,          // (
+    TOKEN_OPEN_VECTOR,   // #(
+    TOKEN_CLOSE,
+    TOKEN_QUOTE,
+    TOKEN_DOT,           // Before the tail of a list
+    TOKEN_STRING,        // In the codes
+    TOKEN_CHARACTER,     // In the character
+    TOKEN_ATOM           // Symbols, numbers and booleans, in the token
+};
+
+
+enum atom_type {
+    ATOM_INVALID,
+    ATOM_TRUE,
+    ATOM_FALSE,
+    ATOM_SYMBOL,
+    ATOM_INTEGER,
+    ATOM_RATIONAL,
+    ATOM_REAL
+};
+
+
+struct atom_syntax {
+    enum atom_type type;
+    bool negative;
+    const char *digits;        // Of integers and numerators
+    size_t digit_count;
+    const char *denominator;   // Of rationals
+    size_t denominator_count;
+    double real;
+};
+
+
+bool open_file_reader(struct baby_reader*, const char*);
+bool open_stream_reader(struct baby_reader*, FILE*);
+void open_buffer_reader(struct baby_reader*, const char*, size_t);
+void close_reader(struct baby_reader*);
+
+enum token_type reader_next_token(struct baby_reader*);
+void classify_atom(const char*, size_t, struct atom_syntax*);
+
+objptr_t reader_read(struct baby_reader*, bool*);
+bool reader_at_end(struct baby_reader*);
+size_t reader_offset(struct baby_reader*);
+
 objptr_t baby_read(FILE*, bool*);
 void baby_print(objptr_t);
 
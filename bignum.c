@@ -0,0 +1,577 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bignum.h"
+
+
+#define LIMB_BASE ((uint64_t) 1 << LIMB_BITS)
+
+// The largest power of ten in a limb, and its digits
+#define DECIMAL_BASE   1000000000u
+#define DECIMAL_DIGITS 9
+
+// Shorter magnitudes are converted by repeated short division
+#define DECIMAL_THRESHOLD 16
+
+// Powers of ten used to split longer ones, enough for 2^32 limbs
+#define DECIMAL_MAX_LEVELS 32
+
+
+
+unsigned int bignum_normalize(const limb_t *a, unsigned int length)
+{
+    while (length > 0 && a[length - 1] == 0) length--;
+    return length;
+}
+
+
+int bignum_compare(const limb_t *a, unsigned int a_length,
+                   const limb_t *b, unsigned int b_length)
+{
+    unsigned int i;
+
+    a_length = bignum_normalize(a, a_length);
+    b_length = bignum_normalize(b, b_length);
+    if (a_length != b_length) return (a_length > b_length) ? 1 : -1;
+
+    for (i = a_length; i > 0; i--) {
+        if (a[i - 1] != b[i - 1]) return (a[i - 1] > b[i - 1]) ? 1 : -1;
+    }
+    return 0;
+}
+
+
+
+/*
+ * Helpers on magnitudes of fixed length, which may have leading
+ * zero limbs
+ */
+
+
+// R = A + B with A_LENGTH >= B_LENGTH, R has A_LENGTH limbs
+static limb_t add_limbs(limb_t *r, const limb_t *a, unsigned int a_length,
+                        const limb_t *b, unsigned int b_length)
+{
+    uint64_t sum;
+    limb_t carry;
+    unsigned int i;
+
+    carry = 0;
+    for (i = 0; i < a_length; i++) {
+        sum = (uint64_t) a[i] + (i < b_length ? b[i] : 0) + carry;
+        r[i] = (limb_t) sum;
+        carry = (limb_t) (sum >> LIMB_BITS);
+    }
+    return carry;
+}
+
+
+// R = A - B with A_LENGTH >= B_LENGTH, R has A_LENGTH limbs
+static limb_t subtract_limbs(limb_t *r, const limb_t *a, unsigned int a_length,
+                             const limb_t *b, unsigned int b_length)
+{
+    uint64_t difference;
+    limb_t borrow;
+    unsigned int i;
+
+    borrow = 0;
+    for (i = 0; i < a_length; i++) {
+        difference = (uint64_t) a[i] - (i < b_length ? b[i] : 0) - borrow;
+        r[i] = (limb_t) difference;
+        borrow = (limb_t) (difference >> (2 * LIMB_BITS - 1));
+    }
+    return borrow;
+}
+
+
+// R += X, the sum must fit into R_LENGTH limbs
+static void add_into(limb_t *r, unsigned int r_length,
+                     const limb_t *x, unsigned int x_length)
+{
+    x_length = bignum_normalize(x, x_length);
+    add_limbs(r, r, r_length, x, x_length);
+}
+
+
+// R -= X, the difference must not be negative
+static void subtract_from(limb_t *r, unsigned int r_length,
+                          const limb_t *x, unsigned int x_length)
+{
+    x_length = bignum_normalize(x, x_length);
+    subtract_limbs(r, r, r_length, x, x_length);
+}
+
+
+unsigned int bignum_add(limb_t *r, const limb_t *a, unsigned int a_length,
+                        const limb_t *b, unsigned int b_length)
+{
+    if (a_length < b_length) return bignum_add(r, b, b_length, a, a_length);
+
+    r[a_length] = add_limbs(r, a, a_length, b, b_length);
+    return bignum_normalize(r, a_length + 1);
+}
+
+
+unsigned int bignum_subtract(limb_t *r, const limb_t *a, unsigned int a_length,
+                             const limb_t *b, unsigned int b_length)
+{
+    b_length = bignum_normalize(b, b_length);
+    subtract_limbs(r, a, a_length, b, b_length);
+    return bignum_normalize(r, a_length);
+}
+
+
+
+/*
+ * Multiplication
+ */
+
+
+static void multiply_schoolbook(limb_t *r, const limb_t *a, unsigned int a_length,
+                                const limb_t *b, unsigned int b_length)
+{
+    uint64_t product;
+    limb_t carry;
+    unsigned int i, j;
+
+    memset(r, 0, (a_length + b_length) * sizeof(limb_t));
+    for (i = 0; i < b_length; i++) {
+        if (b[i] == 0) continue;
+        carry = 0;
+        for (j = 0; j < a_length; j++) {
+            product = (uint64_t) a[j] * b[i] + r[i + j] + carry;
+            r[i + j] = (limb_t) product;
+            carry = (limb_t) (product >> LIMB_BITS);
+        }
+        r[i + a_length] = carry;
+    }
+}
+
+
+/*
+ * R = A * B, R has A_LENGTH + B_LENGTH limbs. With A = A1 * X + A0
+ * and B = B1 * X + B0, the middle part of the product is
+ * (A0 + A1) * (B0 + B1) - A0 * B0 - A1 * B1, so three products of
+ * half the length are enough. Without memory for the partial
+ * products, the schoolbook way is taken.
+ */
+static void multiply_limbs(limb_t *r, const limb_t *a, unsigned int a_length,
+                           const limb_t *b, unsigned int b_length)
+{
+    limb_t *sum_a, *sum_b, *middle, *part;
+    unsigned int split, high, middle_length, room, i, n;
+
+    if (a_length < b_length) {
+        multiply_limbs(r, b, b_length, a, a_length);
+        return;
+    }
+
+    if (b_length < KARATSUBA_THRESHOLD) {
+        multiply_schoolbook(r, a, a_length, b, b_length);
+        return;
+    }
+
+    if (2 * b_length <= a_length) {
+        // Unbalanced: multiply B with slices of A of its length
+        part = malloc(2 * b_length * sizeof(limb_t));
+        if (part == NULL) {
+            multiply_schoolbook(r, a, a_length, b, b_length);
+            return;
+        }
+        memset(r, 0, (a_length + b_length) * sizeof(limb_t));
+        for (i = 0; i < a_length; i += b_length) {
+            n = (a_length - i < b_length) ? a_length - i : b_length;
+            multiply_limbs(part, a + i, n, b, b_length);
+            add_into(r + i, a_length + b_length - i, part, n + b_length);
+        }
+        free(part);
+        return;
+    }
+
+    split = a_length / 2;  // Less than B_LENGTH
+    high = a_length - split;
+
+    sum_a = malloc((high + 1) * sizeof(limb_t));
+    sum_b = calloc(high + 1, sizeof(limb_t));
+    middle_length = 2 * (high + 1);
+    middle = malloc(middle_length * sizeof(limb_t));
+    if (sum_a == NULL || sum_b == NULL || middle == NULL) {
+        free(sum_a);
+        free(sum_b);
+        free(middle);
+        multiply_schoolbook(r, a, a_length, b, b_length);
+        return;
+    }
+
+    sum_a[high] = add_limbs(sum_a, a + split, high, a, split);
+    memcpy(sum_b, b, split * sizeof(limb_t));
+    add_into(sum_b, high + 1, b + split, b_length - split);
+    multiply_limbs(middle, sum_a, high + 1, sum_b, high + 1);
+
+    multiply_limbs(r, a, split, b, split);
+    multiply_limbs(r + 2 * split, a + split, high, b + split, b_length - split);
+
+    subtract_from(middle, middle_length, r, 2 * split);
+    subtract_from(middle, middle_length, r + 2 * split, a_length + b_length - 2 * split);
+
+    room = a_length + b_length - split;
+    add_into(r + split, room, middle,
+             middle_length < room ? middle_length : room);
+
+    free(sum_a);
+    free(sum_b);
+    free(middle);
+}
+
+
+unsigned int bignum_multiply(limb_t *r, const limb_t *a, unsigned int a_length,
+                             const limb_t *b, unsigned int b_length)
+{
+    a_length = bignum_normalize(a, a_length);
+    b_length = bignum_normalize(b, b_length);
+    if (a_length == 0 || b_length == 0) return 0;
+
+    multiply_limbs(r, a, a_length, b, b_length);
+    return bignum_normalize(r, a_length + b_length);
+}
+
+
+
+/*
+ * Division
+ */
+
+
+// Q = A / D, returns the remainder. Q has A_LENGTH limbs
+static limb_t divide_short(limb_t *q, const limb_t *a, unsigned int a_length,
+                           limb_t d)
+{
+    uint64_t current;
+    unsigned int i;
+
+    current = 0;
+    for (i = a_length; i > 0; i--) {
+        current = (current << LIMB_BITS) | a[i - 1];
+        q[i - 1] = (limb_t) (current / d);
+        current %= d;
+    }
+    return (limb_t) current;
+}
+
+
+static unsigned int leading_zeros(limb_t limb)
+{
+    return (limb == 0) ? LIMB_BITS : (unsigned int) __builtin_clz(limb);
+}
+
+
+// R = A << SHIFT, returns the bits shifted out. SHIFT < LIMB_BITS
+static limb_t shift_left(limb_t *r, const limb_t *a, unsigned int length,
+                         unsigned int shift)
+{
+    limb_t carry, limb;
+    unsigned int i;
+
+    if (shift == 0) {
+        memmove(r, a, length * sizeof(limb_t));
+        return 0;
+    }
+
+    carry = 0;
+    for (i = 0; i < length; i++) {
+        limb = a[i];
+        r[i] = (limb << shift) | carry;
+        carry = limb >> (LIMB_BITS - shift);
+    }
+    return carry;
+}
+
+
+/*
+ * Long division (Knuth, TAOCP vol. 2, algorithm D): the divisor is
+ * shifted so its top bit is set, then every quotient limb is
+ * estimated from the top limbs and corrected at most twice.
+ *
+ * No scratch memory is needed: the shifted dividend U is kept in Q,
+ * whose top limb is free after each step and takes the quotient
+ * limb, and the shifted divisor V is kept in R until the end.
+ */
+unsigned int bignum_divide(limb_t *q, limb_t *r, unsigned int *r_length,
+                           const limb_t *a, unsigned int a_length,
+                           const limb_t *b, unsigned int b_length)
+{
+    limb_t *u, *v, high;
+    uint64_t estimate, rest, product, difference;
+    limb_t borrow, carry;
+    unsigned int shift, i, j;
+
+    a_length = bignum_normalize(a, a_length);
+    b_length = bignum_normalize(b, b_length);
+
+    if (bignum_compare(a, a_length, b, b_length) < 0) {
+        memmove(r, a, a_length * sizeof(limb_t));
+        *r_length = a_length;
+        return 0;
+    }
+
+    if (b_length == 1) {
+        r[0] = divide_short(q, a, a_length, b[0]);
+        *r_length = bignum_normalize(r, 1);
+        return bignum_normalize(q, a_length);
+    }
+
+    u = q;
+    v = r;
+
+    shift = leading_zeros(b[b_length - 1]);
+    shift_left(v, b, b_length, shift);
+    u[a_length] = shift_left(u, a, a_length, shift);
+
+    for (j = a_length - b_length + 1; j > 0; j--) {
+        // Estimate the quotient limb from the top two limbs
+        estimate = (((uint64_t) u[j - 1 + b_length] << LIMB_BITS)
+                    | u[j - 2 + b_length]) / v[b_length - 1];
+        rest = (((uint64_t) u[j - 1 + b_length] << LIMB_BITS)
+                | u[j - 2 + b_length]) - estimate * v[b_length - 1];
+        while (estimate >= LIMB_BASE ||
+               estimate * v[b_length - 2] > ((rest << LIMB_BITS) | u[j - 3 + b_length])) {
+            estimate--;
+            rest += v[b_length - 1];
+            if (rest >= LIMB_BASE) break;
+        }
+
+        // Subtract estimate * V from the current part of U
+        borrow = 0;
+        carry = 0;
+        for (i = 0; i < b_length; i++) {
+            product = estimate * v[i] + carry;
+            carry = (limb_t) (product >> LIMB_BITS);
+            difference = (uint64_t) u[j - 1 + i] - (limb_t) product - borrow;
+            u[j - 1 + i] = (limb_t) difference;
+            borrow = (limb_t) (difference >> (2 * LIMB_BITS - 1));
+        }
+        difference = (uint64_t) u[j - 1 + b_length] - carry - borrow;
+        u[j - 1 + b_length] = (limb_t) difference;
+
+        // The estimate was one too large, add V back
+        if (difference >> (2 * LIMB_BITS - 1)) {
+            estimate--;
+            u[j - 1 + b_length] += add_limbs(u + j - 1, u + j - 1, b_length, v, b_length);
+        }
+
+        u[j - 1 + b_length] = (limb_t) estimate;
+    }
+
+    // The remainder is the rest of U, shifted back
+    for (i = 0; i < b_length; i++) {
+        high = (i + 1 < b_length) ? u[i + 1] : 0;
+        r[i] = (shift == 0) ? u[i]
+            : (u[i] >> shift) | (high << (LIMB_BITS - shift));
+    }
+    *r_length = bignum_normalize(r, b_length);
+
+    memmove(q, q + b_length, (a_length - b_length + 1) * sizeof(limb_t));
+    return bignum_normalize(q, a_length - b_length + 1);
+}
+
+
+
+/*
+ * Conversion to decimal
+ *
+ * Short magnitudes are divided by 10^9 repeatedly. Longer ones are
+ * divided by a power 10^(9 * 2^k) of about half their length and
+ * both halves are converted recursively, which is much faster
+ * with Karatsuba multiplication behind the division.
+ */
+
+
+struct decimal_powers {
+    limb_t *powers[DECIMAL_MAX_LEVELS];   // 10^(9 * 2^k)
+    unsigned int lengths[DECIMAL_MAX_LEVELS];
+    unsigned int count;
+};
+
+
+/*
+ * Writes the digits of A, padded with zeros to WIDTH unless it is 0.
+ * Returns the end of the digits, or NULL if there is no memory.
+ */
+static char *write_short(char *p, const limb_t *a, unsigned int length,
+                         size_t width)
+{
+    limb_t *q;
+    limb_t *chunks;
+    unsigned int chunk_count, i;
+    size_t digits;
+    char buffer[DECIMAL_DIGITS + 1];
+
+    q = malloc((length + 1) * sizeof(limb_t));
+    chunks = malloc((2 * length + 1) * sizeof(limb_t));
+    if (q == NULL || chunks == NULL) {
+        free(q);
+        free(chunks);
+        return NULL;
+    }
+
+    memcpy(q, a, length * sizeof(limb_t));
+    chunk_count = 0;
+    while (length > 0) {
+        chunks[chunk_count++] = divide_short(q, q, length, DECIMAL_BASE);
+        length = bignum_normalize(q, length);
+    }
+
+    digits = 0;
+    if (chunk_count > 0) {
+        digits = (chunk_count - 1) * DECIMAL_DIGITS
+            + sprintf(buffer, "%u", chunks[chunk_count - 1]);
+    }
+    for (; width > digits; width--) *(p++) = '0';
+
+    if (chunk_count > 0) {
+        p += sprintf(p, "%u", chunks[chunk_count - 1]);
+        for (i = chunk_count - 1; i > 0; i--) {
+            p += sprintf(p, "%09u", chunks[i - 1]);
+        }
+    }
+
+    free(q);
+    free(chunks);
+    return p;
+}
+
+
+static char *write_decimal(char *p, const limb_t *a, unsigned int length,
+                           struct decimal_powers *powers, unsigned int level,
+                           size_t width)
+{
+    limb_t *q, *r;
+    const limb_t *power;
+    unsigned int power_length, q_length, r_length;
+    size_t low_width;
+
+    length = bignum_normalize(a, length);
+    if (length <= DECIMAL_THRESHOLD || level == 0) {
+        return write_short(p, a, length, width);
+    }
+
+    // A is less than the square of the power on this level, unless
+    // there was no memory for higher powers
+    level--;
+    power = powers->powers[level];
+    power_length = powers->lengths[level];
+    low_width = (size_t) DECIMAL_DIGITS << level;
+
+    if (bignum_compare(a, length, power, power_length) < 0) {
+        return write_decimal(p, a, length, powers, level, width);
+    }
+
+    q = malloc((length + 1) * sizeof(limb_t));
+    r = malloc(power_length * sizeof(limb_t));
+    if (q == NULL || r == NULL) {
+        free(q);
+        free(r);
+        return NULL;
+    }
+    q_length = bignum_divide(q, r, &r_length, a, length, power, power_length);
+
+    p = write_decimal(p, q, q_length, powers, level,
+                      width > low_width ? width - low_width : 0);
+    if (p != NULL) p = write_decimal(p, r, r_length, powers, level, low_width);
+
+    free(q);
+    free(r);
+    return p;
+}
+
+
+/*
+ * Returns the digits of the magnitude as a string, which the caller
+ * frees, or NULL if there is no memory.
+ */
+char *bignum_to_decimal(const limb_t *a, unsigned int length)
+{
+    static limb_t base = DECIMAL_BASE;
+    struct decimal_powers powers;
+    limb_t *square;
+    unsigned int last;
+    char *result, *end;
+
+    length = bignum_normalize(a, length);
+
+    /*
+     * Powers up to the first one whose square is longer than A.
+     * Level N of the recursion works on numbers less than the
+     * square of power N - 1. With fewer powers, the splits are
+     * uneven, but still exact.
+     */
+    powers.powers[0] = &base;
+    powers.lengths[0] = 1;
+    powers.count = 1;
+
+    while (2 * powers.lengths[powers.count - 1] - 1 <= length
+           && powers.count < DECIMAL_MAX_LEVELS) {
+        last = powers.count - 1;
+        square = malloc(2 * powers.lengths[last] * sizeof(limb_t));
+        if (square == NULL) break;
+        powers.lengths[powers.count] =
+            bignum_multiply(square, powers.powers[last], powers.lengths[last],
+                            powers.powers[last], powers.lengths[last]);
+        powers.powers[powers.count++] = square;
+    }
+
+    // Ten digits for every 32 bits are plenty
+    result = malloc((size_t) length * 10 + 2);
+    end = (result != NULL) ? write_decimal(result, a, length, &powers, powers.count, 0) : NULL;
+    if (end != NULL) {
+        if (end == result) *(end++) = '0';
+        *end = '\0';
+    } else {
+        free(result);
+        result = NULL;
+    }
+
+    for (last = 1; last < powers.count; last++) {
+        free(powers.powers[last]);
+    }
+
+    return result;
+}
+
+
+/*
+ * Stores the magnitude of the COUNT decimal digits in RESULT and
+ * returns its length. Room: COUNT / 9 + 1.
+ */
+unsigned int bignum_from_decimal(limb_t *result, const char *digits, size_t count)
+{
+    unsigned int length, i;
+    uint64_t carry;
+    limb_t chunk, scale;
+    size_t position, width;
+
+    length = 0;
+    position = 0;
+    while (position < count) {
+        // The first chunk takes the odd digits
+        width = (position == 0 && count % DECIMAL_DIGITS != 0) ?
+            count % DECIMAL_DIGITS : DECIMAL_DIGITS;
+        chunk = 0;
+        scale = 1;
+        for (; width > 0; width--, position++) {
+            chunk = 10 * chunk + (digits[position] - '0');
+            scale *= 10;
+        }
+
+        carry = chunk;
+        for (i = 0; i < length; i++) {
+            carry += (uint64_t) result[i] * scale;
+            result[i] = (limb_t) carry;
+            carry >>= LIMB_BITS;
+        }
+        if (carry != 0) result[length++] = (limb_t) carry;
+    }
+
+    return length;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#ifndef BIGNUM_H_
+#define BIGNUM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+ * Magnitudes of arbitrary-precision integers
+ *
+ * A magnitude is an array of 32 bit limbs, least significant limb
+ * first. The functions below return the length of their result
+ * without leading zero limbs; the caller provides room for the
+ * longest possible result.
+ */
+
+typedef uint32_t limb_t;
+
+#define LIMB_BITS 32
+
+// Shorter operands are multiplied the schoolbook way
+#define KARATSUBA_THRESHOLD 32
+
+
+unsigned int bignum_normalize(const limb_t*, unsigned int);
+int bignum_compare(const limb_t*, unsigned int, const limb_t*, unsigned int);
+
+// Room: the longer length + 1
+unsigned int bignum_add(limb_t*, const limb_t*, unsigned int, const limb_t*, unsigned int);
+
+// The first operand must not be smaller. Room: its length
+unsigned int bignum_subtract(limb_t*, const limb_t*, unsigned int, const limb_t*, unsigned int);
+
+// Room: the sum of the lengths
+unsigned int bignum_multiply(limb_t*, const limb_t*, unsigned int, const limb_t*, unsigned int);
+
+// The divisor must not be zero. Room: the dividend's length + 1 for
+// the quotient, the divisor's length for the remainder
+unsigned int bignum_divide(limb_t*, limb_t*, unsigned int*,
+                           const limb_t*, unsigned int, const limb_t*, unsigned int);
+
+char *bignum_to_decimal(const limb_t*, unsigned int);
+unsigned int bignum_from_decimal(limb_t*, const char*, size_t);
+
+
+#endif
@@ -0,0 +1,1429 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "baby_io.h"
+#include "bytecode.h"
+#include "bytecode_file.h"
+#include "bytevector.h"
+#include "closure.h"
+#include "environment.h"
+#include "number.h"
+#include "pair.h"
+#include "parallel_reader.h"
+#include "primitive.h"
+#include "string_object.h"
+#include "symbol.h"
+#include "typed_vector.h"
+#include "vector.h"
+
+#include "builtins.h"
+
+
+
+objptr_t GLOBAL_ENVIRONMENT;
+
+
+static objptr_t boolean(bool value)
+{
+    return value ? NIL_TRUE : NIL_FALSE;
+}
+
+
+
+/*
+ * Errors
+ *
+ * There are no conditions yet: a builtin reports an error on the
+ * standard error and returns the empty list. Calls of primitives with
+ * the wrong number of arguments are reported the same way.
+ */
+
+
+objptr_t builtin_error(const char *name, const char *message)
+{
+    fprintf(stderr, "Error in %s: %s\n", name, message);
+    return EMPTY_LIST;
+}
+
+
+/*
+ * Gets argument INDEX as an int, or FALLBACK if it wasn't given.
+ * Reports an error if it isn't a number in the range of an int.
+ */
+static bool int_argument(const char *name, objptr_t *args, unsigned int argc,
+                         unsigned int index, int fallback, int *result)
+{
+    if (index >= argc) {
+        *result = fallback;
+        return true;
+    }
+    if (number_get_int(args[index], result)) return true;
+
+    builtin_error(name, "expected a number in the range of an int");
+    return false;
+}
+
+
+/*
+ * Like int_argument(), for counts and indices, which can't be
+ * negative.
+ */
+static bool count_argument(const char *name, objptr_t *args, unsigned int argc,
+                           unsigned int index, unsigned int fallback,
+                           unsigned int *result)
+{
+    int value;
+
+    if (index >= argc) {
+        *result = fallback;
+        return true;
+    }
+    if (!int_argument(name, args, argc, index, 0, &value)) return false;
+    if (value >= 0) {
+        *result = (unsigned int) value;
+        return true;
+    }
+
+    builtin_error(name, "expected a non-negative number");
+    return false;
+}
+
+
+/*
+ * Like count_argument(), for offsets into bytevectors, which may be
+ * larger than an int
+ */
+static bool offset_argument(const char *name, objptr_t *args, unsigned int argc,
+                            unsigned int index, size_t fallback, size_t *result)
+{
+    struct number buffer;
+    struct number *number;
+    long long value;
+
+    if (index >= argc) {
+        *result = fallback;
+        return true;
+    }
+    if (is_of_type(args[index], &TYPE_NUMBER)) {
+        number = number_view(args[index], &buffer);
+        value = number_to_long_long(args[index]);
+        // Longer bignums would wrap around
+        if (value >= 0 &&
+            (number->type != NUMBER_BIGNUM || number->value.bignum.length <= 2)) {
+            *result = (size_t) value;
+            return true;
+        }
+    }
+
+    builtin_error(name, "expected a non-negative number");
+    return false;
+}
+
+
+static bool byte_argument(const char *name, objptr_t *args, unsigned int argc,
+                          unsigned int index, unsigned char *result)
+{
+    int value;
+
+    if (!int_argument(name, args, argc, index, 0, &value)) return false;
+    if (value >= 0 && value <= 255) {
+        *result = (unsigned char) value;
+        return true;
+    }
+
+    builtin_error(name, "expected a byte from 0 to 255");
+    return false;
+}
+
+
+
+/*
+ * Pairs and lists
+ */
+
+
+static objptr_t builtin_car(objptr_t *args, unsigned int argc)
+{
+    return get_car(args[0]);
+}
+
+
+static objptr_t builtin_cdr(objptr_t *args, unsigned int argc)
+{
+    return get_cdr(args[0]);
+}
+
+
+static objptr_t builtin_cons(objptr_t *args, unsigned int argc)
+{
+    return cons(args[0], args[1]);
+}
+
+
+static objptr_t builtin_set_car(objptr_t *args, unsigned int argc)
+{
+    set_car(args[0], args[1]);
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_set_cdr(objptr_t *args, unsigned int argc)
+{
+    set_cdr(args[0], args[1]);
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_list(objptr_t *args, unsigned int argc)
+{
+    objptr_t list;
+    unsigned int i;
+
+    list = EMPTY_LIST;
+    for (i = argc; i > 0; i--)
+    {
+        list = cons(args[i - 1], list);
+    }
+
+    return list;
+}
+
+
+
+/*
+ * Predicates
+ */
+
+
+static objptr_t builtin_pair_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_of_type(args[0], &TYPE_PAIR));
+}
+
+
+static objptr_t builtin_null_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(args[0] == EMPTY_LIST);
+}
+
+
+static objptr_t builtin_symbol_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_of_type(args[0], &TYPE_SYMBOL));
+}
+
+
+static objptr_t builtin_number_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_of_type(args[0], &TYPE_NUMBER));
+}
+
+
+static objptr_t builtin_vector_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_of_type(args[0], &TYPE_VECTOR));
+}
+
+
+static objptr_t builtin_string_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_of_type(args[0], &TYPE_STRING));
+}
+
+
+static objptr_t builtin_procedure_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_of_type(args[0], &TYPE_CLOSURE)
+                   || is_of_type(args[0], &TYPE_PRIMITIVE));
+}
+
+
+static objptr_t builtin_not(objptr_t *args, unsigned int argc)
+{
+    return boolean(args[0] == NIL_FALSE);
+}
+
+
+static objptr_t builtin_eq_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(eqv(args[0], args[1], EQ_STRICT));
+}
+
+
+static objptr_t builtin_eqv_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(eqv(args[0], args[1], EQV_STRICT));
+}
+
+
+static objptr_t builtin_equal_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(eqv(args[0], args[1], EQUAL_STRICT));
+}
+
+
+
+/*
+ * Arithmetic
+ */
+
+
+static objptr_t fold_numbers(objptr_t *args,
+                             unsigned int argc,
+                             objptr_t (*operation)(objptr_t, objptr_t))
+{
+    unsigned int i;
+    objptr_t accumulator;
+    objptr_t result;
+
+    accumulator = args[0];
+    for (i = 1; i < argc; i++)
+    {
+        result = operation(accumulator, args[i]);
+        if (i > 1) {
+            // Intermediate results are not referenced by anyone else
+            decrease_refcount(accumulator);
+        }
+        accumulator = result;
+    }
+
+    return accumulator;
+}
+
+
+static objptr_t builtin_add(objptr_t *args, unsigned int argc)
+{
+    if (argc == 0) {
+        return make_integer(0);
+    } else {
+        return fold_numbers(args, argc, number_add);
+    }
+}
+
+
+static objptr_t builtin_multiply(objptr_t *args, unsigned int argc)
+{
+    if (argc == 0) {
+        return make_integer(1);
+    } else {
+        return fold_numbers(args, argc, number_multiply);
+    }
+}
+
+
+static objptr_t builtin_subtract(objptr_t *args, unsigned int argc)
+{
+    objptr_t zero;
+    objptr_t result;
+
+    if (argc == 1) {
+        zero = make_integer(0);
+        result = number_subtract(zero, args[0]);
+        decrease_refcount(zero);
+        return result;
+    } else {
+        return fold_numbers(args, argc, number_subtract);
+    }
+}
+
+
+static objptr_t builtin_divide(objptr_t *args, unsigned int argc)
+{
+    objptr_t one;
+    objptr_t result;
+
+    if (argc == 1) {
+        one = make_integer(1);
+        result = number_divide(one, args[0]);
+        decrease_refcount(one);
+        return result;
+    } else {
+        return fold_numbers(args, argc, number_divide);
+    }
+}
+
+
+static objptr_t builtin_quotient(objptr_t *args, unsigned int argc)
+{
+    return number_quotient(args[0], args[1]);
+}
+
+
+static objptr_t builtin_remainder(objptr_t *args, unsigned int argc)
+{
+    return number_remainder(args[0], args[1]);
+}
+
+
+static objptr_t compare_numbers(const char *name, objptr_t *args,
+                                unsigned int argc,
+                                bool less, bool equal, bool greater)
+{
+    unsigned int i;
+    int order;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (!is_of_type(args[i], &TYPE_NUMBER)) {
+            return builtin_error(name, "expected numbers");
+        }
+    }
+
+    for (i = 1; i < argc; i++)
+    {
+        // NaN is unordered, so none of the comparisons hold
+        if (!number_compare(args[i - 1], args[i], &order)) return NIL_FALSE;
+        if (!((order < 0 && less)
+              || (order == 0 && equal)
+              || (order > 0 && greater))) {
+            return NIL_FALSE;
+        }
+    }
+
+    return NIL_TRUE;
+}
+
+
+static objptr_t builtin_less(objptr_t *args, unsigned int argc)
+{
+    return compare_numbers("<", args, argc, true, false, false);
+}
+
+
+static objptr_t builtin_less_equal(objptr_t *args, unsigned int argc)
+{
+    return compare_numbers("<=", args, argc, true, true, false);
+}
+
+
+static objptr_t builtin_number_equal(objptr_t *args, unsigned int argc)
+{
+    return compare_numbers("=", args, argc, false, true, false);
+}
+
+
+static objptr_t builtin_greater(objptr_t *args, unsigned int argc)
+{
+    return compare_numbers(">", args, argc, false, false, true);
+}
+
+
+static objptr_t builtin_greater_equal(objptr_t *args, unsigned int argc)
+{
+    return compare_numbers(">=", args, argc, false, true, true);
+}
+
+
+
+/*
+ * Vectors
+ */
+
+
+static objptr_t builtin_make_vector(objptr_t *args, unsigned int argc)
+{
+    objptr_t vector;
+    unsigned int size;
+
+    if (!count_argument("make-vector", args, argc, 0, 0, &size)) return EMPTY_LIST;
+
+    vector = make_vector((argc > 1) ? args[1] : EMPTY_LIST, size);
+    if (vector == EMPTY_LIST) return builtin_error("make-vector", "out of memory");
+    return vector;
+}
+
+
+static objptr_t builtin_vector(objptr_t *args, unsigned int argc)
+{
+    objptr_t vector;
+    unsigned int i;
+
+    vector = make_vector(EMPTY_LIST, 0);
+    for (i = 0; i < argc; i++)
+    {
+        vector_append(vector, args[i]);
+    }
+
+    return vector;
+}
+
+
+static objptr_t builtin_vector_length(objptr_t *args, unsigned int argc)
+{
+    return make_integer(vector_length(args[0]));
+}
+
+
+static objptr_t builtin_vector_ref(objptr_t *args, unsigned int argc)
+{
+    unsigned int index;
+
+    if (!count_argument("vector-ref", args, argc, 1, 0, &index)) return EMPTY_LIST;
+    return vector_get(args[0], index);
+}
+
+
+static objptr_t builtin_vector_set(objptr_t *args, unsigned int argc)
+{
+    unsigned int index;
+
+    if (!count_argument("vector-set!", args, argc, 1, 0, &index)) return EMPTY_LIST;
+    if (!vector_reserve(args[0], index + 1)) {
+        return builtin_error("vector-set!", "out of memory");
+    }
+    vector_set(args[0], index, args[2]);
+    return EMPTY_LIST;
+}
+
+
+
+// (vector-copy vector [start [end]])
+static objptr_t builtin_vector_copy(objptr_t *args, unsigned int argc)
+{
+    unsigned int start, end;
+
+    if (!count_argument("vector-copy", args, argc, 1, 0, &start) ||
+        !count_argument("vector-copy", args, argc, 2, vector_length(args[0]), &end)) {
+        return EMPTY_LIST;
+    }
+    return subvector(args[0], start, end);
+}
+
+
+// (vector-copy! to at from [start [end]])
+static objptr_t builtin_vector_copy_x(objptr_t *args, unsigned int argc)
+{
+    unsigned int at, start, end;
+
+    if (!count_argument("vector-copy!", args, argc, 1, 0, &at) ||
+        !count_argument("vector-copy!", args, argc, 3, 0, &start) ||
+        !count_argument("vector-copy!", args, argc, 4, vector_length(args[2]), &end)) {
+        return EMPTY_LIST;
+    }
+    // Unlike vector_copy_range(), the target doesn't grow
+    if (start > end || end > vector_length(args[2])) {
+        return builtin_error("vector-copy!", "invalid source range");
+    }
+    if (at > vector_length(args[0]) || end - start > vector_length(args[0]) - at) {
+        return builtin_error("vector-copy!", "the range doesn't fit into the target");
+    }
+    vector_copy_range(args[0], at, args[2], start, end);
+    return EMPTY_LIST;
+}
+
+
+// (vector-fill! vector fill [start [end]])
+static objptr_t builtin_vector_fill(objptr_t *args, unsigned int argc)
+{
+    unsigned int start, end;
+
+    if (!count_argument("vector-fill!", args, argc, 2, 0, &start) ||
+        !count_argument("vector-fill!", args, argc, 3, vector_length(args[0]), &end)) {
+        return EMPTY_LIST;
+    }
+    if (!vector_reserve(args[0], end)) return builtin_error("vector-fill!", "out of memory");
+    vector_fill(args[0], args[1], start, end);
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_subvector(objptr_t *args, unsigned int argc)
+{
+    unsigned int start, end;
+
+    if (!count_argument("subvector", args, argc, 1, 0, &start) ||
+        !count_argument("subvector", args, argc, 2, 0, &end)) {
+        return EMPTY_LIST;
+    }
+    return subvector(args[0], start, end);
+}
+
+
+// (vector-grow vector k) => a copy with room for K members
+static objptr_t builtin_vector_grow(objptr_t *args, unsigned int argc)
+{
+    objptr_t copy;
+    unsigned int size;
+
+    if (!count_argument("vector-grow", args, argc, 1, 0, &size)) return EMPTY_LIST;
+
+    copy = vector_copy(args[0]);
+    if (!vector_reserve(copy, size)) {
+        // Frees the fresh copy
+        increase_refcount(copy);
+        decrease_refcount(copy);
+        return builtin_error("vector-grow", "out of memory");
+    }
+    vector_fill(copy, EMPTY_LIST, vector_length(copy), size);
+    return copy;
+}
+
+
+
+/*
+ * Homogeneous numeric vectors (SRFI 4)
+ *
+ * Only making a vector depends on its element type; the other
+ * operations take the type from the vector.
+ */
+
+
+static objptr_t typed_vector_from_objects(const char *name,
+                                          enum typed_vector_type type,
+                                          objptr_t *args, unsigned int argc)
+{
+    objptr_t vector;
+    unsigned int i;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (!typed_vector_accepts(type, args[i])) {
+            return builtin_error(name, "expected a number in the range of the element type");
+        }
+    }
+
+    vector = make_typed_vector(type, argc, EMPTY_LIST);
+    if (vector == EMPTY_LIST) return builtin_error(name, "out of memory");
+    for (i = 0; i < argc; i++)
+    {
+        typed_vector_set(vector, i, args[i]);
+    }
+
+    return vector;
+}
+
+
+static objptr_t list_to_typed_vector(const char *name,
+                                     enum typed_vector_type type, objptr_t list)
+{
+    objptr_t vector, pair;
+    unsigned int i, length;
+
+    length = 0;
+    for (pair = list; is_of_type(pair, &TYPE_PAIR); pair = get_cdr(pair)) {
+        if (!typed_vector_accepts(type, get_car(pair))) {
+            return builtin_error(name, "expected a number in the range of the element type");
+        }
+        length++;
+    }
+
+    vector = make_typed_vector(type, length, EMPTY_LIST);
+    if (vector == EMPTY_LIST) return builtin_error(name, "out of memory");
+    for (i = 0, pair = list; i < length; i++, pair = get_cdr(pair))
+    {
+        typed_vector_set(vector, i, get_car(pair));
+    }
+
+    return vector;
+}
+
+
+#define TYPED_VECTOR_BUILTINS(TAG, TYPE)                                        \
+static objptr_t builtin_make_##TAG##vector(objptr_t *args, unsigned int argc)  \
+{                                                                               \
+    objptr_t vector;                                                            \
+    unsigned int size;                                                          \
+                                                                                \
+    if (!count_argument("make-" #TAG "vector", args, argc, 0, 0, &size)) {      \
+        return EMPTY_LIST;                                                      \
+    }                                                                           \
+    if (argc > 1 && !typed_vector_accepts(TYPE, args[1])) {                     \
+        return builtin_error("make-" #TAG "vector",                             \
+                             "expected a number in the range of the element type");           \
+    }                                                                           \
+                                                                                \
+    vector = make_typed_vector(TYPE, size, (argc > 1) ? args[1] : EMPTY_LIST);  \
+    if (vector == EMPTY_LIST) {                                                 \
+        return builtin_error("make-" #TAG "vector", "out of memory");           \
+    }                                                                           \
+    return vector;                                                              \
+}                                                                               \
+                                                                                \
+static objptr_t builtin_##TAG##vector(objptr_t *args, unsigned int argc)       \
+{                                                                               \
+    return typed_vector_from_objects(#TAG "vector", TYPE, args, argc);          \
+}                                                                               \
+                                                                                \
+static objptr_t builtin_##TAG##vector_p(objptr_t *args, unsigned int argc)     \
+{                                                                               \
+    return boolean(is_typed_vector(args[0], TYPE));                             \
+}                                                                               \
+                                                                                \
+static objptr_t builtin_list_to_##TAG##vector(objptr_t *args, unsigned int argc) \
+{                                                                               \
+    return list_to_typed_vector("list->" #TAG "vector", TYPE, args[0]);         \
+}
+
+TYPED_VECTOR_BUILTINS(u8, TYPED_VECTOR_U8)
+TYPED_VECTOR_BUILTINS(s8, TYPED_VECTOR_S8)
+TYPED_VECTOR_BUILTINS(u16, TYPED_VECTOR_U16)
+TYPED_VECTOR_BUILTINS(s16, TYPED_VECTOR_S16)
+TYPED_VECTOR_BUILTINS(u32, TYPED_VECTOR_U32)
+TYPED_VECTOR_BUILTINS(s32, TYPED_VECTOR_S32)
+TYPED_VECTOR_BUILTINS(u64, TYPED_VECTOR_U64)
+TYPED_VECTOR_BUILTINS(s64, TYPED_VECTOR_S64)
+TYPED_VECTOR_BUILTINS(f32, TYPED_VECTOR_F32)
+TYPED_VECTOR_BUILTINS(f64, TYPED_VECTOR_F64)
+
+
+static objptr_t builtin_typed_vector_length(objptr_t *args, unsigned int argc)
+{
+    return make_integer(typed_vector_length(args[0]));
+}
+
+
+static objptr_t builtin_typed_vector_ref(objptr_t *args, unsigned int argc)
+{
+    unsigned int index;
+
+    if (!count_argument("typed-vector-ref", args, argc, 1, 0, &index)) return EMPTY_LIST;
+    return typed_vector_ref(args[0], index);
+}
+
+
+static objptr_t builtin_typed_vector_set(objptr_t *args, unsigned int argc)
+{
+    unsigned int index;
+
+    if (!count_argument("typed-vector-set!", args, argc, 1, 0, &index)) return EMPTY_LIST;
+    if (index >= typed_vector_length(args[0])) {
+        return builtin_error("typed-vector-set!", "index out of range");
+    }
+    if (!typed_vector_set(args[0], index, args[2])) {
+        return builtin_error("typed-vector-set!", "expected a number in the range of the element type");
+    }
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_typed_vector_to_list(objptr_t *args, unsigned int argc)
+{
+    objptr_t list;
+    unsigned int i;
+
+    list = EMPTY_LIST;
+    for (i = typed_vector_length(args[0]); i > 0; i--)
+    {
+        list = cons(typed_vector_ref(args[0], i - 1), list);
+    }
+
+    return list;
+}
+
+
+// Reports an error for a missing RESULT, which is returned otherwise
+static objptr_t typed_vector_result(const char *name, objptr_t result, const char *message)
+{
+    return (result == EMPTY_LIST) ? builtin_error(name, message) : result;
+}
+
+
+static objptr_t builtin_typed_vector_sum(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_result("typed-vector-sum", typed_vector_sum(args[0]),
+                               "expected a homogeneous vector");
+}
+
+
+static objptr_t builtin_typed_vector_dot(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_result("typed-vector-dot", typed_vector_dot(args[0], args[1]),
+                               "expected two vectors of the same type and length");
+}
+
+
+static objptr_t builtin_typed_vector_min(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_result("typed-vector-min", typed_vector_min(args[0]),
+                               "expected a non-empty homogeneous vector");
+}
+
+
+static objptr_t builtin_typed_vector_max(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_result("typed-vector-max", typed_vector_max(args[0]),
+                               "expected a non-empty homogeneous vector");
+}
+
+
+static objptr_t typed_vector_operation(const char *name,
+                                       enum typed_vector_operation operation,
+                                       objptr_t *args)
+{
+    objptr_t result;
+
+    result = typed_vector_arithmetic(operation, args[0], args[1]);
+    if (result == EMPTY_LIST) {
+        return builtin_error(name, "expected a vector and a vector of the same type"
+                             " and length or a number in the range of the type");
+    }
+    return result;
+}
+
+
+static objptr_t builtin_typed_vector_add(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_operation("typed-vector-add", TYPED_VECTOR_ADD, args);
+}
+
+
+static objptr_t builtin_typed_vector_subtract(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_operation("typed-vector-subtract", TYPED_VECTOR_SUBTRACT, args);
+}
+
+
+static objptr_t builtin_typed_vector_multiply(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_operation("typed-vector-multiply", TYPED_VECTOR_MULTIPLY, args);
+}
+
+
+static objptr_t builtin_typed_vector_divide(objptr_t *args, unsigned int argc)
+{
+    return typed_vector_operation("typed-vector-divide", TYPED_VECTOR_DIVIDE, args);
+}
+
+
+
+/*
+ * Strings
+ */
+
+
+static objptr_t builtin_string_length(objptr_t *args, unsigned int argc)
+{
+    return make_integer(string_length(args[0]));
+}
+
+
+static objptr_t compare_strings(objptr_t *args,
+                                unsigned int argc,
+                                bool less, bool equal, bool greater)
+{
+    unsigned int i;
+    int order;
+
+    for (i = 1; i < argc; i++)
+    {
+        order = string_compare(args[i - 1], args[i]);
+        if (!((order < 0 && less)
+              || (order == 0 && equal)
+              || (order > 0 && greater))) {
+            return NIL_FALSE;
+        }
+    }
+
+    return NIL_TRUE;
+}
+
+
+static objptr_t builtin_string_equal(objptr_t *args, unsigned int argc)
+{
+    return compare_strings(args, argc, false, true, false);
+}
+
+
+static objptr_t builtin_string_less(objptr_t *args, unsigned int argc)
+{
+    return compare_strings(args, argc, true, false, false);
+}
+
+
+static objptr_t builtin_string_greater(objptr_t *args, unsigned int argc)
+{
+    return compare_strings(args, argc, false, false, true);
+}
+
+
+// (string-search pattern string [start]) => index or #f
+static objptr_t builtin_string_search(objptr_t *args, unsigned int argc)
+{
+    long index;
+    int start;
+
+    if (!int_argument("string-search", args, argc, 2, 0, &start)) return EMPTY_LIST;
+    index = string_search(args[1], args[0], start);
+    return (index < 0) ? NIL_FALSE : make_integer(index);
+}
+
+
+static objptr_t builtin_string_append(objptr_t *args, unsigned int argc)
+{
+    objptr_t result;
+    unsigned int i;
+
+    if (argc == 0) return make_string('\0', 0);
+
+    result = args[0];
+    for (i = 1; i < argc; i++)
+    {
+        result = string_concatenate(result, args[i]);
+    }
+
+    return (argc == 1) ? string_copy(result) : result;
+}
+
+
+static objptr_t builtin_substring(objptr_t *args, unsigned int argc)
+{
+    int start, end;
+
+    if (!int_argument("substring", args, argc, 1, 0, &start) ||
+        !int_argument("substring", args, argc, 2, string_length(args[0]), &end)) {
+        return EMPTY_LIST;
+    }
+    return substring(args[0], start, end);
+}
+
+
+static objptr_t builtin_make_string_builder(objptr_t *args, unsigned int argc)
+{
+    return make_string_builder();
+}
+
+
+// (string-builder-append! builder string-or-character [start end])
+static objptr_t builtin_string_builder_append(objptr_t *args, unsigned int argc)
+{
+    int start, end;
+
+    if (!is_of_type(args[0], &TYPE_STRING_BUILDER)) {
+        return builtin_error("string-builder-append!", "expected a string builder");
+    } else if (is_of_type(args[1], &TYPE_CHARACTER)) {
+        if (!string_builder_append(args[0], character_value(args[1]))) {
+            return builtin_error("string-builder-append!", "out of memory");
+        }
+    } else if (!is_of_type(args[1], &TYPE_STRING)) {
+        return builtin_error("string-builder-append!", "expected a string or a character");
+    } else if (int_argument("string-builder-append!", args, argc, 2, 0, &start) &&
+               int_argument("string-builder-append!", args, argc, 3,
+                            string_length(args[1]), &end) &&
+               !string_builder_append_substring(args[0], args[1], start, end)) {
+        return builtin_error("string-builder-append!", "out of memory");
+    }
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_string_builder_length(objptr_t *args, unsigned int argc)
+{
+    return make_integer(string_builder_length(args[0]));
+}
+
+
+static objptr_t builtin_string_builder_result(objptr_t *args, unsigned int argc)
+{
+    return string_builder_finish(args[0]);
+}
+
+
+static objptr_t builtin_symbol_to_string(objptr_t *args, unsigned int argc)
+{
+    return string_copy(symbol_to_string(args[0]));
+}
+
+
+static objptr_t builtin_string_to_symbol(objptr_t *args, unsigned int argc)
+{
+    return is_of_type(args[0], &TYPE_STRING) ? string_to_symbol(args[0]) : EMPTY_LIST;
+}
+
+
+
+/*
+ * Bytevectors and binary files
+ *
+ * Files are file descriptors. The byte ranges of the bytevector
+ * procedures are [start end) and default to the whole bytevector.
+ */
+
+
+static objptr_t builtin_bytevector_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(is_bytevector(args[0]));
+}
+
+
+static objptr_t builtin_make_bytevector(objptr_t *args, unsigned int argc)
+{
+    objptr_t vector;
+    unsigned int length;
+    unsigned char fill;
+
+    if (!count_argument("make-bytevector", args, argc, 0, 0, &length) ||
+        !byte_argument("make-bytevector", args, argc, 1, &fill)) {
+        return EMPTY_LIST;
+    }
+
+    vector = make_bytevector(length, fill);
+    if (vector == EMPTY_LIST) return builtin_error("make-bytevector", "out of memory");
+    return vector;
+}
+
+
+static objptr_t builtin_bytevector(objptr_t *args, unsigned int argc)
+{
+    objptr_t vector;
+    unsigned char byte;
+    unsigned int i;
+
+    for (i = 0; i < argc; i++)
+    {
+        if (!byte_argument("bytevector", args, argc, i, &byte)) return EMPTY_LIST;
+    }
+
+    vector = make_bytevector(argc, 0);
+    if (vector == EMPTY_LIST) return builtin_error("bytevector", "out of memory");
+    for (i = 0; i < argc; i++)
+    {
+        byte_argument("bytevector", args, argc, i, &byte);
+        bytevector_set(vector, i, byte);
+    }
+
+    return vector;
+}
+
+
+static objptr_t builtin_bytevector_length(objptr_t *args, unsigned int argc)
+{
+    return make_integer_from_long_long(bytevector_length(args[0]));
+}
+
+
+static objptr_t builtin_bytevector_u8_ref(objptr_t *args, unsigned int argc)
+{
+    size_t index;
+    int byte;
+
+    if (!offset_argument("bytevector-u8-ref", args, argc, 1, 0, &index)) return EMPTY_LIST;
+
+    byte = bytevector_ref(args[0], index);
+    if (byte < 0) return builtin_error("bytevector-u8-ref", "index out of range");
+    return make_integer(byte);
+}
+
+
+static objptr_t builtin_bytevector_u8_set(objptr_t *args, unsigned int argc)
+{
+    size_t index;
+    unsigned char byte;
+
+    if (!offset_argument("bytevector-u8-set!", args, argc, 1, 0, &index) ||
+        !byte_argument("bytevector-u8-set!", args, argc, 2, &byte)) {
+        return EMPTY_LIST;
+    }
+
+    if (bytevector_is_read_only(args[0])) {
+        return builtin_error("bytevector-u8-set!", "the bytevector is read-only");
+    }
+    if (!bytevector_set(args[0], index, byte)) {
+        return builtin_error("bytevector-u8-set!", "index out of range");
+    }
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_bytevector_read_only_p(objptr_t *args, unsigned int argc)
+{
+    return boolean(bytevector_is_read_only(args[0]));
+}
+
+
+static size_t range_end(objptr_t *args, unsigned int argc,
+                        unsigned int index, objptr_t vector)
+{
+    return (argc > index) ? number_to_long_long(args[index]) : bytevector_length(vector);
+}
+
+
+// (bytevector-copy bytevector [start end])
+static objptr_t builtin_bytevector_copy(objptr_t *args, unsigned int argc)
+{
+    return bytevector_copy(args[0],
+                           (argc > 1) ? number_to_long_long(args[1]) : 0,
+                           range_end(args, argc, 2, args[0]));
+}
+
+
+// (bytevector-slice bytevector start [end]) shares the storage
+static objptr_t builtin_bytevector_slice(objptr_t *args, unsigned int argc)
+{
+    return bytevector_slice(args[0], number_to_long_long(args[1]),
+                            range_end(args, argc, 2, args[0]));
+}
+
+
+// (bytevector-copy! to at from [start end])
+static objptr_t builtin_bytevector_copy_to(objptr_t *args, unsigned int argc)
+{
+    bytevector_copy_range(args[0], number_to_long_long(args[1]), args[2],
+                          (argc > 3) ? number_to_long_long(args[3]) : 0,
+                          range_end(args, argc, 4, args[2]));
+    return EMPTY_LIST;
+}
+
+
+/*
+ * Returns the name of a string or symbol as a malloc()ed C string,
+ * or NULL for other objects.
+ */
+static char *name_to_c_string(objptr_t path)
+{
+    if (is_of_type(path, &TYPE_SYMBOL)) path = symbol_to_string(path);
+    if (!is_of_type(path, &TYPE_STRING)) return NULL;
+
+    return string_to_c_string(path);
+}
+
+
+static objptr_t transfer_result(ssize_t count)
+{
+    return (count < 0) ? NIL_FALSE : make_integer_from_long_long(count);
+}
+
+
+// (file-open path [mode]) => descriptor or #f, where the mode is one
+// of the symbols read (the default), write, append and read-write
+static objptr_t builtin_file_open(objptr_t *args, unsigned int argc)
+{
+    char *mode, *path;
+    int flags, fd;
+
+    mode = name_to_c_string((argc > 1) ? args[1] : EMPTY_LIST);
+    if (mode == NULL || strcmp(mode, "read") == 0) {
+        flags = O_RDONLY;
+    } else if (strcmp(mode, "write") == 0) {
+        flags = O_WRONLY | O_CREAT | O_TRUNC;
+    } else if (strcmp(mode, "append") == 0) {
+        flags = O_WRONLY | O_CREAT | O_APPEND;
+    } else if (strcmp(mode, "read-write") == 0) {
+        flags = O_RDWR | O_CREAT;
+    } else {
+        flags = -1;
+    }
+    free(mode);
+
+    path = name_to_c_string(args[0]);
+    if (flags < 0 || path == NULL) {
+        free(path);
+        return NIL_FALSE;
+    }
+    fd = open(path, flags, 0666);
+    free(path);
+
+    return (fd < 0) ? NIL_FALSE : make_integer(fd);
+}
+
+
+static objptr_t builtin_file_close(objptr_t *args, unsigned int argc)
+{
+    return boolean(close(number_to_int(args[0])) == 0);
+}
+
+
+static objptr_t builtin_file_size(objptr_t *args, unsigned int argc)
+{
+    struct stat info;
+
+    if (fstat(number_to_int(args[0]), &info) != 0) return NIL_FALSE;
+    return make_integer_from_long_long(info.st_size);
+}
+
+
+// (file-read! fd bytevector [start end]) => count, 0 at the end
+static objptr_t builtin_file_read(objptr_t *args, unsigned int argc)
+{
+    return transfer_result(bytevector_read(number_to_int(args[0]), args[1],
+                                           (argc > 2) ? number_to_long_long(args[2]) : 0,
+                                           range_end(args, argc, 3, args[1])));
+}
+
+
+// (file-pread! fd bytevector offset [start end]) => count
+static objptr_t builtin_file_pread(objptr_t *args, unsigned int argc)
+{
+    return transfer_result(bytevector_pread(number_to_int(args[0]), args[1],
+                                            number_to_long_long(args[2]),
+                                            (argc > 3) ? number_to_long_long(args[3]) : 0,
+                                            range_end(args, argc, 4, args[1])));
+}
+
+
+// (file-write fd bytevector [start end]) => count
+static objptr_t builtin_file_write(objptr_t *args, unsigned int argc)
+{
+    return transfer_result(bytevector_write(number_to_int(args[0]), args[1],
+                                            (argc > 2) ? number_to_long_long(args[2]) : 0,
+                                            range_end(args, argc, 3, args[1])));
+}
+
+
+// (file-map path) => read-only bytevector or #f
+static objptr_t builtin_file_map(objptr_t *args, unsigned int argc)
+{
+    objptr_t vector;
+    char *path;
+
+    path = name_to_c_string(args[0]);
+    if (path == NULL) return NIL_FALSE;
+    vector = map_file_bytevector(path);
+    free(path);
+
+    return (vector == EMPTY_LIST) ? NIL_FALSE : vector;
+}
+
+
+// (read-file-parallel path [threads]) => vector of the forms or #f
+static objptr_t builtin_read_file_parallel(objptr_t *args, unsigned int argc)
+{
+    objptr_t forms;
+    long threads;
+    char *path;
+    bool fail;
+
+    threads = (argc > 1) ? number_to_int(args[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+    if (threads < 1) threads = 1;
+
+    path = name_to_c_string(args[0]);
+    if (path == NULL) return NIL_FALSE;
+    forms = read_file_parallel(path, threads, &fail);
+    free(path);
+
+    return fail ? NIL_FALSE : forms;
+}
+
+
+// (fasl-write datum fd) => #t or #f
+static objptr_t builtin_fasl_write(objptr_t *args, unsigned int argc)
+{
+    return boolean(write_fasl(number_to_int(args[1]), args[0]));
+}
+
+
+// (fasl-read fd [default]) => datum, or the default (#f) at the end
+// of the input and for unusable data
+static objptr_t builtin_fasl_read(objptr_t *args, unsigned int argc)
+{
+    objptr_t datum;
+    bool fail;
+
+    datum = read_fasl(number_to_int(args[0]), &fail);
+    if (fail) return (argc > 1) ? args[1] : NIL_FALSE;
+
+    // The datum is handed over like a fresh object
+    decrease_refcount_keep(datum);
+    return datum;
+}
+
+
+
+/*
+ * Output
+ */
+
+
+static objptr_t builtin_display(objptr_t *args, unsigned int argc)
+{
+    baby_print(args[0]);
+    return EMPTY_LIST;
+}
+
+
+static objptr_t builtin_newline(objptr_t *args, unsigned int argc)
+{
+    putchar('\n');
+    return EMPTY_LIST;
+}
+
+
+
+/*
+ * Memory
+ */
+
+
+static objptr_t builtin_seal_heap(objptr_t *args, unsigned int argc)
+{
+    seal_heap();
+    return EMPTY_LIST;
+}
+
+
+// (heap-size) => the number of cells in the heap, used or free
+static objptr_t builtin_heap_size(objptr_t *args, unsigned int argc)
+{
+    return make_integer_from_long_long(heap_size());
+}
+
+
+
+/*
+ * Registration
+ */
+
+
+struct builtin {
+    const char *name;
+    primitive_function_t function;
+    unsigned int min_arity;
+    unsigned int max_arity;
+
+    // Dedicated opcode used for calls with inline_operand_count arguments
+    unsigned int inline_opcode;
+    unsigned int inline_operand_count;
+};
+
+
+static struct builtin BUILTINS[] = {
+    { "car",            builtin_car,            1, 1, INSTR_CAR, 1 },
+    { "cdr",            builtin_cdr,            1, 1, INSTR_CDR, 1 },
+    { "cons",           builtin_cons,           2, 2, INSTR_CONS, 2 },
+    { "set-car!",       builtin_set_car,        2, 2 },
+    { "set-cdr!",       builtin_set_cdr,        2, 2 },
+    { "list",           builtin_list,           0, PRIMITIVE_VARIADIC },
+
+    { "pair?",          builtin_pair_p,         1, 1 },
+    { "null?",          builtin_null_p,         1, 1, INSTR_NULL, 1 },
+    { "symbol?",        builtin_symbol_p,       1, 1 },
+    { "number?",        builtin_number_p,       1, 1 },
+    { "vector?",        builtin_vector_p,       1, 1 },
+    { "string?",        builtin_string_p,       1, 1 },
+    { "procedure?",     builtin_procedure_p,    1, 1 },
+    { "not",            builtin_not,            1, 1, INSTR_NOT, 1 },
+    { "eq?",            builtin_eq_p,           2, 2, INSTR_EQ, 2 },
+    { "eqv?",           builtin_eqv_p,          2, 2 },
+    { "equal?",         builtin_equal_p,        2, 2 },
+
+    { "+",              builtin_add,            0, PRIMITIVE_VARIADIC, INSTR_ADD, 2 },
+    { "-",              builtin_subtract,       1, PRIMITIVE_VARIADIC, INSTR_SUB, 2 },
+    { "*",              builtin_multiply,       0, PRIMITIVE_VARIADIC },
+    { "/",              builtin_divide,         1, PRIMITIVE_VARIADIC },
+    { "quotient",       builtin_quotient,       2, 2 },
+    { "remainder",      builtin_remainder,      2, 2 },
+    { "<",              builtin_less,           1, PRIMITIVE_VARIADIC, INSTR_LT, 2 },
+    { "<=",             builtin_less_equal,     1, PRIMITIVE_VARIADIC },
+    { "=",              builtin_number_equal,   1, PRIMITIVE_VARIADIC, INSTR_NUM_EQ, 2 },
+    { ">",              builtin_greater,        1, PRIMITIVE_VARIADIC },
+    { ">=",             builtin_greater_equal,  1, PRIMITIVE_VARIADIC },
+
+    { "make-vector",    builtin_make_vector,    1, 2 },
+    { "vector",         builtin_vector,         0, PRIMITIVE_VARIADIC },
+    { "vector-length",  builtin_vector_length,  1, 1 },
+    { "vector-ref",     builtin_vector_ref,     2, 2 },
+    { "vector-set!",    builtin_vector_set,     3, 3 },
+    { "vector-copy",    builtin_vector_copy,    1, 3 },
+    { "vector-copy!",   builtin_vector_copy_x,  3, 5 },
+    { "vector-fill!",   builtin_vector_fill,    2, 4 },
+    { "subvector",      builtin_subvector,      3, 3 },
+    { "vector-grow",    builtin_vector_grow,    2, 2 },
+
+#define TYPED_VECTOR_BUILTIN_ENTRIES(TAG)                                         \
+    { "make-" #TAG "vector",  builtin_make_##TAG##vector,    1, 2 },              \
+    { #TAG "vector",          builtin_##TAG##vector,         0, PRIMITIVE_VARIADIC }, \
+    { #TAG "vector?",         builtin_##TAG##vector_p,       1, 1 },              \
+    { #TAG "vector-length",   builtin_typed_vector_length,   1, 1 },              \
+    { #TAG "vector-ref",      builtin_typed_vector_ref,      2, 2 },              \
+    { #TAG "vector-set!",     builtin_typed_vector_set,      3, 3 },              \
+    { #TAG "vector->list",    builtin_typed_vector_to_list,  1, 1 },              \
+    { "list->" #TAG "vector", builtin_list_to_##TAG##vector, 1, 1 },
+
+    TYPED_VECTOR_BUILTIN_ENTRIES(u8)
+    TYPED_VECTOR_BUILTIN_ENTRIES(s8)
+    TYPED_VECTOR_BUILTIN_ENTRIES(u16)
+    TYPED_VECTOR_BUILTIN_ENTRIES(s16)
+    TYPED_VECTOR_BUILTIN_ENTRIES(u32)
+    TYPED_VECTOR_BUILTIN_ENTRIES(s32)
+    TYPED_VECTOR_BUILTIN_ENTRIES(u64)
+    TYPED_VECTOR_BUILTIN_ENTRIES(s64)
+    TYPED_VECTOR_BUILTIN_ENTRIES(f32)
+    TYPED_VECTOR_BUILTIN_ENTRIES(f64)
+
+    { "typed-vector-sum",      builtin_typed_vector_sum,      1, 1 },
+    { "typed-vector-dot",      builtin_typed_vector_dot,      2, 2 },
+    { "typed-vector-min",      builtin_typed_vector_min,      1, 1 },
+    { "typed-vector-max",      builtin_typed_vector_max,      1, 1 },
+    { "typed-vector-add",      builtin_typed_vector_add,      2, 2 },
+    { "typed-vector-subtract", builtin_typed_vector_subtract, 2, 2 },
+    { "typed-vector-multiply", builtin_typed_vector_multiply, 2, 2 },
+    { "typed-vector-divide",   builtin_typed_vector_divide,   2, 2 },
+
+    { "string-length",  builtin_string_length,  1, 1 },
+    { "string=?",       builtin_string_equal,   1, PRIMITIVE_VARIADIC },
+    { "string<?",       builtin_string_less,    1, PRIMITIVE_VARIADIC },
+    { "string>?",       builtin_string_greater, 1, PRIMITIVE_VARIADIC },
+    { "string-search",  builtin_string_search,  2, 3 },
+    { "string-append",  builtin_string_append,  0, PRIMITIVE_VARIADIC },
+    { "substring",      builtin_substring,      2, 3 },
+    { "make-string-builder", builtin_make_string_builder, 0, 0 },
+    { "string-builder-append!", builtin_string_builder_append, 2, 4 },
+    { "string-builder-length", builtin_string_builder_length, 1, 1 },
+    { "string-builder-result", builtin_string_builder_result, 1, 1 },
+    { "symbol->string", builtin_symbol_to_string, 1, 1 },
+    { "string->symbol", builtin_string_to_symbol, 1, 1 },
+
+    { "bytevector?",    builtin_bytevector_p,   1, 1 },
+    { "make-bytevector", builtin_make_bytevector, 1, 2 },
+    { "bytevector",     builtin_bytevector,     0, PRIMITIVE_VARIADIC },
+    { "bytevector-length", builtin_bytevector_length, 1, 1 },
+    { "bytevector-u8-ref", builtin_bytevector_u8_ref, 2, 2 },
+    { "bytevector-u8-set!", builtin_bytevector_u8_set, 3, 3 },
+    { "bytevector-read-only?", builtin_bytevector_read_only_p, 1, 1 },
+    { "bytevector-copy", builtin_bytevector_copy, 1, 3 },
+    { "bytevector-slice", builtin_bytevector_slice, 2, 3 },
+    { "bytevector-copy!", builtin_bytevector_copy_to, 3, 5 },
+    { "file-open",      builtin_file_open,      1, 2 },
+    { "file-close",     builtin_file_close,     1, 1 },
+    { "file-size",      builtin_file_size,      1, 1 },
+    { "file-read!",     builtin_file_read,      2, 4 },
+    { "file-pread!",    builtin_file_pread,     3, 5 },
+    { "file-write",     builtin_file_write,     2, 4 },
+    { "file-map",       builtin_file_map,       1, 1 },
+    { "read-file-parallel", builtin_read_file_parallel, 1, 2 },
+    { "fasl-write",     builtin_fasl_write,     2, 2 },
+    { "fasl-read",      builtin_fasl_read,      1, 2 },
+
+    { "display",        builtin_display,        1, 1 },
+    { "newline",        builtin_newline,        0, 0 },
+
+    { "seal-heap!",     builtin_seal_heap,      0, 0 },
+    { "heap-size",      builtin_heap_size,      0, 0 },
+
+    { NULL, NULL, 0, 0 }
+};
+
+
+void init_builtins()
+{
+    unsigned int i;
+    objptr_t name;
+    objptr_t primitive;
+
+    GLOBAL_ENVIRONMENT = object_allocate(&TYPE_ENVIRONMENT);
+    declare_root_object(GLOBAL_ENVIRONMENT);
+    make_refcount_immune(GLOBAL_ENVIRONMENT);
+
+    for (i = 0; BUILTINS[i].name != NULL; i++)
+    {
+        name = c_string_to_symbol(BUILTINS[i].name);
+        primitive = make_primitive(name,
+                                   BUILTINS[i].function,
+                                   BUILTINS[i].min_arity,
+                                   BUILTINS[i].max_arity);
+        primitive_set_inline_opcode(primitive,
+                                    BUILTINS[i].inline_opcode,
+                                    BUILTINS[i].inline_operand_count);
+        environment_define(GLOBAL_ENVIRONMENT, name, primitive);
+    }
+}
+
+
+void terminate_builtins()
+{
+    GLOBAL_ENVIRONMENT = EMPTY_LIST;
+    free_type_instances(&TYPE_PRIMITIVE);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#ifndef BUILTINS_H_
+#define BUILTINS_H_
+
+
+#include "object.h"
+
+
+extern objptr_t GLOBAL_ENVIRONMENT;
+
+
+objptr_t builtin_error(const char*, const char*);
+
+void init_builtins();
+void terminate_builtins();
+
+#endif
@@ -26,4 +26,78 @@ typedef unsigned int instr_t;
 #define INSTR_MAKE_CLOSURE 0x0a
 #define INSTR_COMPILE_TO_THUNK 0x0b
 
+/*
+ * Inlined builtins. The operands are on the stack like for a
+ * call, the argument is the constant index of the operator's
+ * name, which is called instead once the name was rebound.
+ */
+#define INSTR_CAR          0x0c  /* 1 operand */
+#define INSTR_CDR          0x0d  /* 1 operand */
+#define INSTR_CONS         0x0e  /* 2 operands */
+#define INSTR_EQ           0x0f  /* 2 operands */
+#define INSTR_NULL         0x10  /* 1 operand */
+#define INSTR_NOT          0x11  /* 1 operand */
+#define INSTR_ADD          0x12  /* 2 operands */
+#define INSTR_SUB          0x13  /* 2 operands */
+#define INSTR_LT           0x14  /* 2 operands */
+#define INSTR_NUM_EQ       0x15  /* 2 operands */
+
+/*
+ * Variants of SET_CONST and DEFINE_CONST which don't push the
+ * value, emitted by the optimizer for definitions in BEGIN blocks
+ * and by the compiler for LET bindings.
+ */
+#define INSTR_SET_CONST_DROP    0x16
+#define INSTR_DEFINE_CONST_DROP 0x17
+
+/*
+ * Tail call of the running procedure by its own name. If the
+ * operator turns out to be the running closure, the parameters
+ * are rebound in the current environment and execution jumps
+ * back to offset 0. Otherwise it behaves like TAILCALL.
+ */
+#define INSTR_SELF_TAILCALL     0x18
+
+
+/*
+ * Superinstructions
+ *
+ * SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS) defines the
+ * opcode INSTR_<NAME>, which executes INSTR_<FIRST> followed by
+ * INSTR_<SECOND>. The argument of the first instruction is kept
+ * in the lower BITS bits of the argument, the one of the second
+ * instruction above them. The optimizer fuses pairs only if both
+ * arguments fit.
+ *
+ * The pairs were picked with the opcode pair profiler, see
+ * NIL_PROFILE_OPCODES in fiber.c.
+ *
+ * The first instruction must not leave the procedure: an inlined
+ * builtin whose name was rebound calls the new binding, and the
+ * second instruction would run in the callee's frame. Only the
+ * second instruction may be one of those.
+ */
+
+#define SUPERINSTRUCTION_TABLE                                                     \
+    SUPERINSTRUCTION(LOOKUP_LOOKUP,        0x20, LOOKUP_CONST, LOOKUP_CONST,  12)  \
+    SUPERINSTRUCTION(LOOKUP_CALL,          0x21, LOOKUP_CONST, CALL,          16)  \
+    SUPERINSTRUCTION(LOOKUP_TAILCALL,      0x22, LOOKUP_CONST, TAILCALL,      16)  \
+    SUPERINSTRUCTION(LOOKUP_JMP_IF_NOT,    0x23, LOOKUP_CONST, JMP_IF_NOT,    12)  \
+    SUPERINSTRUCTION(LOOKUP_CAR,           0x24, LOOKUP_CONST, CAR,           12)  \
+    SUPERINSTRUCTION(LOOKUP_CDR,           0x25, LOOKUP_CONST, CDR,           12)  \
+    SUPERINSTRUCTION(PUSH_TAILCALL,        0x27, PUSH_CONST,   TAILCALL,      16)  \
+    SUPERINSTRUCTION(LOOKUP_SELF_TAILCALL, 0x28, LOOKUP_CONST, SELF_TAILCALL, 16)
+
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS) INSTR_##NAME = CODE,
+enum superinstruction_opcode {
+    SUPERINSTRUCTION_TABLE
+};
+#undef SUPERINSTRUCTION
+
+#define SUPERINSTRUCTION_FIRST_ARGUMENT(ARG, BITS)  ((ARG) & ((1u << (BITS)) - 1))
+#define SUPERINSTRUCTION_SECOND_ARGUMENT(ARG, BITS) ((ARG) >> (BITS))
+#define SUPERINSTRUCTION_ARGUMENT(FIRST, SECOND, BITS) (((SECOND) << (BITS)) | (FIRST))
+#define SUPERINSTRUCTION_ARGUMENTS_FIT(FIRST, SECOND, BITS) \
+    (((FIRST) < (1u << (BITS))) && ((SECOND) < (1u << (24 - (BITS)))))
+
 #endif
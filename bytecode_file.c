@@ -0,0 +1,1465 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "baby_io.h"
+#include "builtins.h"
+#include "bytevector.h"
+#include "character.h"
+#include "closure.h"
+#include "environment.h"
+#include "number.h"
+#include "pair.h"
+#include "primitive.h"
+#include "string_kernels.h"
+#include "string_object.h"
+#include "symbol.h"
+#include "typed_vector.h"
+#include "vector.h"
+
+#include "jit.h"
+
+#include "bytecode_file.h"
+
+
+
+/*
+ * File format
+ *
+ * After the header, the file is a sequence of object records, each
+ * starting with a tag byte. Records refer to other objects by their
+ * position in the sequence, shared objects are written once. Since
+ * closures and environments refer to each other, references may
+ * point forward: the loader first creates all objects and then
+ * fills in their references in a second pass. The END record names
+ * the root.
+ */
+
+enum bytecode_file_tag {
+    TAG_END,
+    TAG_EMPTY_LIST,
+    TAG_TRUE,
+    TAG_FALSE,
+    TAG_SYMBOL,        /* length, unit size, units */
+    TAG_GENSYM,        /* length, unit size, units */
+    TAG_STRING,        /* length, unit size, units */
+    TAG_CHARACTER,     /* code */
+    TAG_INTEGER,       /* value */
+    TAG_RATIONAL,      /* numerator, denominator */
+    TAG_REAL,          /* value */
+    TAG_COMPLEX,       /* real part, imaginary part */
+    TAG_PAIR,          /* car, cdr */
+    TAG_VECTOR,        /* length, members */
+    TAG_PROTOTYPE,     /* is_macro, parameters, rest parameter,
+                          constants, code size, instructions */
+    TAG_CLOSURE,       /* prototype, environment */
+    TAG_ENVIRONMENT,   /* parent, binding count, keys and values */
+    TAG_GLOBAL_ENVIRONMENT,  /* binding count, keys and values */
+    TAG_PRIMITIVE,     /* name length, unit size, units */
+    TAG_BIGNUM,        /* sign, limb count, limbs */
+    TAG_TYPED_VECTOR,  /* element type, length, elements */
+    TAG_BYTEVECTOR,    /* length, bytes */
+    TAG_BIG_RATIONAL   /* sign, numerator limb count, limbs,
+                          denominator limb count, limbs */
+};
+
+#define BYTE_ORDER_MARK 0x01020304u
+
+#define NOT_WRITTEN 0xffffffffu
+
+// Fasl messages start with the size of the records and their count
+#define FASL_FRAME_SIZE (sizeof(uint64_t) + sizeof(uint32_t))
+
+
+enum object_file_kind {
+    OBJECT_FILE_CODE,
+    OBJECT_FILE_IMAGE,
+    OBJECT_FILE_DATA       // Fasl data, without code or environments
+};
+
+
+
+/*
+ * Writer
+ */
+
+
+struct written_object {
+    objptr_t object;
+    unsigned int position;
+};
+
+
+struct object_writer {
+    FILE *file;
+    enum object_file_kind kind;
+    bool failed;
+
+    // The objects in the order of their records
+    objptr_t *queue;
+    unsigned int queue_count;
+    unsigned int queue_alloc;
+
+    // Positions of the queued objects, kept at most half full
+    struct written_object *table;
+    unsigned int table_size;
+    unsigned int table_count;
+};
+
+
+static unsigned int object_slot(struct object_writer *writer,
+                                objptr_t object)
+{
+    unsigned int slot;
+
+    slot = (object * 2654435761u) & (writer->table_size - 1);
+    while (writer->table[slot].position != NOT_WRITTEN &&
+           writer->table[slot].object != object) {
+        slot = (slot + 1) & (writer->table_size - 1);
+    }
+
+    return slot;
+}
+
+
+static bool grow_object_table(struct object_writer *writer)
+{
+    struct written_object *old_table;
+    unsigned int old_size, i, slot;
+
+    old_table = writer->table;
+    old_size = writer->table_size;
+
+    writer->table_size = old_size == 0 ? 64 : 2 * old_size;
+    writer->table = malloc(writer->table_size * sizeof(struct written_object));
+    if (writer->table == NULL) {
+        writer->table = old_table;
+        writer->table_size = old_size;
+        return false;
+    }
+    for (i = 0; i < writer->table_size; i++) {
+        writer->table[i].position = NOT_WRITTEN;
+    }
+
+    for (i = 0; i < old_size; i++) {
+        if (old_table[i].position != NOT_WRITTEN) {
+            slot = object_slot(writer, old_table[i].object);
+            writer->table[slot] = old_table[i];
+        }
+    }
+    free(old_table);
+    return true;
+}
+
+
+/*
+ * Returns the position of the object's record, queueing the object
+ * if it wasn't seen before. Sets FAILED and returns 0 if there's no
+ * memory to do so.
+ */
+static unsigned int object_position(struct object_writer *writer, objptr_t object)
+{
+    objptr_t *queue;
+    unsigned int slot, alloc;
+
+    if (2 * (writer->table_count + 1) > writer->table_size
+        && !grow_object_table(writer)) {
+        writer->failed = true;
+        return 0;
+    }
+
+    slot = object_slot(writer, object);
+    if (writer->table[slot].position == NOT_WRITTEN) {
+        if (writer->queue_count == writer->queue_alloc) {
+            alloc = writer->queue_alloc == 0 ? 64 : 2 * writer->queue_alloc;
+            queue = realloc(writer->queue, alloc * sizeof(objptr_t));
+            if (queue == NULL) {
+                writer->failed = true;
+                return 0;
+            }
+            writer->queue = queue;
+            writer->queue_alloc = alloc;
+        }
+        writer->queue[writer->queue_count] = object;
+
+        writer->table[slot].object = object;
+        writer->table[slot].position = writer->queue_count++;
+        writer->table_count++;
+    }
+
+    return writer->table[slot].position;
+}
+
+
+static void write_bytes(struct object_writer *writer,
+                        const void *data, size_t size)
+{
+    // Empty strings have no units to write, and maybe no buffer
+    if (!writer->failed && size > 0 && fwrite(data, 1, size, writer->file) != size) {
+        writer->failed = true;
+    }
+}
+
+
+static void write_tag(struct object_writer *writer, enum bytecode_file_tag tag)
+{
+    unsigned char byte = tag;
+    write_bytes(writer, &byte, 1);
+}
+
+
+static void write_u32(struct object_writer *writer, uint32_t value)
+{
+    write_bytes(writer, &value, sizeof(value));
+}
+
+
+static void write_double(struct object_writer *writer, double value)
+{
+    write_bytes(writer, &value, sizeof(value));
+}
+
+
+static void write_reference(struct object_writer *writer, objptr_t object)
+{
+    write_u32(writer, object_position(writer, object));
+}
+
+
+static void write_characters(struct object_writer *writer, objptr_t string)
+{
+    const void *units;
+    unsigned int length;
+    unsigned char unit_size;
+    bool is_wide;
+
+    units = string_units(string, &is_wide);
+    length = string_length(string);
+    unit_size = is_wide ? sizeof(unichar_t) : 1;
+
+    write_u32(writer, length);
+    write_bytes(writer, &unit_size, 1);
+    write_bytes(writer, units, length * unit_size);
+}
+
+
+static void write_number(struct object_writer *writer, struct number *number)
+{
+    unsigned char negative;
+
+    switch (number->type) {
+    case NUMBER_INTEGER:
+        write_tag(writer, TAG_INTEGER);
+        write_u32(writer, (uint32_t) number->value.integer);
+        break;
+    case NUMBER_RATIONAL:
+        write_tag(writer, TAG_RATIONAL);
+        write_u32(writer, (uint32_t) number->value.rational.numerator);
+        write_u32(writer, number->value.rational.denominator);
+        break;
+    case NUMBER_REAL:
+        write_tag(writer, TAG_REAL);
+        write_double(writer, number->value.real);
+        break;
+    case NUMBER_COMPLEX:
+        write_tag(writer, TAG_COMPLEX);
+        write_double(writer, number->value.complex.real);
+        write_double(writer, number->value.complex.imaginary);
+        break;
+    case NUMBER_BIGNUM:
+        negative = number->value.bignum.negative;
+        write_tag(writer, TAG_BIGNUM);
+        write_bytes(writer, &negative, 1);
+        write_u32(writer, number->value.bignum.length);
+        write_bytes(writer, number->value.bignum.limbs,
+                    number->value.bignum.length * sizeof(limb_t));
+        break;
+    case NUMBER_BIG_RATIONAL:
+        negative = number->value.big_rational.negative;
+        write_tag(writer, TAG_BIG_RATIONAL);
+        write_bytes(writer, &negative, 1);
+        write_u32(writer, number->value.big_rational.numerator_length);
+        write_bytes(writer, number->value.big_rational.numerator,
+                    number->value.big_rational.numerator_length * sizeof(limb_t));
+        write_u32(writer, number->value.big_rational.denominator_length);
+        write_bytes(writer, number->value.big_rational.denominator,
+                    number->value.big_rational.denominator_length * sizeof(limb_t));
+        break;
+    }
+}
+
+
+static void write_typed_vector(struct object_writer *writer,
+                               struct typed_vector *vector)
+{
+    unsigned char type;
+
+    type = vector->type;
+    write_tag(writer, TAG_TYPED_VECTOR);
+    write_bytes(writer, &type, 1);
+    write_u32(writer, vector->length);
+    write_bytes(writer, vector->data,
+                vector->length * typed_vector_element_size(vector->type));
+}
+
+
+static void write_prototype(struct object_writer *writer,
+                            struct closure_prototype *proto)
+{
+    unsigned char is_macro;
+    unsigned int i;
+
+    is_macro = proto->is_macro;
+
+    write_tag(writer, TAG_PROTOTYPE);
+    write_bytes(writer, &is_macro, 1);
+    write_reference(writer, proto->parameter_vector);
+    write_reference(writer, proto->rest_parameter);
+    write_reference(writer, proto->code.constant_vector);
+    write_u32(writer, proto->code.code_size);
+    for (i = 0; i < proto->code.code_size; i++) {
+        write_u32(writer, proto->code.codes[i]);
+    }
+}
+
+
+static void write_environment(struct object_writer *writer,
+                              objptr_t ptr)
+{
+    struct environment *environment;
+    unsigned int i, count;
+
+    environment = (struct environment*) dereference(ptr);
+
+    count = environment->extended_slot_count;
+    for (i = 0; i < ENVIRONMENT_SLOT_COUNT; i++) {
+        if (environment->slots[i].key != EMPTY_LIST) count++;
+    }
+
+    if (ptr == GLOBAL_ENVIRONMENT) {
+        write_tag(writer, TAG_GLOBAL_ENVIRONMENT);
+    } else {
+        write_tag(writer, TAG_ENVIRONMENT);
+        write_reference(writer, environment->parent);
+    }
+
+    write_u32(writer, count);
+    for (i = 0; i < ENVIRONMENT_SLOT_COUNT; i++) {
+        if (environment->slots[i].key != EMPTY_LIST) {
+            write_reference(writer, environment->slots[i].key);
+            write_reference(writer, environment->slots[i].value);
+        }
+    }
+    for (i = 0; i < environment->extended_slot_count; i++) {
+        write_reference(writer, environment->extended_slots[i].key);
+        write_reference(writer, environment->extended_slots[i].value);
+    }
+}
+
+
+static void write_record(struct object_writer *writer, objptr_t object)
+{
+    struct number buffer;
+    unsigned int length, i;
+
+    if (object == EMPTY_LIST) {
+        write_tag(writer, TAG_EMPTY_LIST);
+    } else if (object == NIL_TRUE) {
+        write_tag(writer, TAG_TRUE);
+    } else if (object == NIL_FALSE) {
+        write_tag(writer, TAG_FALSE);
+    } else if (is_of_type(object, &TYPE_SYMBOL)) {
+        write_tag(writer, ((struct symbol*) dereference(object))->is_gensym ?
+                          TAG_GENSYM : TAG_SYMBOL);
+        write_characters(writer, symbol_to_string(object));
+    } else if (is_of_type(object, &TYPE_CHARACTER)) {
+        write_tag(writer, TAG_CHARACTER);
+        write_u32(writer, character_value(object));
+    } else if (is_of_type(object, &TYPE_NUMBER)) {
+        write_number(writer, number_view(object, &buffer));
+    } else if (is_of_type(object, &TYPE_PAIR)) {
+        write_tag(writer, TAG_PAIR);
+        write_reference(writer, get_car(object));
+        write_reference(writer, get_cdr(object));
+    } else if (is_of_type(object, &TYPE_STRING)) {
+        write_tag(writer, TAG_STRING);
+        write_characters(writer, object);
+    } else if (is_of_type(object, &TYPE_VECTOR)) {
+        length = vector_length(object);
+        write_tag(writer, TAG_VECTOR);
+        write_u32(writer, length);
+        for (i = 0; i < length; i++) {
+            write_reference(writer, vector_get(object, i));
+        }
+    } else if (is_of_type(object, &TYPE_BYTEVECTOR)) {
+        // Slices and mappings are loaded as copies of their bytes
+        write_tag(writer, TAG_BYTEVECTOR);
+        write_u32(writer, bytevector_length(object));
+        write_bytes(writer, ((struct bytevector*) dereference(object))->data,
+                    bytevector_length(object));
+    } else if (is_of_type(object, &TYPE_TYPED_VECTOR)) {
+        write_typed_vector(writer, (struct typed_vector*) dereference(object));
+    } else if (writer->kind == OBJECT_FILE_DATA) {
+        // Fasl data can't hold code
+        writer->failed = true;
+    } else if (is_of_type(object, &TYPE_CLOSURE_PROTOTYPE)) {
+        write_prototype(writer, (struct closure_prototype*) dereference(object));
+    } else if (is_of_type(object, &TYPE_CLOSURE)) {
+        write_tag(writer, TAG_CLOSURE);
+        write_reference(writer, ((struct closure*) dereference(object))->prototype);
+        write_reference(writer, ((struct closure*) dereference(object))->environment);
+    } else if (is_of_type(object, &TYPE_ENVIRONMENT)) {
+        write_environment(writer, object);
+    } else if (is_of_type(object, &TYPE_PRIMITIVE)) {
+        // Primitives are looked up by name when loading
+        write_tag(writer, TAG_PRIMITIVE);
+        write_characters(writer,
+                         symbol_to_string(((struct primitive*) dereference(object))->name));
+    } else {
+        // Continuations and fibers only exist while running
+        writer->failed = true;
+    }
+}
+
+
+/*
+ * Writes the records of the root and everything reachable from it.
+ * Afterwards, the writer's queue holds the objects in the order of
+ * their records.
+ */
+static void write_objects(struct object_writer *writer, FILE *file,
+                          const char *magic, enum object_file_kind kind,
+                          objptr_t root)
+{
+    unsigned int i;
+
+    writer->file = file;
+    writer->kind = kind;
+    writer->failed = false;
+    writer->queue = NULL;
+    writer->queue_count = 0;
+    writer->queue_alloc = 0;
+    writer->table = NULL;
+    writer->table_size = 0;
+    writer->table_count = 0;
+
+    write_bytes(writer, magic, 4);
+    write_u32(writer, BYTECODE_FILE_VERSION);
+    write_u32(writer, BYTE_ORDER_MARK);
+
+    // Writing a record queues the objects it refers to
+    object_position(writer, root);
+    for (i = 0; i < writer->queue_count && !writer->failed; i++) {
+        write_record(writer, writer->queue[i]);
+    }
+    write_tag(writer, TAG_END);
+    write_u32(writer, 0);
+
+    free(writer->table);
+}
+
+
+static bool write_object_file(const char *path, const char *magic,
+                              enum object_file_kind kind, objptr_t root)
+{
+    struct object_writer writer;
+    FILE *file;
+
+    file = fopen(path, "wb");
+    if (file == NULL) return false;
+
+    write_objects(&writer, file, magic, kind, root);
+    free(writer.queue);
+
+    if (fclose(file) != 0) writer.failed = true;
+    if (writer.failed) remove(path);
+
+    return !writer.failed;
+}
+
+
+
+/*
+ * Loader
+ */
+
+
+struct object_reader {
+    const unsigned char *start;
+    const unsigned char *position;
+    const unsigned char *end;
+    bool failed;
+    enum object_file_kind kind;
+
+    // Native code for the prototypes in the order of their records
+    struct jit_code *natives;
+    unsigned int native_count;
+    unsigned int native_next;
+
+    // Every object is held by one reference while in the table
+    objptr_t *objects;
+    size_t *offsets;
+    unsigned int object_count;
+    unsigned int object_alloc;
+};
+
+
+static bool read_bytes(struct object_reader *reader, void *data, size_t size)
+{
+    if (reader->failed || (size_t) (reader->end - reader->position) < size) {
+        reader->failed = true;
+        memset(data, 0, size);
+        return false;
+    }
+
+    memcpy(data, reader->position, size);
+    reader->position += size;
+    return true;
+}
+
+
+static uint32_t read_u32(struct object_reader *reader)
+{
+    uint32_t value;
+    read_bytes(reader, &value, sizeof(value));
+    return value;
+}
+
+
+static double read_double(struct object_reader *reader)
+{
+    double value;
+    read_bytes(reader, &value, sizeof(value));
+    return value;
+}
+
+
+/*
+ * Checks that COUNT items of SIZE bytes follow and skips them if
+ * SKIP is set.
+ */
+static bool check_items(struct object_reader *reader, uint32_t count,
+                        size_t size, bool skip)
+{
+    if (reader->failed ||
+        count > (size_t) (reader->end - reader->position) / size) {
+        reader->failed = true;
+        return false;
+    }
+
+    if (skip) reader->position += count * size;
+    return true;
+}
+
+
+static objptr_t read_reference(struct object_reader *reader)
+{
+    uint32_t position;
+
+    position = read_u32(reader);
+    if (position >= reader->object_count) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+
+    return reader->objects[position];
+}
+
+
+/*
+ * Checks the length and unit size of the characters that follow.
+ * Returns the unit size, or 0 if they don't fit.
+ */
+static unsigned char read_characters_header(struct object_reader *reader,
+                                            uint32_t *length)
+{
+    unsigned char unit_size;
+
+    *length = read_u32(reader);
+    read_bytes(reader, &unit_size, 1);
+    if ((unit_size != 1 && unit_size != sizeof(unichar_t)) ||
+        !check_items(reader, *length, unit_size, false)) {
+        reader->failed = true;
+        return 0;
+    }
+
+    return unit_size;
+}
+
+
+static objptr_t read_units(struct object_reader *reader, uint32_t length,
+                           unsigned char unit_size)
+{
+    objptr_t string;
+    unichar_t *codes;
+
+    switch (unit_size) {
+    case 1:
+        string = make_string_from_latin1((const char*) reader->position, length);
+        reader->position += length;
+        break;
+    case sizeof(unichar_t):
+        // The units may be unaligned
+        codes = malloc(length * sizeof(unichar_t) + 1);
+        if (codes == NULL) {
+            string = EMPTY_LIST;
+            break;
+        }
+        read_bytes(reader, codes, length * sizeof(unichar_t));
+        string = make_string_from_codes(codes, length);
+        free(codes);
+        break;
+    default:
+        return EMPTY_LIST;
+    }
+
+    if (string == EMPTY_LIST) reader->failed = true;
+    return string;
+}
+
+
+static objptr_t read_characters(struct object_reader *reader)
+{
+    unsigned char unit_size;
+    uint32_t length;
+
+    unit_size = read_characters_header(reader, &length);
+    return read_units(reader, length, unit_size);
+}
+
+
+static objptr_t read_symbol(struct object_reader *reader, bool is_gensym)
+{
+    const char *name;
+    objptr_t string, symbol;
+    unsigned char unit_size;
+    uint32_t length;
+
+    unit_size = read_characters_header(reader, &length);
+    if (reader->failed) return EMPTY_LIST;
+
+    if (unit_size == 1) {
+        // Narrow names are looked up without making a string
+        name = (const char*) reader->position;
+        reader->position += length;
+        symbol = latin1_to_symbol(name, length, units8_hash((const uint8_t*) name, length));
+    } else {
+        string = read_units(reader, length, unit_size);
+        if (reader->failed) return EMPTY_LIST;
+        increase_refcount(string);
+        symbol = string_to_symbol(string);
+        decrease_refcount(string);
+    }
+
+    return is_gensym ? gensym(symbol) : symbol;
+}
+
+
+static objptr_t read_primitive(struct object_reader *reader)
+{
+    objptr_t primitive;
+
+    // Runs before any global binding is restored
+    primitive = environment_get_binding(GLOBAL_ENVIRONMENT,
+                                        read_symbol(reader, false));
+    if (!is_of_type(primitive, &TYPE_PRIMITIVE)) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+
+    return primitive;
+}
+
+
+static objptr_t read_bignum(struct object_reader *reader)
+{
+    unsigned char negative;
+    uint32_t length;
+    limb_t *limbs;
+
+    read_bytes(reader, &negative, 1);
+    length = read_u32(reader);
+    if (!check_items(reader, length, sizeof(limb_t), false)) return EMPTY_LIST;
+
+    limbs = malloc((length + 1) * sizeof(limb_t));
+    if (limbs == NULL) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+    read_bytes(reader, limbs, length * sizeof(limb_t));
+
+    return make_integer_from_limbs(negative != 0, limbs, length);
+}
+
+
+// Reads a limb count and the limbs into a new array
+static limb_t *read_limbs(struct object_reader *reader, uint32_t *length)
+{
+    limb_t *limbs;
+
+    *length = read_u32(reader);
+    if (!check_items(reader, *length, sizeof(limb_t), false)) return NULL;
+
+    limbs = malloc((*length + 1) * sizeof(limb_t));
+    if (limbs == NULL) {
+        reader->failed = true;
+        return NULL;
+    }
+    read_bytes(reader, limbs, *length * sizeof(limb_t));
+    return limbs;
+}
+
+
+static objptr_t read_big_rational(struct object_reader *reader)
+{
+    unsigned char negative;
+    uint32_t numerator_length, denominator_length;
+    limb_t *numerator, *denominator;
+    objptr_t number;
+
+    read_bytes(reader, &negative, 1);
+    numerator = read_limbs(reader, &numerator_length);
+    if (numerator == NULL) return EMPTY_LIST;
+    denominator = read_limbs(reader, &denominator_length);
+    if (denominator == NULL) {
+        free(numerator);
+        return EMPTY_LIST;
+    }
+
+    // Fails for a zero denominator
+    number = make_rational_from_limbs(negative != 0, numerator, numerator_length,
+                                      denominator, denominator_length);
+    if (number == EMPTY_LIST) reader->failed = true;
+    return number;
+}
+
+
+static objptr_t read_bytevector(struct object_reader *reader)
+{
+    uint32_t length;
+    objptr_t vector;
+
+    length = read_u32(reader);
+    if (!check_items(reader, length, 1, false)) return EMPTY_LIST;
+
+    vector = make_bytevector(length, 0);
+    if (vector == EMPTY_LIST) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+    read_bytes(reader, ((struct bytevector*) dereference(vector))->data, length);
+
+    return vector;
+}
+
+
+static objptr_t read_typed_vector(struct object_reader *reader)
+{
+    unsigned char type;
+    uint32_t length;
+    objptr_t vector;
+
+    read_bytes(reader, &type, 1);
+    length = read_u32(reader);
+    if (type >= TYPED_VECTOR_TYPE_COUNT) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+    if (!check_items(reader, length, typed_vector_element_size(type), false)) {
+        return EMPTY_LIST;
+    }
+
+    vector = make_typed_vector(type, length, EMPTY_LIST);
+    if (vector == EMPTY_LIST) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+    read_bytes(reader, ((struct typed_vector*) dereference(vector))->data,
+               length * typed_vector_element_size(type));
+
+    return vector;
+}
+
+
+static objptr_t create_prototype(struct object_reader *reader)
+{
+    objptr_t ptr;
+    struct closure_prototype *proto;
+    unsigned char is_macro;
+    uint32_t code_size;
+
+    read_bytes(reader, &is_macro, 1);
+    check_items(reader, 3, sizeof(uint32_t), true);
+    code_size = read_u32(reader);
+    if (!check_items(reader, code_size, sizeof(instr_t), false)) return EMPTY_LIST;
+
+    if (reader->natives != NULL && reader->native_next == reader->native_count) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+
+    ptr = object_allocate(&TYPE_CLOSURE_PROTOTYPE);
+    if (ptr == EMPTY_LIST) return ptr;
+
+    proto = (struct closure_prototype*) dereference(ptr);
+    proto->is_macro = is_macro;
+
+    // The mapping goes away after loading, the code is owned by the prototype
+    proto->code.code_size = code_size;
+    proto->code.code_alloc = code_size;
+    if (code_size > 0) {
+        proto->code.codes = malloc(code_size * sizeof(instr_t));
+        if (proto->code.codes == NULL) {
+            proto->code.code_size = 0;
+            proto->code.code_alloc = 0;
+            increase_refcount(ptr);
+            decrease_refcount(ptr);
+            reader->failed = true;
+            return EMPTY_LIST;
+        }
+        read_bytes(reader, proto->code.codes, code_size * sizeof(instr_t));
+    }
+
+    if (reader->natives != NULL) {
+        proto->code.native = &reader->natives[reader->native_next++];
+    }
+
+    return ptr;
+}
+
+
+// Records that fasl data can't hold
+static bool is_code_tag(enum bytecode_file_tag tag)
+{
+    switch (tag) {
+    case TAG_PROTOTYPE:
+    case TAG_CLOSURE:
+    case TAG_ENVIRONMENT:
+    case TAG_GLOBAL_ENVIRONMENT:
+    case TAG_PRIMITIVE:
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+/*
+ * First pass: creates the object of a record, references are left
+ * empty.
+ */
+static objptr_t create_object(struct object_reader *reader,
+                              enum bytecode_file_tag tag)
+{
+    uint32_t numerator, count;
+    double real;
+
+    if (reader->kind == OBJECT_FILE_DATA && is_code_tag(tag)) {
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+
+    switch (tag) {
+    case TAG_EMPTY_LIST:
+        return EMPTY_LIST;
+    case TAG_TRUE:
+        return NIL_TRUE;
+    case TAG_FALSE:
+        return NIL_FALSE;
+    case TAG_SYMBOL:
+        return read_symbol(reader, false);
+    case TAG_GENSYM:
+        return read_symbol(reader, true);
+    case TAG_STRING:
+        return read_characters(reader);
+    case TAG_CHARACTER:
+        return get_character(read_u32(reader));
+    case TAG_INTEGER:
+        return make_integer((int) read_u32(reader));
+    case TAG_RATIONAL:
+        numerator = read_u32(reader);
+        return make_rational((int) numerator, read_u32(reader));
+    case TAG_REAL:
+        return make_real(read_double(reader));
+    case TAG_COMPLEX:
+        real = read_double(reader);
+        return make_complex(real, read_double(reader));
+    case TAG_BIGNUM:
+        return read_bignum(reader);
+    case TAG_BIG_RATIONAL:
+        return read_big_rational(reader);
+    case TAG_TYPED_VECTOR:
+        return read_typed_vector(reader);
+    case TAG_BYTEVECTOR:
+        return read_bytevector(reader);
+    case TAG_PAIR:
+        check_items(reader, 2, sizeof(uint32_t), true);
+        return cons(EMPTY_LIST, EMPTY_LIST);
+    case TAG_VECTOR:
+        check_items(reader, read_u32(reader), sizeof(uint32_t), true);
+        return make_vector(EMPTY_LIST, 0);
+    case TAG_PROTOTYPE:
+        return create_prototype(reader);
+    case TAG_CLOSURE:
+        check_items(reader, 2, sizeof(uint32_t), true);
+        return object_allocate(&TYPE_CLOSURE);
+    case TAG_ENVIRONMENT:
+        check_items(reader, 1, sizeof(uint32_t), true);
+        count = read_u32(reader);
+        check_items(reader, count, 2 * sizeof(uint32_t), true);
+        return object_allocate(&TYPE_ENVIRONMENT);
+    case TAG_GLOBAL_ENVIRONMENT:
+        count = read_u32(reader);
+        check_items(reader, count, 2 * sizeof(uint32_t), true);
+        if (reader->kind != OBJECT_FILE_IMAGE) reader->failed = true;
+        return GLOBAL_ENVIRONMENT;
+    case TAG_PRIMITIVE:
+        return read_primitive(reader);
+    default:
+        reader->failed = true;
+        return EMPTY_LIST;
+    }
+}
+
+
+static void fill_prototype(struct object_reader *reader, objptr_t ptr)
+{
+    struct closure_prototype *proto;
+    objptr_t parameters, rest, constants;
+
+    reader->position++;  // is_macro
+    parameters = read_reference(reader);
+    rest = read_reference(reader);
+    constants = read_reference(reader);
+
+    if (reader->failed ||
+        !is_of_type(parameters, &TYPE_VECTOR) ||
+        (constants != EMPTY_LIST && !is_of_type(constants, &TYPE_VECTOR))) {
+        reader->failed = true;
+        return;
+    }
+
+    proto = (struct closure_prototype*) dereference(ptr);
+    proto->parameter_vector = parameters;
+    increase_refcount(parameters);
+    proto->rest_parameter = rest;
+    increase_refcount(rest);
+    proto->code.constant_vector = constants;
+    increase_refcount(constants);
+}
+
+
+static void fill_closure(struct object_reader *reader, objptr_t ptr)
+{
+    struct closure *closure;
+    objptr_t prototype, environment;
+
+    prototype = read_reference(reader);
+    environment = read_reference(reader);
+
+    if (reader->failed ||
+        !is_of_type(prototype, &TYPE_CLOSURE_PROTOTYPE) ||
+        (environment != EMPTY_LIST && !is_of_type(environment, &TYPE_ENVIRONMENT))) {
+        reader->failed = true;
+        return;
+    }
+
+    closure = (struct closure*) dereference(ptr);
+    closure->prototype = prototype;
+    increase_refcount(prototype);
+    closure->environment = environment;
+    increase_refcount(environment);
+}
+
+
+static void fill_environment(struct object_reader *reader, objptr_t ptr)
+{
+    objptr_t parent, key, value;
+    uint32_t count, i;
+
+    if (ptr != GLOBAL_ENVIRONMENT) {
+        parent = read_reference(reader);
+        if (parent != EMPTY_LIST && !is_of_type(parent, &TYPE_ENVIRONMENT)) {
+            reader->failed = true;
+            return;
+        }
+        environment_set_parent(ptr, parent);
+    }
+
+    count = read_u32(reader);
+    for (i = 0; i < count && !reader->failed; i++) {
+        key = read_reference(reader);
+        value = read_reference(reader);
+
+        /*
+         * Like a definition at run time, rebinding the name of an
+         * inlined builtin disables the inline opcode.
+         */
+        if (ptr != GLOBAL_ENVIRONMENT ||
+            environment_get_binding(ptr, key) != value) {
+            primitive_invalidate_inline_opcodes(key);
+        }
+        environment_define(ptr, key, value);
+    }
+}
+
+
+/*
+ * Second pass: fills in the references of a record's object.
+ */
+static void fill_object(struct object_reader *reader,
+                        enum bytecode_file_tag tag,
+                        objptr_t object)
+{
+    uint32_t length, i;
+
+    switch (tag) {
+    case TAG_PAIR:
+        set_car(object, read_reference(reader));
+        set_cdr(object, read_reference(reader));
+        break;
+    case TAG_VECTOR:
+        length = read_u32(reader);
+        for (i = 0; i < length && !reader->failed; i++) {
+            vector_append(object, read_reference(reader));
+        }
+        break;
+    case TAG_PROTOTYPE:
+        fill_prototype(reader, object);
+        break;
+    case TAG_CLOSURE:
+        fill_closure(reader, object);
+        break;
+    case TAG_ENVIRONMENT:
+    case TAG_GLOBAL_ENVIRONMENT:
+        fill_environment(reader, object);
+        break;
+    default:
+        break;
+    }
+}
+
+
+static bool read_header(struct object_reader *reader, const char *magic)
+{
+    char file_magic[4];
+
+    read_bytes(reader, file_magic, 4);
+    return !reader->failed &&
+        memcmp(file_magic, magic, 4) == 0 &&
+        read_u32(reader) == BYTECODE_FILE_VERSION &&
+        read_u32(reader) == BYTE_ORDER_MARK;
+}
+
+
+/*
+ * Adds a new object to the table, or frees it and sets FAILED if the
+ * table can't grow.
+ */
+static void add_object(struct object_reader *reader, objptr_t object, size_t offset)
+{
+    objptr_t *objects;
+    size_t *offsets;
+    unsigned int alloc;
+
+    if (reader->object_count == reader->object_alloc) {
+        alloc = reader->object_alloc == 0 ? 64 : 2 * reader->object_alloc;
+        objects = realloc(reader->objects, alloc * sizeof(objptr_t));
+        if (objects != NULL) reader->objects = objects;
+        offsets = realloc(reader->offsets, alloc * sizeof(size_t));
+        if (offsets != NULL) reader->offsets = offsets;
+
+        if (objects == NULL || offsets == NULL) {
+            increase_refcount(object);
+            decrease_refcount(object);
+            reader->failed = true;
+            return;
+        }
+        reader->object_alloc = alloc;
+    }
+
+    reader->objects[reader->object_count] = object;
+    reader->offsets[reader->object_count] = offset;
+    reader->object_count++;
+    increase_refcount(object);
+}
+
+
+/*
+ * Loads the objects in the buffer and returns the root with one
+ * reference held for the caller, or EMPTY_LIST if the data can't be
+ * used, which also sets FAILED unless it is NULL. Unless NATIVES is
+ * NULL, the prototypes get its entries as their native code; there
+ * must be one for every prototype.
+ */
+static objptr_t read_objects(const void *data, size_t size,
+                             const char *magic, enum object_file_kind kind,
+                             struct jit_code *natives,
+                             unsigned int native_count, bool *failed)
+{
+    struct object_reader reader;
+    unsigned char tag;
+    size_t offset;
+    objptr_t object, root;
+    unsigned int i;
+
+    reader.start = data;
+    reader.position = reader.start;
+    reader.end = reader.start + size;
+    reader.failed = false;
+    reader.failed = !read_header(&reader, magic);
+    reader.kind = kind;
+    reader.natives = natives;
+    reader.native_count = native_count;
+    reader.native_next = 0;
+    reader.objects = NULL;
+    reader.offsets = NULL;
+    reader.object_count = 0;
+    reader.object_alloc = 0;
+
+    // The offsets point behind the tags
+    while (read_bytes(&reader, &tag, 1) && tag != TAG_END) {
+        offset = reader.position - reader.start;
+        object = create_object(&reader, tag);
+        if (reader.failed) break;
+        add_object(&reader, object, offset);
+    }
+    root = read_reference(&reader);
+
+    for (i = 0; i < reader.object_count && !reader.failed; i++) {
+        reader.position = reader.start + reader.offsets[i] - 1;
+        read_bytes(&reader, &tag, 1);
+        fill_object(&reader, tag, reader.objects[i]);
+    }
+
+    if (natives != NULL && reader.native_next != native_count) {
+        reader.failed = true;
+    }
+    if (reader.failed) root = EMPTY_LIST;
+
+    // The table's reference to the root is handed to the caller
+    increase_refcount(root);
+    for (i = 0; i < reader.object_count; i++) {
+        decrease_refcount(reader.objects[i]);
+    }
+    free(reader.objects);
+    free(reader.offsets);
+
+    if (failed != NULL) *failed = reader.failed;
+    return root;
+}
+
+
+static objptr_t read_object_file(const char *path, const char *magic,
+                                 enum object_file_kind kind)
+{
+    struct stat info;
+    void *mapping;
+    int fd;
+    objptr_t root;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return EMPTY_LIST;
+
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        return EMPTY_LIST;
+    }
+
+    mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return EMPTY_LIST;
+
+    root = read_objects(mapping, info.st_size, magic, kind, NULL, 0, NULL);
+    munmap(mapping, info.st_size);
+
+    return root;
+}
+
+
+
+/*
+ * Compiled code
+ */
+
+
+bool write_bytecode_file(const char *path, objptr_t prototype)
+{
+    return write_object_file(path, BYTECODE_FILE_MAGIC, OBJECT_FILE_CODE, prototype);
+}
+
+
+/*
+ * Loads the prototype stored in the file and returns it with one
+ * reference held for the caller, or EMPTY_LIST if the file can't
+ * be used.
+ */
+static objptr_t check_prototype(objptr_t root)
+{
+    if (root != EMPTY_LIST && !is_of_type(root, &TYPE_CLOSURE_PROTOTYPE)) {
+        decrease_refcount(root);
+        return EMPTY_LIST;
+    }
+
+    return root;
+}
+
+
+objptr_t read_bytecode_file(const char *path)
+{
+    return check_prototype(read_object_file(path, BYTECODE_FILE_MAGIC, OBJECT_FILE_CODE));
+}
+
+
+/*
+ * Writes the prototype in the format of a compiled code file and
+ * returns the prototypes of the file in the order in which
+ * read_bytecode_memory() expects their native code. The caller
+ * frees the list.
+ */
+bool write_bytecode_stream(FILE *file, objptr_t prototype,
+                           objptr_t **prototypes, unsigned int *count)
+{
+    struct object_writer writer;
+    unsigned int i;
+
+    write_objects(&writer, file, BYTECODE_FILE_MAGIC, OBJECT_FILE_CODE, prototype);
+
+    *count = 0;
+    for (i = 0; i < writer.queue_count; i++) {
+        if (is_of_type(writer.queue[i], &TYPE_CLOSURE_PROTOTYPE)) {
+            writer.queue[(*count)++] = writer.queue[i];
+        }
+    }
+    *prototypes = writer.queue;
+
+    return !writer.failed;
+}
+
+
+/*
+ * Like read_bytecode_file(), for compiled code in memory. Unless
+ * NATIVES is NULL, it holds the native code of every prototype in
+ * the data, see write_bytecode_stream().
+ */
+objptr_t read_bytecode_memory(const void *data, size_t size,
+                              struct jit_code *natives,
+                              unsigned int native_count)
+{
+    return check_prototype(read_objects(data, size, BYTECODE_FILE_MAGIC,
+                                        OBJECT_FILE_CODE, natives, native_count,
+                                        NULL));
+}
+
+
+/*
+ * Compiles the first form of the source file and returns the
+ * resulting thunk's prototype with one reference held for the
+ * caller, or EMPTY_LIST if the file can't be read.
+ */
+objptr_t compile_source_to_prototype(const char *source)
+{
+    struct baby_reader reader;
+    bool fail;
+    objptr_t expr, thunk, prototype;
+
+    if (!open_file_reader(&reader, source)) return EMPTY_LIST;
+
+    expr = reader_read(&reader, &fail);
+    close_reader(&reader);
+    if (fail) return EMPTY_LIST;
+
+    increase_refcount(expr);
+    thunk = compile_to_thunk(expr, GLOBAL_ENVIRONMENT);
+    increase_refcount(thunk);
+    decrease_refcount(expr);
+    if (thunk == EMPTY_LIST) return EMPTY_LIST;
+
+    prototype = ((struct closure*) dereference(thunk))->prototype;
+    increase_refcount(prototype);
+    decrease_refcount(thunk);
+
+    return prototype;
+}
+
+
+/*
+ * Compiles the first form of the source file and stores the
+ * resulting thunk's prototype in the destination file.
+ */
+bool compile_file(const char *source, const char *destination)
+{
+    objptr_t prototype;
+    bool result;
+
+    prototype = compile_source_to_prototype(source);
+    if (prototype == EMPTY_LIST) return false;
+
+    result = write_bytecode_file(destination, prototype);
+    decrease_refcount(prototype);
+
+    return result;
+}
+
+
+
+/*
+ * Heap images
+ */
+
+
+bool write_image_file(const char *path)
+{
+    return write_object_file(path, IMAGE_FILE_MAGIC, OBJECT_FILE_IMAGE,
+                             GLOBAL_ENVIRONMENT);
+}
+
+
+/*
+ * Restores the global bindings stored in the image on top of the
+ * builtins. If loading fails half way, some bindings may already
+ * have been replaced.
+ */
+bool read_image_file(const char *path)
+{
+    objptr_t root;
+
+    root = read_object_file(path, IMAGE_FILE_MAGIC, OBJECT_FILE_IMAGE);
+    decrease_refcount(root);
+
+    return root == GLOBAL_ENVIRONMENT;
+}
+
+
+
+/*
+ * Fasl data
+ */
+
+
+static bool write_fully(int fd, const void *data, size_t size)
+{
+    ssize_t count;
+
+    while (size > 0) {
+        count = write(fd, data, size);
+        if (count < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        data = (const char*) data + count;
+        size -= count;
+    }
+
+    return true;
+}
+
+
+// Returns the number of bytes read, less than SIZE at the end
+static size_t read_fully(int fd, void *data, size_t size)
+{
+    size_t done;
+    ssize_t count;
+
+    for (done = 0; done < size; done += count) {
+        count = read(fd, (char*) data + done, size - done);
+        if (count == 0) break;
+        if (count < 0) {
+            if (errno != EINTR) break;
+            count = 0;
+        }
+    }
+
+    return done;
+}
+
+
+/*
+ * Writes the datum as one fasl message to the descriptor. The
+ * message is put together in memory first, so that it goes out in
+ * one piece with its frame in front.
+ */
+bool write_fasl(int fd, objptr_t datum)
+{
+    struct object_writer writer;
+    uint64_t size;
+    uint32_t count;
+    char *buffer;
+    size_t length;
+    FILE *file;
+
+    file = open_memstream(&buffer, &length);
+    if (file == NULL) return false;
+
+    // Room for the frame, which is filled in at the end
+    size = 0;
+    count = 0;
+    fwrite(&size, sizeof(size), 1, file);
+    fwrite(&count, sizeof(count), 1, file);
+
+    write_objects(&writer, file, FASL_MAGIC, OBJECT_FILE_DATA, datum);
+    free(writer.queue);
+    if (fclose(file) != 0) writer.failed = true;
+
+    if (!writer.failed) {
+        size = length - FASL_FRAME_SIZE;
+        count = writer.queue_count;
+        memcpy(buffer, &size, sizeof(size));
+        memcpy(buffer + sizeof(size), &count, sizeof(count));
+        writer.failed = !write_fully(fd, buffer, length);
+    }
+    free(buffer);
+
+    return !writer.failed;
+}
+
+
+/*
+ * Reads the next fasl message from the descriptor and returns its
+ * datum with one reference held for the caller. Sets FAIL at the end
+ * of the input and if the message can't be used.
+ */
+objptr_t read_fasl(int fd, bool *fail)
+{
+    unsigned char frame[FASL_FRAME_SIZE];
+    struct stat info;
+    uint64_t size;
+    uint32_t count;
+    off_t offset;
+    void *data;
+    objptr_t datum;
+
+    *fail = true;
+    if (read_fully(fd, frame, sizeof(frame)) != sizeof(frame)) return EMPTY_LIST;
+    memcpy(&size, frame, sizeof(size));
+    memcpy(&count, frame + sizeof(size), sizeof(count));
+
+    // Every record takes at least one byte
+    if (size > SIZE_MAX || count > size) return EMPTY_LIST;
+
+    // A file can't hold more than what is left of it
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+        offset = lseek(fd, 0, SEEK_CUR);
+        if (offset >= 0 && size > (uint64_t) (info.st_size - offset)) return EMPTY_LIST;
+    }
+
+    data = malloc(size);
+    if (data == NULL) return EMPTY_LIST;
+    if (read_fully(fd, data, size) != size) {
+        free(data);
+        return EMPTY_LIST;
+    }
+
+    // Take the heap cells for all objects at once
+    reserve_heap_slots(count);
+    datum = read_objects(data, size, FASL_MAGIC, OBJECT_FILE_DATA, NULL, 0, fail);
+    free(data);
+
+    return datum;
+}
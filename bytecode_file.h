@@ -0,0 +1,64 @@
+#pragma once
+
+#ifndef BYTECODE_FILE_H_
+#define BYTECODE_FILE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "object.h"
+
+struct jit_code;
+
+
+/*
+ * Compiled code files, heap images and fasl data
+ *
+ * A compiled code file holds a closure prototype together with
+ * everything its code refers to: constant vectors, nested
+ * prototypes, symbols, strings and quoted data.
+ *
+ * A heap image holds the global environment with everything that
+ * is reachable from it, such as closures and their environments.
+ * Builtins are stored by name and restored from the running
+ * process, so an image restores the state after loading a
+ * library without running it again.
+ *
+ * A fasl message holds a datum made of data only, for exchanging
+ * it with other processes or caching it. Shared and cyclic structure
+ * is kept, and each symbol is stored once per message. Messages are
+ * written to descriptors behind the size and count of their records,
+ * so that a reader takes one in at once and can make room for all
+ * of its objects up front.
+ *
+ * Code files and images store instructions as they are executed, so
+ * the version has to be bumped whenever the meaning of an opcode or
+ * the superinstruction table changes. All of them share the record
+ * format and its version. Data is stored in the byte order of the
+ * machine that wrote it; the header check rejects data from other
+ * byte orders.
+ */
+
+#define BYTECODE_FILE_MAGIC   "NILC"
+#define IMAGE_FILE_MAGIC      "NILI"
+#define FASL_MAGIC            "NILF"
+#define BYTECODE_FILE_VERSION 8
+
+
+bool write_bytecode_file(const char*, objptr_t);
+objptr_t read_bytecode_file(const char*);
+
+bool write_bytecode_stream(FILE*, objptr_t, objptr_t**, unsigned int*);
+objptr_t read_bytecode_memory(const void*, size_t, struct jit_code*, unsigned int);
+
+objptr_t compile_source_to_prototype(const char*);
+bool compile_file(const char*, const char*);
+
+bool write_image_file(const char*);
+bool read_image_file(const char*);
+
+bool write_fasl(int, objptr_t);
+objptr_t read_fasl(int, bool*);
+
+
+#endif
@@ -0,0 +1,376 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "bytevector.h"
+
+
+
+void init_bytevector(struct bytevector *vector)
+{
+    vector->is_read_only = false;
+    vector->data = NULL;
+    vector->length = 0;
+    vector->mapped_length = 0;
+    vector->owner = EMPTY_LIST;
+}
+
+
+void terminate_bytevector(struct bytevector *vector)
+{
+    if (vector->owner != EMPTY_LIST) {
+        decrease_refcount(vector->owner);
+    } else if (vector->mapped_length > 0) {
+        munmap(vector->data, vector->mapped_length);
+    } else {
+        free(vector->data);
+    }
+
+    vector->data = NULL;
+    vector->length = 0;
+    vector->mapped_length = 0;
+    vector->owner = EMPTY_LIST;
+}
+
+
+unsigned int bytevector_slot_count(struct bytevector *vector)
+{
+    return (vector->owner != EMPTY_LIST) ? 1 : 0;
+}
+
+
+objptr_t bytevector_slot_accessor(struct bytevector *vector, unsigned int slot)
+{
+    return (slot == 0) ? vector->owner : EMPTY_LIST;
+}
+
+
+bool bytevector_eqv(struct bytevector *v1,
+                    struct bytevector *v2,
+                    enum eqv_strictness strictness)
+{
+    switch (strictness) {
+    case EQV_STRICT: return v1 == v2;
+    case EQ_STRICT:
+        return (v1 == v2) || (v1->length == 0 && v2->length == 0);
+    case EQUAL_STRICT:
+        return (v1 == v2) ||
+            (v1->length == v2->length &&
+             memcmp(v1->data, v2->data, v1->length) == 0);
+    default: return false;
+    }
+}
+
+
+DEFTYPE(TYPE_BYTEVECTOR,
+        struct bytevector,
+        init_bytevector,
+        terminate_bytevector,
+        bytevector_slot_count,
+        bytevector_slot_accessor,
+        bytevector_eqv);
+
+
+
+static struct bytevector *bytevector_view(objptr_t ptr)
+{
+    if (!is_of_type(ptr, &TYPE_BYTEVECTOR)) return NULL;
+    return (struct bytevector*) dereference(ptr);
+}
+
+
+static bool is_valid_range(struct bytevector *vector, size_t start, size_t end)
+{
+    return vector != NULL && start <= end && end <= vector->length;
+}
+
+
+objptr_t make_bytevector(size_t length, unsigned char fill)
+{
+    objptr_t ptr;
+    struct bytevector *vector;
+
+    ptr = object_allocate(&TYPE_BYTEVECTOR);
+    if (ptr == EMPTY_LIST) return ptr;
+
+    vector = (struct bytevector*) dereference(ptr);
+    vector->data = malloc((length > 0) ? length : 1);
+    if (vector->data == NULL) {
+        // Frees the fresh bytevector
+        increase_refcount(ptr);
+        decrease_refcount(ptr);
+        return EMPTY_LIST;
+    }
+    vector->length = length;
+    memset(vector->data, fill, length);
+
+    return ptr;
+}
+
+
+objptr_t make_bytevector_from_bytes(const void *bytes, size_t length)
+{
+    objptr_t ptr;
+
+    ptr = make_bytevector(length, 0);
+    if (ptr != EMPTY_LIST) {
+        memcpy(bytevector_view(ptr)->data, bytes, length);
+    }
+
+    return ptr;
+}
+
+
+/*
+ * Returns a read-only bytevector of the contents of the file at
+ * PATH, or EMPTY_LIST if it can't be opened. The contents are
+ * mapped, so pages are only read when they are touched.
+ */
+objptr_t map_file_bytevector(const char *path)
+{
+    struct stat info;
+    struct bytevector *vector;
+    void *mapping;
+    objptr_t ptr;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return EMPTY_LIST;
+
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return EMPTY_LIST;
+    }
+
+    if (info.st_size == 0) {
+        // Empty files can't be mapped
+        close(fd);
+        ptr = make_bytevector(0, 0);
+        if (ptr != EMPTY_LIST) bytevector_view(ptr)->is_read_only = true;
+        return ptr;
+    }
+
+    mapping = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) return EMPTY_LIST;
+
+    ptr = object_allocate(&TYPE_BYTEVECTOR);
+    if (ptr == EMPTY_LIST) {
+        munmap(mapping, info.st_size);
+        return ptr;
+    }
+
+    vector = (struct bytevector*) dereference(ptr);
+    vector->is_read_only = true;
+    vector->data = mapping;
+    vector->length = info.st_size;
+    vector->mapped_length = info.st_size;
+
+    return ptr;
+}
+
+
+objptr_t bytevector_copy(objptr_t ptr, size_t start, size_t end)
+{
+    struct bytevector *vector;
+
+    vector = bytevector_view(ptr);
+    if (!is_valid_range(vector, start, end)) return EMPTY_LIST;  // TODO: Error?
+
+    return make_bytevector_from_bytes(vector->data + start, end - start);
+}
+
+
+/*
+ * Returns a bytevector sharing the bytes from START to END of the
+ * storage of PTR. Slices of slices refer to the owner directly.
+ */
+objptr_t bytevector_slice(objptr_t ptr, size_t start, size_t end)
+{
+    objptr_t slice, owner;
+    struct bytevector *vector, *result;
+
+    vector = bytevector_view(ptr);
+    if (!is_valid_range(vector, start, end)) return EMPTY_LIST;  // TODO: Error?
+
+    owner = (vector->owner != EMPTY_LIST) ? vector->owner : ptr;
+
+    slice = object_allocate(&TYPE_BYTEVECTOR);
+    if (slice == EMPTY_LIST) return slice;
+
+    result = (struct bytevector*) dereference(slice);
+    result->is_read_only = vector->is_read_only;
+    result->data = vector->data + start;
+    result->length = end - start;
+    result->owner = owner;
+    increase_refcount(owner);
+
+    return slice;
+}
+
+
+bool is_bytevector(objptr_t ptr)
+{
+    return is_of_type(ptr, &TYPE_BYTEVECTOR);
+}
+
+
+bool bytevector_is_read_only(objptr_t ptr)
+{
+    struct bytevector *vector;
+
+    vector = bytevector_view(ptr);
+    return vector != NULL && vector->is_read_only;
+}
+
+
+size_t bytevector_length(objptr_t ptr)
+{
+    struct bytevector *vector;
+
+    vector = bytevector_view(ptr);
+    return (vector != NULL) ? vector->length : 0;
+}
+
+
+/*
+ * Returns the byte at INDEX, or -1 if there is none.
+ */
+int bytevector_ref(objptr_t ptr, size_t index)
+{
+    struct bytevector *vector;
+
+    vector = bytevector_view(ptr);
+    if (vector == NULL || index >= vector->length) return -1;
+
+    return vector->data[index];
+}
+
+
+/*
+ * Stores the byte, and returns false if the bytevector is read-only
+ * or the index is out of range.
+ */
+bool bytevector_set(objptr_t ptr, size_t index, unsigned char byte)
+{
+    struct bytevector *vector;
+
+    vector = bytevector_view(ptr);
+    if (vector == NULL || vector->is_read_only || index >= vector->length) {
+        return false;
+    }
+
+    vector->data[index] = byte;
+    return true;
+}
+
+
+/*
+ * Copies the bytes from START to END of FROM to TO at AT. The
+ * ranges may overlap.
+ */
+bool bytevector_copy_range(objptr_t to, size_t at,
+                           objptr_t from, size_t start, size_t end)
+{
+    struct bytevector *target, *source;
+
+    target = bytevector_view(to);
+    source = bytevector_view(from);
+    if (!is_valid_range(source, start, end) ||
+        target == NULL || target->is_read_only ||
+        at > target->length || end - start > target->length - at) {
+        return false;  // TODO: Error?
+    }
+
+    memmove(target->data + at, source->data + start, end - start);
+    return true;
+}
+
+
+
+/*
+ * File I/O
+ *
+ * Reading repeats until the range is full or the end of the file is
+ * reached, writing until the whole range is written.
+ */
+
+
+ssize_t bytevector_read(int fd, objptr_t ptr, size_t start, size_t end)
+{
+    struct bytevector *vector;
+    size_t done;
+    ssize_t count;
+
+    vector = bytevector_view(ptr);
+    if (!is_valid_range(vector, start, end) || vector->is_read_only) return -1;
+
+    for (done = 0; start + done < end; done += count) {
+        count = read(fd, vector->data + start + done, end - start - done);
+        if (count == 0) break;
+        if (count < 0) {
+            if (errno == EINTR) {
+                count = 0;
+                continue;
+            }
+            return -1;
+        }
+    }
+
+    return done;
+}
+
+
+ssize_t bytevector_pread(int fd, objptr_t ptr, off_t offset,
+                         size_t start, size_t end)
+{
+    struct bytevector *vector;
+    size_t done;
+    ssize_t count;
+
+    vector = bytevector_view(ptr);
+    if (!is_valid_range(vector, start, end) || vector->is_read_only) return -1;
+
+    for (done = 0; start + done < end; done += count) {
+        count = pread(fd, vector->data + start + done, end - start - done,
+                      offset + done);
+        if (count == 0) break;
+        if (count < 0) {
+            if (errno == EINTR) {
+                count = 0;
+                continue;
+            }
+            return -1;
+        }
+    }
+
+    return done;
+}
+
+
+ssize_t bytevector_write(int fd, objptr_t ptr, size_t start, size_t end)
+{
+    struct bytevector *vector;
+    size_t done;
+    ssize_t count;
+
+    vector = bytevector_view(ptr);
+    if (!is_valid_range(vector, start, end)) return -1;
+
+    for (done = 0; start + done < end; done += count) {
+        count = write(fd, vector->data + start + done, end - start - done);
+        if (count < 0) {
+            if (errno == EINTR) {
+                count = 0;
+                continue;
+            }
+            return -1;
+        }
+    }
+
+    return done;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#ifndef BYTEVECTOR_H_
+#define BYTEVECTOR_H_
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#include "object.h"
+
+
+/*
+ * Bytevectors
+ *
+ * A bytevector either owns its storage, which is malloc()ed or a
+ * read-only mapping of a file, or is a slice of the storage of an
+ * owning bytevector, which it keeps alive through its slot.
+ *
+ * The file functions transfer bytes directly between a descriptor
+ * and the storage. They return the number of bytes transferred, or
+ * -1 on errors and for invalid ranges.
+ */
+
+struct bytevector {
+    struct object head;
+    bool is_read_only;
+    unsigned char *data;
+    size_t length;
+    size_t mapped_length;  // Nonzero if DATA is a mapping to unmap
+    objptr_t owner;        // The bytevector owning DATA, for slices
+};
+
+
+extern struct object_type TYPE_BYTEVECTOR;
+
+
+objptr_t make_bytevector(size_t, unsigned char);
+objptr_t make_bytevector_from_bytes(const void*, size_t);
+objptr_t map_file_bytevector(const char*);
+objptr_t bytevector_copy(objptr_t, size_t, size_t);
+objptr_t bytevector_slice(objptr_t, size_t, size_t);
+
+bool is_bytevector(objptr_t);
+bool bytevector_is_read_only(objptr_t);
+size_t bytevector_length(objptr_t);
+int bytevector_ref(objptr_t, size_t);
+bool bytevector_set(objptr_t, size_t, unsigned char);
+bool bytevector_copy_range(objptr_t, size_t, objptr_t, size_t, size_t);
+
+ssize_t bytevector_read(int, objptr_t, size_t, size_t);
+ssize_t bytevector_pread(int, objptr_t, off_t, size_t, size_t);
+ssize_t bytevector_write(int, objptr_t, size_t, size_t);
+
+
+#endif
@@ -1,8 +1,17 @@
 #include <assert.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
+#include "builtins.h"
+#include "character.h"
 #include "closure.h"
+#include "environment.h"
+#include "jit.h"
+#include "number.h"
+#include "optimizer.h"
+#include "primitive.h"
+#include "string_object.h"
 #include "symbol.h"
 #include "pair.h"
 #include "vector.h"
@@ -23,7 +32,7 @@ unsigned int code_push_instruction(struct code *code,
 
     assert(code != NULL);
     
-    if (code->code_alloc >= code->code_size) {        
+    if (code->code_size >= code->code_alloc) {
         if (code->code_alloc == 0) {
             new_alloc = 8;
         } else {
@@ -58,9 +67,284 @@ void code_set_instruction(struct code *code,
 }
 
 
+/*
+ * Constant indexes
+ *
+ * Open addressing hash tables from constants to their position
+ * in a constant vector. A slot holds the position plus one, zero
+ * marks free slots. The tables are kept at most half full.
+ */
+
+
+static unsigned int hash_bytes(const void *data, size_t size, unsigned int hash)
+{
+    const unsigned char *bytes;
+    size_t i;
+
+    // FNV-1a
+    bytes = data;
+    for (i = 0; i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+
+    return hash;
+}
+
+
+static unsigned int constant_hash(objptr_t constant)
+{
+    unsigned int hash;
+    unichar_t code;
+    struct number *number, buffer;
+    struct vector *vector;
+
+    /*
+     * Constants which are eqv(..., EQ_STRICT) must get the same
+     * hash: numbers and characters are compared by value and all
+     * empty vectors are the same. Strings are hashed by content
+     * for the constant pool.
+     */
+    hash = 2166136261u;
+
+    if (is_of_type(constant, &TYPE_NUMBER)) {
+        number = number_view(constant, &buffer);
+        hash = hash_bytes(&(number->type), sizeof(number->type), hash);
+        switch (number->type) {
+        case NUMBER_INTEGER:
+            return hash_bytes(&(number->value.integer),
+                              sizeof(number->value.integer), hash);
+        case NUMBER_RATIONAL:
+            return hash_bytes(&(number->value.rational),
+                              sizeof(number->value.rational), hash);
+        case NUMBER_REAL:
+            return hash_bytes(&(number->value.real),
+                              sizeof(number->value.real), hash);
+        case NUMBER_COMPLEX:
+            return hash_bytes(&(number->value.complex),
+                              sizeof(number->value.complex), hash);
+        case NUMBER_BIGNUM:
+            hash = hash_bytes(&(number->value.bignum.negative),
+                              sizeof(number->value.bignum.negative), hash);
+            return hash_bytes(number->value.bignum.limbs,
+                              number->value.bignum.length * sizeof(limb_t), hash);
+        case NUMBER_BIG_RATIONAL:
+            hash = hash_bytes(&(number->value.big_rational.negative),
+                              sizeof(number->value.big_rational.negative), hash);
+            hash = hash_bytes(number->value.big_rational.numerator,
+                              number->value.big_rational.numerator_length
+                              * sizeof(limb_t), hash);
+            return hash_bytes(number->value.big_rational.denominator,
+                              number->value.big_rational.denominator_length
+                              * sizeof(limb_t), hash);
+        }
+    } else if (is_of_type(constant, &TYPE_CHARACTER)) {
+        code = character_value(constant);
+        return hash_bytes(&code, sizeof(code), hash);
+    } else if (is_of_type(constant, &TYPE_STRING)) {
+        return string_hash(constant);
+    } else if (is_of_type(constant, &TYPE_VECTOR)) {
+        vector = (struct vector*) dereference(constant);
+        if (vector->member_count == 0) {
+            return hash;
+        }
+    }
+
+    return hash_bytes(&constant, sizeof(constant), hash);
+}
+
+
+/*
+ * eqv() compares reals by value, but constants like 0.0 and -0.0
+ * must stay apart, so their bits have to match too.
+ */
+static bool is_same_constant(objptr_t constant,
+                             objptr_t other,
+                             enum eqv_strictness strictness)
+{
+    struct number *number, buffer;
+    struct number *other_number, other_buffer;
+
+    if (!eqv(constant, other, strictness)) return false;
+    if (!is_of_type(constant, &TYPE_NUMBER) || !is_of_type(other, &TYPE_NUMBER)) {
+        return true;
+    }
+
+    number = number_view(constant, &buffer);
+    other_number = number_view(other, &other_buffer);
+    if (number->type != other_number->type) return true;
+
+    switch (number->type) {
+    case NUMBER_REAL:
+        return memcmp(&(number->value.real), &(other_number->value.real),
+                      sizeof(number->value.real)) == 0;
+    case NUMBER_COMPLEX:
+        return memcmp(&(number->value.complex), &(other_number->value.complex),
+                      sizeof(number->value.complex)) == 0;
+    default:
+        return true;
+    }
+}
+
+
+static unsigned int constant_index_lookup(unsigned int *index,
+                                          unsigned int index_size,
+                                          objptr_t vector,
+                                          objptr_t constant,
+                                          enum eqv_strictness strictness)
+{
+    unsigned int slot;
+
+    /*
+     * Returns the slot holding CONSTANT, or the free slot where
+     * it belongs.
+     */
+    for (slot = constant_hash(constant) & (index_size - 1);
+         index[slot] != 0;
+         slot = (slot + 1) & (index_size - 1))
+    {
+        if (is_same_constant(vector_get(vector, index[slot] - 1), constant, strictness)) {
+            break;
+        }
+    }
+
+    return slot;
+}
+
+
+/*
+ * Returns an index with room for one more constant of VECTOR, or NULL
+ * if there's no memory for it.
+ */
+static unsigned int *constant_index_reserve(unsigned int *index,
+                                            unsigned int *index_size,
+                                            objptr_t vector,
+                                            enum eqv_strictness strictness)
+{
+    unsigned int i;
+    unsigned int count;
+
+    count = (vector == EMPTY_LIST) ? 0 : vector_length(vector);
+    if ((index != NULL) && (2 * (count + 1) <= *index_size)) {
+        return index;
+    }
+
+    /*
+     * Rebuild the index from the vector with twice the size
+     */
+    free(index);
+    *index_size = (*index_size == 0) ? 64 : *index_size * 2;
+    while (*index_size < 2 * (count + 1))
+    {
+        *index_size *= 2;
+    }
+    index = calloc(*index_size, sizeof(unsigned int));
+    if (index == NULL) {
+        *index_size = 0;
+        return NULL;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        index[constant_index_lookup(index,
+                                    *index_size,
+                                    vector,
+                                    vector_get(vector, i),
+                                    strictness)] = i + 1;
+    }
+
+    return index;
+}
+
+
+
+/*
+ * Constant pool
+ *
+ * Immutable literals which are equal in content are shared by all
+ * prototypes of a compilation unit, so each one is only kept once.
+ * Symbols don't need this, they are unique already. The pool is
+ * emptied after each unit, so that it doesn't keep the literals of
+ * code which is gone.
+ */
+
+
+static objptr_t CONSTANT_POOL;
+static unsigned int *CONSTANT_POOL_INDEX = NULL;
+static unsigned int CONSTANT_POOL_INDEX_SIZE = 0;
+
+
+static bool is_pooled_constant(objptr_t constant)
+{
+    return is_of_type(constant, &TYPE_NUMBER)
+        || is_of_type(constant, &TYPE_STRING);
+}
+
+
+static objptr_t pool_constant(objptr_t constant)
+{
+    unsigned int slot;
+
+    if ((CONSTANT_POOL == EMPTY_LIST) || !is_pooled_constant(constant)) {
+        return constant;
+    }
+
+    CONSTANT_POOL_INDEX = constant_index_reserve(CONSTANT_POOL_INDEX,
+                                                 &CONSTANT_POOL_INDEX_SIZE,
+                                                 CONSTANT_POOL,
+                                                 EQUAL_STRICT);
+    // Without an index, the constant just isn't shared
+    if (CONSTANT_POOL_INDEX == NULL) return constant;
+
+    slot = constant_index_lookup(CONSTANT_POOL_INDEX,
+                                 CONSTANT_POOL_INDEX_SIZE,
+                                 CONSTANT_POOL,
+                                 constant,
+                                 EQUAL_STRICT);
+
+    if (CONSTANT_POOL_INDEX[slot] != 0) {
+        return vector_get(CONSTANT_POOL, CONSTANT_POOL_INDEX[slot] - 1);
+    }
+
+    vector_append(CONSTANT_POOL, constant);
+    CONSTANT_POOL_INDEX[slot] = vector_length(CONSTANT_POOL);
+
+    return constant;
+}
+
+
+static void clear_constant_pool()
+{
+    if (CONSTANT_POOL == EMPTY_LIST) return;
+
+    vector_remove_range(CONSTANT_POOL, 0, vector_length(CONSTANT_POOL));
+    free(CONSTANT_POOL_INDEX);
+    CONSTANT_POOL_INDEX = NULL;
+    CONSTANT_POOL_INDEX_SIZE = 0;
+}
+
+
+void init_constant_pool()
+{
+    CONSTANT_POOL = make_vector(EMPTY_LIST, 0);
+    declare_root_object(CONSTANT_POOL);
+    make_refcount_immune(CONSTANT_POOL);
+}
+
+
+void terminate_constant_pool()
+{
+    CONSTANT_POOL = EMPTY_LIST;
+    free(CONSTANT_POOL_INDEX);
+    CONSTANT_POOL_INDEX = NULL;
+    CONSTANT_POOL_INDEX_SIZE = 0;
+}
+
+
+
 unsigned int code_add_constant(struct code *code, objptr_t constant)
 {
-    int i;
+    unsigned int slot;
     unsigned int pos;
     
     assert(code != NULL);
@@ -70,27 +354,59 @@ unsigned int code_add_constant(struct code *code, objptr_t constant)
         // FIXME: Handle allocation failures
     }
 
+    constant = pool_constant(constant);
+
     /*
      * Check whether the constant is already present
      * in the constant vector. If it is, return its
      * index instead of creating a new one.
      */
-    for (i = vector_length(code->constant_vector) - 1; i >= 0; i--)
-    {
-        if (eqv(vector_get(code->constant_vector, i),
-                constant,
-                EQ_STRICT)) {
-            return i;
+    code->constant_index = constant_index_reserve(code->constant_index,
+                                                  &(code->constant_index_size),
+                                                  code->constant_vector,
+                                                  EQ_STRICT);
+    if (code->constant_index == NULL) {
+        // Without an index, the vector is searched
+        for (pos = 0; pos < vector_length(code->constant_vector); pos++)
+        {
+            if (is_same_constant(vector_get(code->constant_vector, pos),
+                                 constant, EQ_STRICT)) {
+                return pos;
+            }
         }
+        vector_append(code->constant_vector, constant);
+        return pos;
+    }
+
+    slot = constant_index_lookup(code->constant_index,
+                                 code->constant_index_size,
+                                 code->constant_vector,
+                                 constant,
+                                 EQ_STRICT);
+    if (code->constant_index[slot] != 0) {
+        return code->constant_index[slot] - 1;
     }
     
     pos = vector_length(code->constant_vector);
     vector_append(code->constant_vector, constant);
+    code->constant_index[slot] = pos + 1;
 
     return pos;
 }
 
 
+void code_drop_constant_index(struct code *code)
+{
+    /*
+     * The index is only needed while compiling, it is
+     * rebuilt if more constants are added later.
+     */
+    free(code->constant_index);
+    code->constant_index = NULL;
+    code->constant_index_size = 0;
+}
+
+
 unsigned int code_get_write_location(struct code *code)
 {
     assert(code != NULL);
@@ -101,9 +417,13 @@ unsigned int code_get_write_location(struct code *code)
 void init_code(struct code *code)
 {
     code->constant_vector = EMPTY_LIST;
+    code->constant_index = NULL;
+    code->constant_index_size = 0;
     code->code_size = 0;
     code->code_alloc = 0;
     code->codes = NULL;
+    code->call_count = 0;
+    code->native = NULL;
 }
 
 
@@ -112,9 +432,13 @@ void init_code_by_copy(struct code *dest, struct code *src)
     assert(dest != NULL && src != NULL);
     dest->constant_vector = src->constant_vector;
     increase_refcount(dest->constant_vector);
+    dest->constant_index = NULL;
+    dest->constant_index_size = 0;
     dest->code_size = src->code_size;
     dest->code_alloc = src->code_alloc;
     dest->codes = NULL;  // XXX: How do we handle this?
+    dest->call_count = 0;
+    dest->native = NULL;
 }
 
 
@@ -122,6 +446,8 @@ void terminate_code(struct code *code)
 {
     decrease_refcount(code->constant_vector);
     code->constant_vector = EMPTY_LIST;
+    code_drop_constant_index(code);
+    jit_free(code);
     
     if (code->codes != NULL) {
 	free(code->codes);
@@ -132,22 +458,291 @@ void terminate_code(struct code *code)
 
 
 
+/*
+ * Compile-time scopes
+ *
+ * The compiler keeps track of the variables bound by the
+ * lambdas it is currently compiling. This tells it whether
+ * a symbol may refer to a binding of the global environment.
+ *
+ * Variables bound by LET and friends live in the environment
+ * of the enclosing lambda. They are bound to gensyms there, so
+ * they can't clash with other variables of the same name.
+ */
+
+
+struct scope_variable {
+    objptr_t name;
+    objptr_t key;  // Symbol the variable is bound to at runtime
+};
+
+
+/*
+ * A named LET whose name is only called in tail positions is
+ * compiled into a loop: the calls rebind the loop variables in
+ * place and jump back to the start of the body.
+ */
+struct loop {
+    struct loop *parent;
+    objptr_t key;       // Key of the loop's name, which is never bound
+    bool in_tail;       // The loop is in a tail position of its parent
+    bool returns;       // Tail positions of the loop return from the lambda
+    unsigned int start;
+
+    unsigned int variable_count;
+    objptr_t *variables;  // Keys of the loop variables
+};
+
+
+struct scope {
+    struct scope *parent;
+    bool global;  // Free variables are looked up in GLOBAL_ENVIRONMENT
+
+    // Name of the lambda for self tail calls, EMPTY_LIST if none
+    objptr_t self_name;
+    unsigned int self_parameter_count;
+
+    struct loop *loop;  // Innermost loop being compiled, or NULL
+
+    unsigned int variable_count;
+    unsigned int variable_alloc;
+    struct scope_variable *variables;
+
+    bool failed;  // Out of memory, only set in the outermost scope
+};
+
+
+static void scope_init(struct scope *scope, struct scope *parent, bool global)
+{
+    scope->parent = parent;
+    scope->global = global;
+    scope->self_name = EMPTY_LIST;
+    scope->self_parameter_count = 0;
+    scope->loop = NULL;
+    scope->variable_count = 0;
+    scope->variable_alloc = 0;
+    scope->variables = NULL;
+    scope->failed = false;
+}
+
+
+static void scope_fail(struct scope *scope)
+{
+    while (scope->parent != NULL)
+    {
+        scope = scope->parent;
+    }
+    scope->failed = true;
+}
+
+
+static void scope_truncate(struct scope *scope, unsigned int variable_count)
+{
+    while (scope->variable_count > variable_count)
+    {
+        scope->variable_count--;
+        if (scope->variables[scope->variable_count].key
+            != scope->variables[scope->variable_count].name) {
+            decrease_refcount(scope->variables[scope->variable_count].key);
+        }
+    }
+}
+
+
+static void scope_terminate(struct scope *scope)
+{
+    scope_truncate(scope, 0);
+    if (scope->variables != NULL) {
+        free(scope->variables);
+        scope->variables = NULL;
+    }
+    scope->variable_alloc = 0;
+}
+
+
+static void scope_bind(struct scope *scope, objptr_t name, objptr_t key)
+{
+    struct scope_variable *variables;
+    unsigned int alloc;
+
+    if (scope->variable_count >= scope->variable_alloc) {
+        alloc = (scope->variable_alloc == 0) ? 8 : scope->variable_alloc * 2;
+        variables = realloc(scope->variables, alloc * sizeof(struct scope_variable));
+        if (variables == NULL) {
+            scope_fail(scope);
+            return;
+        }
+        scope->variables = variables;
+        scope->variable_alloc = alloc;
+    }
+
+    scope->variables[scope->variable_count].name = name;
+    scope->variables[scope->variable_count].key = key;
+    scope->variable_count++;
+}
+
+
+static void scope_add_variable(struct scope *scope, objptr_t variable)
+{
+    scope_bind(scope, variable, variable);
+}
+
+
+static objptr_t scope_add_renamed_variable(struct scope *scope, objptr_t variable)
+{
+    objptr_t key;
+
+    key = gensym(variable);
+    increase_refcount(key);
+    scope_bind(scope, variable, key);
+
+    return key;
+}
+
+
+static void scope_add_definitions(struct scope *scope, objptr_t body, bool rename)
+{
+    objptr_t expr;
+    objptr_t target;
+
+    /*
+     * Internal definitions bind in the environment of the
+     * lambda, so they shadow outer variables for the whole body.
+     */
+    for (; is_of_type(body, &TYPE_PAIR); body = get_cdr(body))
+    {
+        expr = get_car(body);
+        if (!is_of_type(expr, &TYPE_PAIR)) {
+            continue;
+        }
+
+        if (get_car(expr) == SYMBOL_DEFINE) {
+            target = get_car(get_cdr(expr));
+            if (is_of_type(target, &TYPE_PAIR)) {
+                target = get_car(target);
+            }
+            if (!is_of_type(target, &TYPE_SYMBOL)) {
+                continue;
+            }
+            if (rename) {
+                scope_add_renamed_variable(scope, target);
+            } else {
+                scope_add_variable(scope, target);
+            }
+        } else if (get_car(expr) == SYMBOL_BEGIN) {
+            scope_add_definitions(scope, get_cdr(expr), rename);
+        }
+    }
+}
+
+
+static struct scope_variable *scope_find_local(struct scope *scope,
+                                               objptr_t variable)
+{
+    unsigned int i;
+
+    // Search backwards, inner bindings shadow outer ones
+    for (i = scope->variable_count; i > 0; i--)
+    {
+        if (scope->variables[i - 1].name == variable) {
+            return &(scope->variables[i - 1]);
+        }
+    }
+
+    return NULL;
+}
+
+
+static bool scope_binds_locally(struct scope *scope, objptr_t variable)
+{
+    return scope_find_local(scope, variable) != NULL;
+}
+
+
+static objptr_t scope_resolve(struct scope *scope, objptr_t variable)
+{
+    struct scope_variable *binding;
+
+    for (; scope != NULL; scope = scope->parent)
+    {
+        binding = scope_find_local(scope, variable);
+        if (binding != NULL) {
+            return binding->key;
+        }
+    }
+
+    return variable;
+}
+
+
+static bool scope_refers_to_global(struct scope *scope, objptr_t variable)
+{
+    for (; scope != NULL; scope = scope->parent)
+    {
+        if (scope_binds_locally(scope, variable)) {
+            return false;
+        }
+
+        if (scope->parent == NULL) {
+            return scope->global;
+        }
+    }
+
+    return false;
+}
+
+
+static bool scope_has_frame(struct scope *scope)
+{
+    /*
+     * Only lambdas get an environment of their own, top-level
+     * code runs directly in the environment it was compiled for.
+     */
+    return scope->parent != NULL;
+}
+
+
+static struct loop *scope_find_loop(struct scope *scope, objptr_t key)
+{
+    struct loop *loop;
+
+    for (loop = scope->loop; loop != NULL; loop = loop->parent)
+    {
+        if (loop->key == key) {
+            return loop;
+        }
+    }
+
+    return NULL;
+}
+
+
+static bool scope_returns(struct scope *scope, bool enable_tailcall)
+{
+    // Tail positions in loop bodies are only tail positions of the loop
+    return enable_tailcall && ((scope->loop == NULL) || scope->loop->returns);
+}
+
+
+
+
 /*
  * Compiler
  */
 
 
-static void compile_expression(objptr_t, struct code*, bool, bool);
+static void compile_expression(objptr_t, struct code*, struct scope*, bool, bool);
 
 static unsigned int compile_parameter_list(objptr_t params,
                                            struct code *code,
+                                           struct scope *scope,
                                            bool leave_returns)
 {
     unsigned int param_count;
     
     for (param_count = 0; is_of_type(params, &TYPE_PAIR); param_count++)
     {
-        compile_expression(get_car(params), code, false, true);
+        compile_expression(get_car(params), code, scope, false, true);
         params = get_cdr(params);
     }
 
@@ -157,6 +752,7 @@ static unsigned int compile_parameter_list(objptr_t params,
 
 static void compile_begin(objptr_t expr_list,
                           struct code *code,
+                          struct scope *scope,
                           bool enable_tailcall,
                           bool leave_returns)
 {
@@ -168,7 +764,7 @@ static void compile_begin(objptr_t expr_list,
              * block, so we have to tell the compiler to drop
              * all return values.
              */
-            compile_expression(get_car(expr_list), code, false, false);
+            compile_expression(get_car(expr_list), code, scope, false, false);
         } else {
             /*
              * This is the last element in the block, so we can
@@ -176,6 +772,7 @@ static void compile_begin(objptr_t expr_list,
              */
             compile_expression(get_car(expr_list),
                                code,
+                               scope,
                                enable_tailcall,
                                leave_returns);
         }
@@ -184,30 +781,575 @@ static void compile_begin(objptr_t expr_list,
 }
 
 
-static objptr_t compile_lambda_prototype(objptr_t params, objptr_t body)
+static unsigned int list_length(objptr_t list)
+{
+    unsigned int length;
+
+    for (length = 0; is_of_type(list, &TYPE_PAIR); length++)
+    {
+        list = get_cdr(list);
+    }
+
+    return length;
+}
+
+
+static bool loop_is_in_place(objptr_t, objptr_t, objptr_t);
+
+static bool creates_closures(objptr_t expr)
+{
+    objptr_t car;
+
+    if (!is_of_type(expr, &TYPE_PAIR)) {
+        return false;
+    }
+
+    car = get_car(expr);
+    if (car == SYMBOL_QUOTE) {
+        return false;
+    } else if (car == SYMBOL_LAMBDA) {
+        return true;
+    } else if ((car == SYMBOL_DEFINE)
+               && is_of_type(get_car(get_cdr(expr)), &TYPE_PAIR)) {
+        return true;
+    } else if ((car == SYMBOL_LET)
+               && is_of_type(get_car(get_cdr(expr)), &TYPE_SYMBOL)
+               && !loop_is_in_place(get_car(get_cdr(expr)),
+                                    get_car(get_cdr(get_cdr(expr))),
+                                    get_cdr(get_cdr(get_cdr(expr))))) {
+        // Named LETs which aren't loops become procedures
+        return true;
+    }
+
+    for (; is_of_type(expr, &TYPE_PAIR); expr = get_cdr(expr))
+    {
+        if (creates_closures(get_car(expr))) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+static bool calls_only_in_tail(objptr_t, objptr_t, unsigned int, bool);
+
+static bool body_calls_only_in_tail(objptr_t body,
+                                    objptr_t name,
+                                    unsigned int argument_count,
+                                    bool tail)
+{
+    for (; is_of_type(body, &TYPE_PAIR); body = get_cdr(body))
+    {
+        if (!calls_only_in_tail(get_car(body),
+                                name,
+                                argument_count,
+                                tail && !is_of_type(get_cdr(body), &TYPE_PAIR))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static bool bindings_avoid(objptr_t bindings, objptr_t name)
+{
+    objptr_t binding;
+
+    /*
+     * Checks LET and DO bindings: NAME must neither be rebound
+     * nor used in the initializers or steps.
+     */
+    for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+    {
+        binding = get_car(bindings);
+        if (get_car(binding) == name
+            || !body_calls_only_in_tail(get_cdr(binding), name, 0, false)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+static bool calls_only_in_tail(objptr_t expr,
+                               objptr_t name,
+                               unsigned int argument_count,
+                               bool tail)
+/*
+ * Checks whether NAME only occurs as the operator of calls with
+ * ARGUMENT_COUNT arguments in tail positions of EXPR. Rebinding
+ * NAME anywhere counts as a failure, which is conservative.
+ */
+{
+    objptr_t car;
+    objptr_t cdr;
+
+    if (expr == name) {
+        return false;
+    } else if (!is_of_type(expr, &TYPE_PAIR)) {
+        return true;
+    }
+
+    car = get_car(expr);
+    cdr = get_cdr(expr);
+
+    if (car == SYMBOL_QUOTE) {
+        return true;
+
+    } else if (car == SYMBOL_IF) {
+        return calls_only_in_tail(get_car(cdr), name, argument_count, false)
+            && calls_only_in_tail(get_car(get_cdr(cdr)),
+                                  name, argument_count, tail)
+            && calls_only_in_tail(get_car(get_cdr(get_cdr(cdr))),
+                                  name, argument_count, tail);
+
+    } else if (car == SYMBOL_BEGIN) {
+        return body_calls_only_in_tail(cdr, name, argument_count, tail);
+
+    } else if ((car == SYMBOL_LET)
+               || (car == SYMBOL_LETSTAR)
+               || (car == SYMBOL_LETREC)) {
+        if ((car == SYMBOL_LET) && is_of_type(get_car(cdr), &TYPE_SYMBOL)) {
+            if (get_car(cdr) == name) {
+                return false;
+            }
+            cdr = get_cdr(cdr);
+        }
+        return bindings_avoid(get_car(cdr), name)
+            && body_calls_only_in_tail(get_cdr(cdr), name, argument_count, tail);
+
+    } else if (car == SYMBOL_DO) {
+        return bindings_avoid(get_car(cdr), name)
+            && calls_only_in_tail(get_car(get_car(get_cdr(cdr))),
+                                  name, argument_count, false)
+            && body_calls_only_in_tail(get_cdr(get_car(get_cdr(cdr))),
+                                       name, argument_count, tail)
+            && body_calls_only_in_tail(get_cdr(get_cdr(cdr)),
+                                       name, argument_count, false);
+
+    } else if (car == name) {
+        return tail
+            && (list_length(cdr) == argument_count)
+            && body_calls_only_in_tail(cdr, name, argument_count, false);
+
+    } else {
+        return body_calls_only_in_tail(expr, name, argument_count, false);
+    }
+}
+
+
+static bool loop_is_in_place(objptr_t name, objptr_t bindings, objptr_t body)
+{
+    return !creates_closures(body)
+        && body_calls_only_in_tail(body, name, list_length(bindings), true);
+}
+
+
+static objptr_t compile_lambda_prototype(objptr_t params,
+                                         objptr_t body,
+                                         struct scope *parent,
+                                         objptr_t name)
 {
     objptr_t func;
     struct closure_prototype *instance;
+    struct scope scope;
+    unsigned int param_count;
     
     func = make_closure_prototype(params);
 
     if (func != EMPTY_LIST) {
+        scope_init(&scope, parent, false);
+        for (param_count = 0; is_of_type(params, &TYPE_PAIR); param_count++)
+        {
+            scope_add_variable(&scope, get_car(params));
+            params = get_cdr(params);
+        }
+        if (is_of_type(params, &TYPE_SYMBOL)) {
+            scope_add_variable(&scope, params);
+        }
+        scope_add_definitions(&scope, body, false);
+
+        /*
+         * Tail calls of the lambda's own name may reuse the
+         * environment of the running call, unless the body
+         * creates closures which might have captured it.
+         */
+        if ((name != EMPTY_LIST)
+            && (params == EMPTY_LIST)
+            && !scope_binds_locally(&scope, name)
+            && !creates_closures(body)) {
+            scope.self_name = name;
+            scope.self_parameter_count = param_count;
+        }
+
         instance = (struct closure_prototype*) dereference(func);
-        compile_begin(body, &(instance->code), true, true);
+        compile_begin(body, &(instance->code), &scope, true, true);
+        optimize_code(&(instance->code));
+        code_drop_constant_index(&(instance->code));
+
+        scope_terminate(&scope);
     }
 
     return func;
 }
 
 
+static unsigned int inline_opcode(objptr_t operator,
+                                  unsigned int operand_count,
+                                  struct scope *scope)
+{
+    /*
+     * Calls to some builtins have dedicated opcodes. They can
+     * only be used when the operator is a global variable that
+     * currently holds the builtin; the interpreter falls back
+     * to a real call if the variable gets rebound later.
+     */
+    if (!is_of_type(operator, &TYPE_SYMBOL)
+        || !scope_refers_to_global(scope, operator)) {
+        return INSTR_HALT;
+    }
+
+    return primitive_inline_opcode(environment_get_binding(GLOBAL_ENVIRONMENT,
+                                                           operator),
+                                   operand_count);
+}
+
+
+/*
+ * Binding forms
+ */
+
+
+static void compile_bind_keys(struct code *code,
+                              struct scope *scope,
+                              unsigned int first,
+                              unsigned int count)
+{
+    unsigned int i;
+
+    // The values are on the stack, the last one on top
+    for (i = count; i > 0; i--)
+    {
+        code_push_instruction(code,
+                              INSTRUCTION(INSTR_DEFINE_CONST_DROP,
+                                          code_add_constant(code,
+                                                            scope->variables[first + i - 1].key)));
+    }
+}
+
+
+static void compile_in_thunk(objptr_t expr,
+                             struct code *code,
+                             struct scope *scope,
+                             bool enable_tailcall,
+                             bool leave_returns)
+{
+    objptr_t body;
+    objptr_t func;
+
+    /*
+     * Top-level code has no environment of its own to keep
+     * LET bindings in, so the form is wrapped into a lambda
+     * which is called right away.
+     */
+    body = cons(expr, EMPTY_LIST);
+    increase_refcount(body);
+    func = compile_lambda_prototype(EMPTY_LIST, body, scope, EMPTY_LIST);
+    decrease_refcount(body);
+
+    code_push_instruction(code, INSTRUCTION(INSTR_MAKE_CLOSURE,
+                                            code_add_constant(code, func)));
+    code_push_instruction(code,
+                          INSTRUCTION(scope_returns(scope, enable_tailcall)
+                                      ? INSTR_TAILCALL : INSTR_CALL,
+                                      0));
+
+    if (!leave_returns) {
+        code_push_instruction(code, INSTRUCTION(INSTR_POP, 1));
+    }
+}
+
+
+static void compile_let(objptr_t expr,
+                        struct code *code,
+                        struct scope *scope,
+                        bool enable_tailcall,
+                        bool leave_returns)
+{
+    objptr_t kind;
+    objptr_t bindings;
+    objptr_t body;
+    unsigned int variable_count;
+    unsigned int binding_count;
+
+    kind = get_car(expr);
+    bindings = get_car(get_cdr(expr));
+    body = get_cdr(get_cdr(expr));
+    variable_count = scope->variable_count;
+    binding_count = list_length(bindings);
+
+    if (kind == SYMBOL_LETREC) {
+        for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+        {
+            scope_add_renamed_variable(scope, get_car(get_car(bindings)));
+        }
+        bindings = get_car(get_cdr(expr));
+        for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+        {
+            compile_expression(get_car(get_cdr(get_car(bindings))),
+                               code, scope, false, true);
+        }
+        compile_bind_keys(code, scope, variable_count, binding_count);
+
+    } else if (kind == SYMBOL_LETSTAR) {
+        for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+        {
+            compile_expression(get_car(get_cdr(get_car(bindings))),
+                               code, scope, false, true);
+            scope_add_renamed_variable(scope, get_car(get_car(bindings)));
+            compile_bind_keys(code, scope, scope->variable_count - 1, 1);
+        }
+
+    } else {
+        for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+        {
+            compile_expression(get_car(get_cdr(get_car(bindings))),
+                               code, scope, false, true);
+        }
+        bindings = get_car(get_cdr(expr));
+        for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+        {
+            scope_add_renamed_variable(scope, get_car(get_car(bindings)));
+        }
+        compile_bind_keys(code, scope, variable_count, binding_count);
+    }
+
+    scope_add_definitions(scope, body, true);
+    compile_begin(body, code, scope, enable_tailcall, leave_returns);
+    scope_truncate(scope, variable_count);
+}
+
+
+static objptr_t binding_variables(objptr_t bindings)
+{
+    if (!is_of_type(bindings, &TYPE_PAIR)) {
+        return EMPTY_LIST;
+    }
+
+    return cons(get_car(get_car(bindings)),
+                binding_variables(get_cdr(bindings)));
+}
+
+
+static void compile_named_let(objptr_t expr,
+                              struct code *code,
+                              struct scope *scope,
+                              bool enable_tailcall,
+                              bool leave_returns)
+{
+    objptr_t name;
+    objptr_t bindings;
+    objptr_t body;
+    objptr_t params;
+    objptr_t key;
+    objptr_t func;
+    unsigned int i;
+    unsigned int variable_count;
+    bool in_place;
+    struct loop loop;
+
+    name = get_car(get_cdr(expr));
+    bindings = get_car(get_cdr(get_cdr(expr)));
+    body = get_cdr(get_cdr(get_cdr(expr)));
+    variable_count = scope->variable_count;
+
+    // The initial values are evaluated outside of the loop
+    for (; is_of_type(bindings, &TYPE_PAIR); bindings = get_cdr(bindings))
+    {
+        compile_expression(get_car(get_cdr(get_car(bindings))),
+                           code, scope, false, true);
+    }
+    bindings = get_car(get_cdr(get_cdr(expr)));
+
+    in_place = loop_is_in_place(name, bindings, body);
+    if (in_place) {
+        loop.variable_count = list_length(bindings);
+        loop.variables = malloc(loop.variable_count * sizeof(objptr_t));
+        // Without memory for the keys, the loop becomes a procedure
+        in_place = (loop.variables != NULL) || (loop.variable_count == 0);
+    }
+
+    if (in_place) {
+        for (i = 0; i < loop.variable_count; i++)
+        {
+            loop.variables[i] = scope_add_renamed_variable(scope,
+                                                           get_car(get_car(bindings)));
+            bindings = get_cdr(bindings);
+        }
+        compile_bind_keys(code, scope, variable_count, loop.variable_count);
+
+        loop.key = scope_add_renamed_variable(scope, name);
+        loop.parent = scope->loop;
+        loop.in_tail = enable_tailcall;
+        loop.returns = scope_returns(scope, enable_tailcall);
+        loop.start = code_get_write_location(code);
+
+        scope->loop = &loop;
+        scope_add_definitions(scope, body, true);
+        compile_begin(body, code, scope, true, leave_returns);
+        scope->loop = loop.parent;
+
+        free(loop.variables);
+    } else {
+        /*
+         * The loop is a real procedure, bound to its name in
+         * the current environment.
+         */
+        key = scope_add_renamed_variable(scope, name);
+
+        params = binding_variables(bindings);
+        increase_refcount(params);
+        func = compile_lambda_prototype(params, body, scope, key);
+        decrease_refcount(params);
+
+        code_push_instruction(code, INSTRUCTION(INSTR_MAKE_CLOSURE,
+                                                code_add_constant(code, func)));
+        code_push_instruction(code, INSTRUCTION(INSTR_DEFINE_CONST_DROP,
+                                                code_add_constant(code, key)));
+        code_push_instruction(code, INSTRUCTION(INSTR_LOOKUP_CONST,
+                                                code_add_constant(code, key)));
+        code_push_instruction(code,
+                              INSTRUCTION(scope_returns(scope, enable_tailcall)
+                                          ? INSTR_TAILCALL : INSTR_CALL,
+                                          list_length(bindings)));
+
+        if (!leave_returns) {
+            code_push_instruction(code, INSTRUCTION(INSTR_POP, 1));
+        }
+    }
+
+    scope_truncate(scope, variable_count);
+}
+
+
+static void compile_loop_jump(struct loop *loop,
+                              objptr_t arguments,
+                              struct code *code,
+                              struct scope *scope)
+{
+    unsigned int i;
+
+    compile_parameter_list(arguments, code, scope, true);
+
+    for (i = loop->variable_count; i > 0; i--)
+    {
+        code_push_instruction(code,
+                              INSTRUCTION(INSTR_DEFINE_CONST_DROP,
+                                          code_add_constant(code,
+                                                            loop->variables[i - 1])));
+    }
+
+    code_push_instruction(code, INSTRUCTION(INSTR_JMP, loop->start));
+}
+
+
+static objptr_t do_bindings(objptr_t bindings)
+{
+    objptr_t binding;
+
+    if (!is_of_type(bindings, &TYPE_PAIR)) {
+        return EMPTY_LIST;
+    }
+
+    binding = get_car(bindings);
+    return cons(cons(get_car(binding),
+                     cons(get_car(get_cdr(binding)), EMPTY_LIST)),
+                do_bindings(get_cdr(bindings)));
+}
+
+
+static objptr_t do_steps(objptr_t bindings)
+{
+    objptr_t binding;
+
+    if (!is_of_type(bindings, &TYPE_PAIR)) {
+        return EMPTY_LIST;
+    }
+
+    // Variables without a step keep their value
+    binding = get_car(bindings);
+    return cons(is_of_type(get_cdr(get_cdr(binding)), &TYPE_PAIR)
+                ? get_car(get_cdr(get_cdr(binding)))
+                : get_car(binding),
+                do_steps(get_cdr(bindings)));
+}
+
+
+static objptr_t append_element(objptr_t list, objptr_t element)
+{
+    if (!is_of_type(list, &TYPE_PAIR)) {
+        return cons(element, EMPTY_LIST);
+    }
+
+    return cons(get_car(list), append_element(get_cdr(list), element));
+}
+
+
+static objptr_t expand_do(objptr_t expr)
+{
+    objptr_t name;
+    objptr_t bindings;
+    objptr_t clause;
+    objptr_t results;
+    objptr_t commands;
+
+    /*
+     * (do ((var init step) ...) (test result ...) command ...)
+     *
+     * is turned into
+     *
+     * (let loop ((var init) ...)
+     *   (if test
+     *       (begin result ...)
+     *       (begin command ... (loop step ...))))
+     */
+    name = gensym(SYMBOL_DO);
+    bindings = get_car(get_cdr(expr));
+    clause = get_car(get_cdr(get_cdr(expr)));
+    commands = get_cdr(get_cdr(get_cdr(expr)));
+
+    results = get_cdr(clause);
+    if (!is_of_type(results, &TYPE_PAIR)) {
+        results = cons(NIL_FALSE, EMPTY_LIST);
+    }
+
+    return cons(SYMBOL_LET,
+                cons(name,
+                     cons(do_bindings(bindings),
+                          cons(cons(SYMBOL_IF,
+                                    cons(get_car(clause),
+                                         cons(cons(SYMBOL_BEGIN, results),
+                                              cons(cons(SYMBOL_BEGIN,
+                                                        append_element(commands,
+                                                                       cons(name,
+                                                                            do_steps(bindings)))),
+                                                   EMPTY_LIST)))),
+                               EMPTY_LIST))));
+}
+
+
 static void compile_expression(objptr_t expr,
                                struct code *code,
+                               struct scope *scope,
                                bool enable_tailcall,
                                bool leave_returns)
 /*
- * TODO: Add another parameter: no_stack_effect, for use
- * in BEGIN blocks. This parameter will also have to be
- * implemented in all other compiler subroutines.
+ * Note: Values which are pushed and dropped right away, for
+ * example by definitions in BEGIN blocks, are cleaned up by
+ * optimize_code() afterwards.
  */
 {
     objptr_t car;
@@ -216,6 +1358,8 @@ static void compile_expression(objptr_t expr,
     objptr_t caddr;
     unsigned int pos;
     unsigned int param_count;
+    unsigned int opcode;
+    struct loop *loop;
 
     
     if (is_of_type(expr, &TYPE_SYMBOL)) {
@@ -223,7 +1367,7 @@ static void compile_expression(objptr_t expr,
          * Symbols will be looked up.
          */
         if (leave_returns) {
-            pos = code_add_constant(code, expr);
+            pos = code_add_constant(code, scope_resolve(scope, expr));
             code_push_instruction(code, INSTRUCTION(INSTR_LOOKUP_CONST, pos));
         }
         
@@ -245,8 +1389,8 @@ static void compile_expression(objptr_t expr,
             caddr = get_car(get_cdr(get_cdr(expr)));
             
             if (cadr != EMPTY_LIST) {
-                pos = code_add_constant(code, cadr);
-                compile_expression(caddr, code, false, leave_returns);
+                pos = code_add_constant(code, scope_resolve(scope, cadr));
+                compile_expression(caddr, code, scope, false, true);
                 code_push_instruction(code, INSTRUCTION(INSTR_SET_CONST, pos));
             } // TODO: else: error!
 
@@ -262,8 +1406,13 @@ static void compile_expression(objptr_t expr,
 		 * This is the (define (func . args) . body) part
 		 */
 		objptr_t func;
-		pos = code_add_constant(code, get_car(cadr));
-		func = compile_lambda_prototype(get_cdr(cadr), get_cdr(get_cdr(expr)));
+		objptr_t key;
+		key = scope_resolve(scope, get_car(cadr));
+		pos = code_add_constant(code, key);
+		func = compile_lambda_prototype(get_cdr(cadr),
+						get_cdr(get_cdr(expr)),
+						scope,
+						key);
 		code_push_instruction(code, INSTRUCTION(INSTR_MAKE_CLOSURE,
 							code_add_constant(code, func)));
 		code_push_instruction(code, INSTRUCTION(INSTR_DEFINE_CONST, pos));
@@ -272,8 +1421,20 @@ static void compile_expression(objptr_t expr,
 		 * This is the (define foo bar) part
 		 */
 		caddr = get_car(get_cdr(get_cdr(expr)));
-                pos = code_add_constant(code, cadr);
-                compile_expression(caddr, code, false, leave_returns);
+                pos = code_add_constant(code, scope_resolve(scope, cadr));
+                if (is_of_type(caddr, &TYPE_PAIR)
+                    && get_car(caddr) == SYMBOL_LAMBDA) {
+                    objptr_t func;
+                    func = compile_lambda_prototype(get_car(get_cdr(caddr)),
+                                                    get_cdr(get_cdr(caddr)),
+                                                    scope,
+                                                    scope_resolve(scope, cadr));
+                    code_push_instruction(code,
+                                          INSTRUCTION(INSTR_MAKE_CLOSURE,
+                                                      code_add_constant(code, func)));
+                } else {
+                    compile_expression(caddr, code, scope, false, true);
+                }
                 code_push_instruction(code,
                                       INSTRUCTION(INSTR_DEFINE_CONST, pos));
             } // TODO: else: error!
@@ -301,23 +1462,26 @@ static void compile_expression(objptr_t expr,
                 elseclause = get_car(get_cdr(get_cdr(get_cdr(expr))));
             }
 
-            compile_expression(condition, code, false, true);
+            compile_expression(condition, code, scope, false, true);
             jmploc = code_push_instruction(code,
                                            INSTRUCTION(INSTR_JMP_IF_NOT, ~0));
-            compile_expression(ifclause, code, enable_tailcall, leave_returns);
+            compile_expression(ifclause, code, scope,
+                               enable_tailcall, leave_returns);
             endloc = code_push_instruction(code,
                                            INSTRUCTION(INSTR_JMP, ~0));
             code_set_instruction(code,
                                  jmploc,
                                  INSTRUCTION(INSTR_JMP_IF_NOT, endloc + 1));
-            compile_expression(elseclause, code, enable_tailcall, leave_returns);
+            compile_expression(elseclause, code, scope,
+                               enable_tailcall, leave_returns);
             code_set_instruction(code,
                                  endloc,
                                  INSTRUCTION(INSTR_JMP,
                                              code_get_write_location(code)));
 
         } else if (car == SYMBOL_BEGIN) {
-            compile_begin(get_cdr(expr), code, enable_tailcall, leave_returns);
+            compile_begin(get_cdr(expr), code, scope,
+                          enable_tailcall, leave_returns);
             
         } else if (car == SYMBOL_LAMBDA) {
             objptr_t param_list;
@@ -328,19 +1492,73 @@ static void compile_expression(objptr_t expr,
                 param_list = get_car(get_cdr(expr));
                 body = get_cdr(get_cdr(expr));
                 
-                func = compile_lambda_prototype(param_list, body);
+                func = compile_lambda_prototype(param_list, body, scope,
+                                                EMPTY_LIST);
                 pos = code_add_constant(code, func);
                 code_push_instruction(code, INSTRUCTION(INSTR_MAKE_CLOSURE, pos));
             }
+
+        } else if ((car == SYMBOL_LET)
+                   || (car == SYMBOL_LETSTAR)
+                   || (car == SYMBOL_LETREC)
+                   || (car == SYMBOL_DO)) {
+            if (!scope_has_frame(scope)) {
+                compile_in_thunk(expr, code, scope,
+                                 enable_tailcall, leave_returns);
+            } else if (car == SYMBOL_DO) {
+                objptr_t expansion;
+                expansion = expand_do(expr);
+                increase_refcount(expansion);
+                compile_expression(expansion, code, scope,
+                                   enable_tailcall, leave_returns);
+                decrease_refcount(expansion);
+            } else if ((car == SYMBOL_LET)
+                       && is_of_type(get_car(cdr), &TYPE_SYMBOL)) {
+                compile_named_let(expr, code, scope,
+                                  enable_tailcall, leave_returns);
+            } else {
+                compile_let(expr, code, scope,
+                            enable_tailcall, leave_returns);
+            }
+
+        } else if (is_of_type(car, &TYPE_SYMBOL)
+                   && ((loop = scope_find_loop(scope, scope_resolve(scope, car)))
+                       != NULL)) {
+            /*
+             * Tail call of an enclosing loop, see loop_is_in_place()
+             */
+            assert(enable_tailcall && (list_length(cdr) == loop->variable_count));
+            compile_loop_jump(loop, cdr, code, scope);
+
+        } else if ((opcode = inline_opcode(car, list_length(cdr), scope))
+                   != INSTR_HALT) {
+            /*
+             * Call of an inlinable builtin. The operator's name is
+             * passed as the argument for the fallback path.
+             */
+            compile_parameter_list(cdr, code, scope, true);
+            pos = code_add_constant(code, car);
+            code_push_instruction(code, INSTRUCTION(opcode, pos));
+
+            if (!leave_returns) {
+                code_push_instruction(code, INSTRUCTION(INSTR_POP, 1));
+            }
             
         } else {
             /*
              * No builtin special form has matched, so we compile
              * a basic function call.
              */
-            param_count = compile_parameter_list(cdr, code, true);
-            compile_expression(car, code, false, true);
-            if (enable_tailcall) {
+            param_count = compile_parameter_list(cdr, code, scope, true);
+            compile_expression(car, code, scope, false, true);
+            if (scope_returns(scope, enable_tailcall)
+                && is_of_type(car, &TYPE_SYMBOL)
+                && (scope_resolve(scope, car) == scope->self_name)
+                && (param_count == scope->self_parameter_count)) {
+                code_push_instruction(code,
+                                      INSTRUCTION(INSTR_SELF_TAILCALL,
+                                                  param_count));
+            } else if (scope_returns(scope, enable_tailcall)) {
                 code_push_instruction(code,
                                       INSTRUCTION(INSTR_TAILCALL,
                                                   param_count));
@@ -368,7 +1586,11 @@ static void compile_expression(objptr_t expr,
 
 void compile(objptr_t expr, struct code *code)
 {
-    compile_expression(expr, code, true, true);
+    struct scope scope;
+
+    scope_init(&scope, NULL, false);
+    compile_expression(expr, code, &scope, true, true);
+    scope_terminate(&scope);
 }
 
 
@@ -376,16 +1598,29 @@ objptr_t compile_to_thunk(objptr_t expr, objptr_t environment)
 {
     objptr_t ptr;
     struct closure_prototype *proto;
+    struct scope scope;
 
     ptr = object_allocate(&TYPE_CLOSURE_PROTOTYPE);
 
     if (ptr != EMPTY_LIST) {
         proto = (struct closure_prototype*) dereference(ptr);
         proto->parameter_vector = make_vector(0, EMPTY_LIST);
-        compile(expr, &(proto->code));
+
+        scope_init(&scope, NULL, environment == GLOBAL_ENVIRONMENT);
+        compile_expression(expr, &(proto->code), &scope, true, true);
+        optimize_code(&(proto->code));
+        code_drop_constant_index(&(proto->code));
+        scope_terminate(&scope);
+        clear_constant_pool();
+
+        if (scope.failed) {
+            increase_refcount(ptr);
+            decrease_refcount(ptr);
+            return EMPTY_LIST;
+        }
+
         return make_closure_from_prototype(ptr, environment);
     } else {
         return EMPTY_LIST;
     }
 }
-
@@ -10,11 +10,18 @@
 
 
 
+struct jit_code;
+
 struct code {
     objptr_t constant_vector;
+    unsigned int *constant_index;  // Only kept while compiling
+    unsigned int constant_index_size;
     unsigned int code_size;
     unsigned int code_alloc;
     instr_t *codes;
+
+    unsigned int call_count;  // Calls and loop iterations, see jit.h
+    struct jit_code *native;
 };
 
 
@@ -22,10 +29,14 @@ unsigned int code_push_instruction(struct code*, instr_t);
 void code_set_instruction(struct code*, instr_t, unsigned int);
 unsigned int code_add_constant(struct code*, objptr_t);
 unsigned int code_get_write_location(struct code*);
+void code_drop_constant_index(struct code*);
 
 void compile(objptr_t, struct code*);
 objptr_t compile_to_thunk(objptr_t, objptr_t);
 
+void init_constant_pool();
+void terminate_constant_pool();
+
 void init_code(struct code*);
 void init_code_by_copy(struct code*, struct code*);
 void terminate_code(struct code*);
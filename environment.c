@@ -127,10 +127,39 @@ void environment_set_parent(objptr_t ptr, objptr_t parent)
 
 
 
+static objptr_t *INTERNAL_environment_find_local(struct environment *environment,
+						 objptr_t variable)
+{
+    unsigned int i;
+
+    for (i = 0; i < ENVIRONMENT_SLOT_COUNT; i++)
+    {
+	if (eqv(environment->slots[i].key,
+		variable,
+		EQV_STRICT)) {
+	    return &(environment->slots[i].value);
+	}
+    }
+
+    if (environment->extended_slots != NULL) {
+	for (i = 0; i < environment->extended_slot_count; i++)
+	{
+	    if (eqv(environment->extended_slots[i].key,
+		    variable,
+		    EQV_STRICT)) {
+		return &(environment->extended_slots[i].value);
+	    }
+	}
+    }
+
+    return NULL;
+}
+
+
 static objptr_t *INTERNAL_environment_get_binding(objptr_t ptr,
 						  objptr_t variable)
 {
-    unsigned int i;
+    objptr_t *binding;
     struct environment *environment;
 
     /*
@@ -143,25 +172,10 @@ restart:
 	return NULL;
     } else if (is_of_type(ptr, &TYPE_ENVIRONMENT)) {
 	environment = (struct environment*) dereference(ptr);
-	
-	for (i = 0; i < ENVIRONMENT_SLOT_COUNT; i++)
-	{
-	    if (eqv(environment->slots[i].key,
-		    variable,
-		    EQV_STRICT)) {
-		return &(environment->slots[i].value);
-	    }
-	}
 
-	if (environment->extended_slots != NULL) {
-	    for (i = 0; i < environment->extended_slot_count; i++)
-	    {
-		if (eqv(environment->slots[i].key,
-			variable,
-			EQV_STRICT)) {
-		    return &(environment->extended_slots[i].value);
-		}
-	    }
+	binding = INTERNAL_environment_find_local(environment, variable);
+	if (binding != NULL) {
+	    return binding;
 	}
 
 	/*
@@ -176,6 +190,59 @@ restart:
 }
 
 
+static void INTERNAL_environment_add_binding(struct environment *environment,
+					     objptr_t variable,
+					     objptr_t value)
+{
+    unsigned int i;
+
+    if (environment->extended_slots == NULL) {
+	/*
+	 * No extended bindings present yet, so we're trying to
+	 * add to the "fixed" slots
+	 */
+	for (i = 0; i < ENVIRONMENT_SLOT_COUNT; i++)
+	{
+	    if (eqv(environment->slots[i].key,
+		    EMPTY_LIST,
+		    EQV_STRICT)) {
+		/*
+		 * Slots are usually initialized with EMPTY_LIST keys,
+		 * so we have found a nice spot to place our variable ;-)
+		 */
+		environment->slots[i].key = variable;
+		increase_refcount(variable);
+		environment->slots[i].value = value;
+		increase_refcount(value);
+		return;
+	    }
+	}
+    }
+
+    /*
+     * No free internal bindings, so we have to allocate
+     * the variables dynamically.
+     */
+    if (environment->extended_slot_count >= environment->extended_slot_alloc
+	|| environment->extended_slots == NULL) {
+	/*
+	 * The dynamic space is exhausted, so we grow.
+	 * FIXME: Handle realloc() failures!
+	 */
+	environment->extended_slots =
+	    realloc(environment->extended_slots,
+		    (environment->extended_slot_alloc + 16) * sizeof(struct environment_slot));
+	environment->extended_slot_alloc += 16;
+    }
+
+    environment->extended_slots[environment->extended_slot_count].key = variable;
+    increase_refcount(variable);
+    environment->extended_slots[environment->extended_slot_count].value = value;
+    increase_refcount(value);
+    environment->extended_slot_count++;
+}
+
+
 objptr_t environment_get_binding(objptr_t ptr, objptr_t variable)
 {
     objptr_t *binding;
@@ -191,7 +258,6 @@ objptr_t environment_get_binding(objptr_t ptr, objptr_t variable)
 
 void environment_bind(objptr_t ptr, objptr_t variable, objptr_t value)
 {
-    unsigned int i;
     objptr_t *binding;
     struct environment *environment;
 
@@ -202,54 +268,37 @@ void environment_bind(objptr_t ptr, objptr_t variable, objptr_t value)
     
     if (binding == NULL) {
 	/* Binding does not exist yet, add to current environment */
-	if (environment->extended_slots == NULL) {
-	    /*
-	     * No extended bindings present yet, so we're trying to
-	     * add to the "fixed" slots
-	     */
-	    for (i = 0; i < ENVIRONMENT_SLOT_COUNT; i++)
-	    {
-		if (eqv(environment->slots[i].key,
-			EMPTY_LIST,
-			EQV_STRICT)) {
-		    /*
-		     * Slots are usually initialized with EMPTY_LIST keys,
-		     * so we have found a nice spot to place our variable ;-)
-		     */
-		    environment->slots[i].key = variable;
-		    increase_refcount(variable);
-		    environment->slots[i].value = value;
-		    increase_refcount(value);
-		    return;
-		}
-	    }
-	}
-
-	/*
-	 * No free internal bindings, so we have to allocate
-	 * the variables dynamically.
-	 */
-	if (environment->extended_slot_count >= environment->extended_slot_alloc
-	    || environment->extended_slots == NULL) {
-	    /*
-	     * The dynamic space is exhausted, so we grow.
-	     * FIXME: Handle realloc() failures!
-	     */
-	    environment->extended_slots =
-		realloc(environment->extended_slots,
-			environment->extended_slot_alloc + 16 * sizeof(struct environment_slot));
-	    environment->extended_slot_alloc += 16;
-	}
-
-	environment->extended_slots[environment->extended_slot_count].key = variable;
-	increase_refcount(variable);
-	environment->extended_slots[environment->extended_slot_count].value = value;
-	increase_refcount(value);
-	environment->extended_slot_count++;
+	INTERNAL_environment_add_binding(environment, variable, value);
     } else {
 	/* Replace an existing binding */
+	increase_refcount(value);
 	decrease_refcount(*binding);
 	*binding = value;
+    }
+}
+
+
+void environment_define(objptr_t ptr, objptr_t variable, objptr_t value)
+{
+    objptr_t *binding;
+    struct environment *environment;
+
+    /*
+     * Unlike environment_bind(), this never touches bindings
+     * of parent environments, so a definition can shadow an
+     * outer variable of the same name.
+     */
+
+    if (!is_of_type(ptr, &TYPE_ENVIRONMENT)) return;  // TODO: Error?
+
+    environment = (struct environment*) dereference(ptr);
+    binding = INTERNAL_environment_find_local(environment, variable);
+
+    if (binding == NULL) {
+	INTERNAL_environment_add_binding(environment, variable, value);
+    } else {
 	increase_refcount(value);
+	decrease_refcount(*binding);
+	*binding = value;
     }
 }
@@ -35,6 +35,7 @@ objptr_t environment_get_parent(objptr_t);
 void environment_set_parent(objptr_t, objptr_t);
 objptr_t environment_get_binding(objptr_t, objptr_t);
 void environment_bind(objptr_t, objptr_t, objptr_t);
+void environment_define(objptr_t, objptr_t, objptr_t);
 
 
 #endif
@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <stdio.h>
 #include <stdlib.h>
 
 #include "object.h"
@@ -6,6 +7,12 @@
 #include "vector.h"
 #include "pair.h"
 #include "environment.h"
+#include "number.h"
+#include "primitive.h"
+#include "string_object.h"
+#include "symbol.h"
+#include "builtins.h"
+#include "jit.h"
 
 #include "fiber.h"
 
@@ -62,6 +69,10 @@ void code_pointer_terminate(struct code_pointer *ptr)
 {
     assert(ptr != NULL);
     decrease_refcount(ptr->func);
+    // Fibers are terminated when they halt and again when swept
+    ptr->func = EMPTY_LIST;
+    ptr->code = NULL;
+    ptr->offset = 0;
 }
 
 
@@ -274,7 +285,7 @@ static void fiber_launch(struct fiber *fib, objptr_t thunk)
 }
 
 
-static void fiber_push(struct fiber *fib, objptr_t obj)
+void fiber_push(struct fiber *fib, objptr_t obj)
 {
     objptr_t new_stack;
 
@@ -285,7 +296,7 @@ static void fiber_push(struct fiber *fib, objptr_t obj)
 }
 
 
-static objptr_t fiber_pop(struct fiber *fib)
+objptr_t fiber_pop(struct fiber *fib)
 {
     objptr_t object;
     objptr_t next_elem;
@@ -362,7 +373,7 @@ static objptr_t fiber_unwrap_params(struct fiber *fib,
             decrease_refcount(object);
         }
 
-        environment_bind(environment, rest_parameter_name, rest_parameter_list);
+        environment_define(environment, rest_parameter_name, rest_parameter_list);
     }
 
     /*
@@ -371,9 +382,9 @@ static objptr_t fiber_unwrap_params(struct fiber *fib,
     for (i = named_variable_count - 1; i >= 0; i--)
     {
         object = fiber_pop(fib);
-        environment_bind(environment,
-                         vector_get(variable_name_vector, i),
-                         object);
+        environment_define(environment,
+                           vector_get(variable_name_vector, i),
+                           object);
         decrease_refcount(object);
     }
     
@@ -382,6 +393,641 @@ static objptr_t fiber_unwrap_params(struct fiber *fib,
 
 
 
+#define PRIMITIVE_ARGUMENT_BUFFER_SIZE 16
+
+static void fiber_call_primitive(struct fiber *fib,
+                                 objptr_t func,
+                                 unsigned int argument_count)
+{
+    unsigned int i;
+    objptr_t result;
+    objptr_t buffer[PRIMITIVE_ARGUMENT_BUFFER_SIZE];
+    objptr_t *arguments;
+    struct primitive *primitive;
+    char *name;
+
+    /*
+     * Primitives run directly on the operand stack: The arguments
+     * are moved into a C array and the result is pushed in their
+     * place. No continuation frame or environment is created.
+     */
+
+    if (argument_count <= PRIMITIVE_ARGUMENT_BUFFER_SIZE) {
+        arguments = buffer;
+    } else {
+        arguments = malloc(argument_count * sizeof(objptr_t));
+        if (arguments == NULL) {
+            for (i = 0; i < argument_count; i++)
+            {
+                decrease_refcount(fiber_pop(fib));
+            }
+            fiber_push(fib, builtin_error("primitive", "out of memory"));
+            return;
+        }
+    }
+
+    for (i = argument_count; i > 0; i--)
+    {
+        arguments[i - 1] = fiber_pop(fib);
+    }
+
+    primitive = (struct primitive*) dereference(func);
+    if (primitive_accepts(func, argument_count)) {
+        result = primitive->function(arguments, argument_count);
+    } else {
+        name = string_to_c_string(symbol_to_string(primitive->name));
+        result = builtin_error((name != NULL) ? name : "primitive",
+                               "wrong number of arguments");
+        free(name);
+    }
+
+    // The result may be owned by one of the arguments, so it has
+    // to be pushed before the arguments are released.
+    fiber_push(fib, result);
+
+    for (i = 0; i < argument_count; i++)
+    {
+        decrease_refcount(arguments[i]);
+    }
+
+    if (arguments != buffer) {
+        free(arguments);
+    }
+}
+
+
+
+/*
+ * Hot code detection
+ *
+ * Calls and backward jumps are counted per prototype, the JIT
+ * compiles a prototype once it gets hot.
+ */
+
+static void fiber_count_call(struct fiber *fib)
+{
+#ifdef NIL_JIT
+    struct code *code;
+
+    code = fib->instr_pointer.code;
+    if (code->native == NULL && ++(code->call_count) == JIT_THRESHOLD) {
+        jit_compile(code, FIBER_OPS);
+    }
+#endif
+}
+
+
+static void fiber_count_backward_jump(struct fiber *fib, unsigned int target)
+{
+    if (target < fib->instr_pointer.offset) {
+        fiber_count_call(fib);
+    }
+}
+
+
+
+static void fiber_call(struct fiber *fib,
+                       objptr_t func,
+                       unsigned int argument_count,
+                       bool tailcall)
+{
+    objptr_t object;
+    struct closure *closure;
+    struct closure_prototype *closure_prototype;
+
+    if (is_of_type(func, &TYPE_PRIMITIVE)) {
+        fiber_call_primitive(fib, func, argument_count);
+    } else if (is_of_type(func, &TYPE_CLOSURE)) {
+        if (!tailcall) {
+            object = fiber_get_continuation(fib);
+            // We can do this since the continuation definitely contains a link
+            // to the older clink
+            decrease_refcount(fib->clink);
+            fib->clink = object;
+            increase_refcount(fib->clink);
+        }
+
+        closure = (struct closure*) dereference(func);
+
+        // Replace environment
+        decrease_refcount(fib->environment);
+        fib->environment = closure->environment;
+        increase_refcount(fib->environment);
+
+        if (!is_of_type(closure->prototype, &TYPE_CLOSURE_PROTOTYPE)) {
+            // XXX: error: invalid closure!
+        }
+
+        closure_prototype =
+            (struct closure_prototype*) dereference(closure->prototype);
+
+        // Unpack parameters
+        object = fiber_unwrap_params(fib,
+                                     argument_count,
+                                     closure_prototype->parameter_vector,
+                                     closure_prototype->rest_parameter);
+        decrease_refcount(fib->environment);
+        fib->environment = object;
+        increase_refcount(fib->environment);
+
+        // Set code pointer
+        code_pointer_enter_func(&(fib->instr_pointer), closure->prototype);
+        fiber_count_call(fib);
+    } else {
+        // XXX: error: can't call this!
+    }
+}
+
+
+static void fiber_call_by_name(struct fiber *fib,
+                               unsigned int name_constant,
+                               unsigned int argument_count)
+{
+    objptr_t func;
+
+    /*
+     * Fallback of the inlined builtins: their operands are
+     * already on the stack, so we only have to look up the
+     * operator and call it.
+     */
+    func = environment_get_binding(fib->environment,
+                                   code_pointer_get_constant(&(fib->instr_pointer),
+                                                             name_constant));
+    increase_refcount(func);
+    fiber_call(fib, func, argument_count, false);
+    decrease_refcount(func);
+}
+
+
+
+/*
+ * Instruction handlers
+ *
+ * Instructions which are part of superinstructions (see
+ * bytecode.h) are implemented as functions named after their
+ * opcode, so the fused instructions can be generated from the
+ * superinstruction table.
+ */
+
+void fiber_op_PUSH_CONST(struct fiber *fib, unsigned int argument)
+{
+    fiber_push(fib, code_pointer_get_constant(&(fib->instr_pointer), argument));
+}
+
+
+void fiber_op_LOOKUP_CONST(struct fiber *fib, unsigned int argument)
+{
+    objptr_t variable;
+
+    variable = code_pointer_get_constant(&(fib->instr_pointer), argument);
+    fiber_push(fib, environment_get_binding(fib->environment, variable));
+}
+
+
+void fiber_op_JMP_IF_NOT(struct fiber *fib, unsigned int argument)
+{
+    objptr_t object;
+
+    object = fiber_pop(fib);
+    if (object == NIL_FALSE) {
+        code_pointer_jump(&(fib->instr_pointer), argument);
+    }
+    decrease_refcount(object);
+}
+
+
+void fiber_op_CALL(struct fiber *fib, unsigned int argument)
+{
+    objptr_t func;
+
+    func = fiber_pop(fib);
+    fiber_call(fib, func, argument, false);
+    decrease_refcount(func);
+}
+
+
+void fiber_op_TAILCALL(struct fiber *fib, unsigned int argument)
+{
+    objptr_t func;
+
+    func = fiber_pop(fib);
+    fiber_call(fib, func, argument, true);
+    decrease_refcount(func);
+}
+
+
+static bool fiber_is_running_closure(struct fiber *fib, objptr_t func)
+{
+    struct closure *closure;
+
+    if (!is_of_type(func, &TYPE_CLOSURE)) {
+        return false;
+    }
+
+    /*
+     * Calls create the environment of a procedure as a child of
+     * the closure's environment, so a closure with the running
+     * prototype and this parent behaves exactly like a new call.
+     */
+    closure = (struct closure*) dereference(func);
+    return (closure->prototype == fib->instr_pointer.func)
+        && (closure->environment == environment_get_parent(fib->environment));
+}
+
+
+void fiber_op_SELF_TAILCALL(struct fiber *fib, unsigned int argument)
+{
+    int i;
+    objptr_t func;
+    objptr_t object;
+    struct closure_prototype *prototype;
+
+    func = fiber_pop(fib);
+
+    if (fiber_is_running_closure(fib, func)) {
+        prototype = (struct closure_prototype*)
+            dereference(fib->instr_pointer.func);
+
+        for (i = argument - 1; i >= 0; i--)
+        {
+            object = fiber_pop(fib);
+            environment_define(fib->environment,
+                               vector_get(prototype->parameter_vector, i),
+                               object);
+            decrease_refcount(object);
+        }
+
+        code_pointer_jump(&(fib->instr_pointer), 0);
+        fiber_count_call(fib);
+    } else {
+        fiber_call(fib, func, argument, true);
+    }
+
+    decrease_refcount(func);
+}
+
+
+static void fiber_inline_unary(struct fiber *fib,
+                               unsigned int opcode,
+                               unsigned int argument)
+{
+    objptr_t object;
+
+    if (!PRIMITIVE_INLINE_GUARDS[opcode]) {
+        fiber_call_by_name(fib, argument, 1);
+        return;
+    }
+
+    object = fiber_pop(fib);
+    switch (opcode) {
+    case INSTR_CAR:  fiber_push(fib, get_car(object));  break;
+    case INSTR_CDR:  fiber_push(fib, get_cdr(object));  break;
+    case INSTR_NULL:
+        fiber_push(fib, (object == EMPTY_LIST) ? NIL_TRUE : NIL_FALSE);
+        break;
+    case INSTR_NOT:
+        fiber_push(fib, (object == NIL_FALSE) ? NIL_TRUE : NIL_FALSE);
+        break;
+    }
+    decrease_refcount(object);
+}
+
+
+void fiber_op_CAR(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_unary(fib, INSTR_CAR, argument);
+}
+
+
+void fiber_op_CDR(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_unary(fib, INSTR_CDR, argument);
+}
+
+
+void fiber_op_NULL(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_unary(fib, INSTR_NULL, argument);
+}
+
+
+void fiber_op_NOT(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_unary(fib, INSTR_NOT, argument);
+}
+
+
+/*
+ * Whether the two operands on top of the stack are numbers
+ */
+static bool fiber_has_number_operands(struct fiber *fib)
+{
+    return is_of_type(get_car(fib->stack_ptr), &TYPE_NUMBER)
+        && is_of_type(get_car(get_cdr(fib->stack_ptr)), &TYPE_NUMBER);
+}
+
+
+static void fiber_inline_binary(struct fiber *fib,
+                                unsigned int opcode,
+                                unsigned int argument)
+{
+    objptr_t object, object2;
+    int order;
+
+    /*
+     * The builtin comparisons report other operands as errors, so
+     * they are left to them.
+     */
+    if (!PRIMITIVE_INLINE_GUARDS[opcode]
+        || ((opcode == INSTR_LT || opcode == INSTR_NUM_EQ)
+            && !fiber_has_number_operands(fib))) {
+        fiber_call_by_name(fib, argument, 2);
+        return;
+    }
+
+    object2 = fiber_pop(fib);
+    object = fiber_pop(fib);
+    switch (opcode) {
+    case INSTR_CONS:  fiber_push(fib, cons(object, object2));  break;
+    case INSTR_EQ:
+        fiber_push(fib, eqv(object, object2, EQ_STRICT) ? NIL_TRUE : NIL_FALSE);
+        break;
+    case INSTR_ADD:   fiber_push(fib, number_add(object, object2));  break;
+    case INSTR_SUB:   fiber_push(fib, number_subtract(object, object2));  break;
+    case INSTR_LT:
+        fiber_push(fib, (number_compare(object, object2, &order) && order < 0)
+                   ? NIL_TRUE : NIL_FALSE);
+        break;
+    case INSTR_NUM_EQ:
+        fiber_push(fib, (number_compare(object, object2, &order) && order == 0)
+                   ? NIL_TRUE : NIL_FALSE);
+        break;
+    }
+    decrease_refcount(object2);
+    decrease_refcount(object);
+}
+
+
+void fiber_op_CONS(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_binary(fib, INSTR_CONS, argument);
+}
+
+
+void fiber_op_EQ(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_binary(fib, INSTR_EQ, argument);
+}
+
+
+void fiber_op_ADD(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_binary(fib, INSTR_ADD, argument);
+}
+
+
+void fiber_op_SUB(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_binary(fib, INSTR_SUB, argument);
+}
+
+
+void fiber_op_LT(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_binary(fib, INSTR_LT, argument);
+}
+
+
+void fiber_op_NUM_EQ(struct fiber *fib, unsigned int argument)
+{
+    fiber_inline_binary(fib, INSTR_NUM_EQ, argument);
+}
+
+
+void fiber_op_HALT(struct fiber *fib, unsigned int argument)
+{
+    fib->waiting_condition.state = HALTED;
+}
+
+
+void fiber_op_JMP(struct fiber *fib, unsigned int argument)
+{
+    fiber_count_backward_jump(fib, argument);
+    code_pointer_jump(&(fib->instr_pointer), argument);
+}
+
+
+static void fiber_set_const(struct fiber *fib, unsigned int argument, bool push)
+{
+    objptr_t object, variable;
+
+    object = fiber_pop(fib);
+    variable = code_pointer_get_constant(&(fib->instr_pointer), argument);
+    primitive_invalidate_inline_opcodes(variable);
+    environment_bind(fib->environment, variable, object);
+    if (push) {
+        fiber_push(fib, object);
+    }
+    decrease_refcount(object);
+}
+
+
+void fiber_op_SET_CONST(struct fiber *fib, unsigned int argument)
+{
+    fiber_set_const(fib, argument, true);
+}
+
+
+void fiber_op_SET_CONST_DROP(struct fiber *fib, unsigned int argument)
+{
+    fiber_set_const(fib, argument, false);
+}
+
+
+static void fiber_define_const(struct fiber *fib, unsigned int argument, bool push)
+{
+    objptr_t object, variable;
+
+    object = fiber_pop(fib);
+    variable = code_pointer_get_constant(&(fib->instr_pointer), argument);
+    primitive_invalidate_inline_opcodes(variable);
+    environment_define(fib->environment, variable, object);
+    if (push) {
+        fiber_push(fib, object);
+    }
+    decrease_refcount(object);
+}
+
+
+void fiber_op_DEFINE_CONST(struct fiber *fib, unsigned int argument)
+{
+    fiber_define_const(fib, argument, true);
+}
+
+
+void fiber_op_DEFINE_CONST_DROP(struct fiber *fib, unsigned int argument)
+{
+    fiber_define_const(fib, argument, false);
+}
+
+
+void fiber_op_POP(struct fiber *fib, unsigned int argument)
+{
+    unsigned int i;
+
+    for (i = 0; i < argument; i++)
+    {
+        decrease_refcount(fiber_pop(fib));
+    }
+}
+
+
+void fiber_op_MAKE_CLOSURE(struct fiber *fib, unsigned int argument)
+{
+    objptr_t prototype;
+
+    prototype = code_pointer_get_constant(&(fib->instr_pointer), argument);
+    fiber_push(fib, make_closure_from_prototype(prototype, fib->environment));
+}
+
+
+void fiber_op_COMPILE_TO_THUNK(struct fiber *fib, unsigned int argument)
+{
+    objptr_t expression, environment;
+
+    environment = fiber_pop(fib);
+    expression = fiber_pop(fib);
+    fiber_push(fib, compile_to_thunk(expression, environment));
+    decrease_refcount(environment);
+    decrease_refcount(expression);
+}
+
+
+/*
+ * Superinstructions execute both of their parts
+ */
+
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS)                      \
+    void fiber_op_##NAME(struct fiber *fib, unsigned int argument)             \
+    {                                                                          \
+        fiber_op_##FIRST(fib, SUPERINSTRUCTION_FIRST_ARGUMENT(argument, BITS)); \
+        fiber_op_##SECOND(fib, SUPERINSTRUCTION_SECOND_ARGUMENT(argument, BITS)); \
+    }
+
+SUPERINSTRUCTION_TABLE
+
+#undef SUPERINSTRUCTION
+
+
+/*
+ * Handlers by opcode, used by native code. Unknown opcodes do
+ * nothing, like in the interpreter.
+ */
+
+static void fiber_op_unknown(struct fiber *fib, unsigned int argument)
+{
+}
+
+
+const fiber_op_t FIBER_OPS[256] = {
+    [0 ... 255] = fiber_op_unknown,
+
+#define FIBER_OP(NAME) [INSTR_##NAME] = fiber_op_##NAME,
+    FIBER_OP_TABLE
+#undef FIBER_OP
+
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS) \
+    [INSTR_##NAME] = fiber_op_##NAME,
+    SUPERINSTRUCTION_TABLE
+#undef SUPERINSTRUCTION
+};
+
+
+const char *const FIBER_OP_NAMES[256] = {
+#define FIBER_OP(NAME) [INSTR_##NAME] = #NAME,
+    FIBER_OP_TABLE
+#undef FIBER_OP
+
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS) \
+    [INSTR_##NAME] = #NAME,
+    SUPERINSTRUCTION_TABLE
+#undef SUPERINSTRUCTION
+};
+
+
+
+/*
+ * Opcode pair profiler
+ *
+ * Build with -DNIL_PROFILE_OPCODES to count how often each
+ * opcode follows each other one. The most frequent pairs are
+ * candidates for superinstructions (see bytecode.h).
+ */
+
+#ifdef NIL_PROFILE_OPCODES
+
+#define OPCODE_PROFILE_REPORT_SIZE 20
+
+static unsigned long OPCODE_PAIR_COUNTS[256][256];
+static unsigned int PREVIOUS_OPCODE = INSTR_HALT;
+
+
+static void profile_opcode(unsigned int opcode)
+{
+    OPCODE_PAIR_COUNTS[PREVIOUS_OPCODE][opcode]++;
+    PREVIOUS_OPCODE = opcode;
+}
+
+
+void print_opcode_profile(FILE *f)
+{
+    unsigned int i, j, n;
+    unsigned int best_first, best_second;
+    unsigned long best;
+    unsigned long total;
+    bool reported[256][256] = {{ false }};
+
+    total = 0;
+    for (i = 0; i < 256; i++)
+    {
+        for (j = 0; j < 256; j++)
+        {
+            total += OPCODE_PAIR_COUNTS[i][j];
+        }
+    }
+
+    fprintf(f, "opcode pairs (%lu instructions):\n", total);
+
+    for (n = 0; n < OPCODE_PROFILE_REPORT_SIZE; n++)
+    {
+        best = 0;
+        best_first = best_second = 0;
+        for (i = 0; i < 256; i++)
+        {
+            for (j = 0; j < 256; j++)
+            {
+                if (!reported[i][j] && OPCODE_PAIR_COUNTS[i][j] > best) {
+                    best = OPCODE_PAIR_COUNTS[i][j];
+                    best_first = i;
+                    best_second = j;
+                }
+            }
+        }
+
+        if (best == 0) {
+            break;
+        }
+
+        reported[best_first][best_second] = true;
+        fprintf(f, "  %02x %02x  %12lu  %5.2f%%\n",
+                best_first, best_second, best, 100.0 * best / total);
+    }
+}
+
+#endif
+
+
+
 /*
  * Bytecode interpreter
  */
@@ -396,10 +1042,8 @@ static void fiber_tick(struct fiber *fib)
     instr_t instruction;
     unsigned char opcode;
     unsigned int argument;
-    objptr_t object, object2, func;
+    objptr_t object;
     struct continuation_frame *frame;
-    struct closure *closure;
-    struct closure_prototype *closure_prototype;
 
     /*
      * Return from functions
@@ -418,6 +1062,7 @@ static void fiber_tick(struct fiber *fib)
 	    // Restore environment
 	    decrease_refcount(fib->environment);
 	    fib->environment = frame->environment;
+	    increase_refcount(fib->environment);
 
 	    // Restore code pointer
 	    code_pointer_copy(&(fib->instr_pointer), &(frame->instr_pointer));
@@ -431,6 +1076,14 @@ static void fiber_tick(struct fiber *fib)
     }
 
 
+    /*
+     * Native code runs until it leaves the procedure
+     */
+    if (fib->instr_pointer.code->native != NULL) {
+        jit_run(fib->instr_pointer.code, fib);
+        return;
+    }
+
     /*
      * Let's start interpreting bytecodes!
      */
@@ -438,114 +1091,55 @@ static void fiber_tick(struct fiber *fib)
     instruction = code_pointer_get(&(fib->instr_pointer));
     opcode = INSTRUCTION_PART(instruction);
     argument = ARGUMENT_PART(instruction);
+
+#ifdef NIL_PROFILE_OPCODES
+    profile_opcode(opcode);
+#endif
     
     switch (opcode) {
-    case INSTR_HALT:
-        fib->waiting_condition.state = HALTED;
-	break;
-
-    case INSTR_PUSH_CONST:
-	fiber_push(fib,
-                   code_pointer_get_constant(&(fib->instr_pointer), argument));
-	break;
-
-    case INSTR_LOOKUP_CONST:
-	object = code_pointer_get_constant(&(fib->instr_pointer), argument);
-	fiber_push(fib, environment_get_binding(fib->environment, object));
-	break;
-
-    case INSTR_JMP:
-	code_pointer_jump(&(fib->instr_pointer), argument);
-	break;
-
-    case INSTR_JMP_IF_NOT:
-	object = fiber_pop(fib);
-	if (object != NIL_FALSE) {
-	    code_pointer_jump(&(fib->instr_pointer), argument);
-	}
-	decrease_refcount(object);
-	break;
-
-    case INSTR_CALL:
-        object = fiber_get_continuation(fib);
-        // We can do this since the continuation definitely contains a link
-        // to the older clink
-        decrease_refcount(fib->clink);
-        fib->clink = object;
-        increase_refcount(fib->clink);
-    case INSTR_TAILCALL:
-        func = fiber_pop(fib);
-        if (is_of_type(func, &TYPE_CLOSURE)) {
-            closure = (struct closure*) dereference(func);
-
-            // Replace environment
-            decrease_refcount(fib->environment);
-            fib->environment = closure->environment;
-            increase_refcount(fib->environment);
-
-            if (!is_of_type(closure->prototype, &TYPE_CLOSURE_PROTOTYPE)) {
-                // XXX: error: invalid closure!
-            }
-
-            closure_prototype =
-                (struct closure_prototype*) dereference(closure->prototype);
+    case INSTR_HALT:                fiber_op_HALT(fib, argument);                break;
+    case INSTR_PUSH_CONST:          fiber_op_PUSH_CONST(fib, argument);          break;
+    case INSTR_LOOKUP_CONST:        fiber_op_LOOKUP_CONST(fib, argument);        break;
+    case INSTR_JMP:                 fiber_op_JMP(fib, argument);                 break;
+    case INSTR_JMP_IF_NOT:          fiber_op_JMP_IF_NOT(fib, argument);          break;
+    case INSTR_CALL:                fiber_op_CALL(fib, argument);                break;
+    case INSTR_TAILCALL:            fiber_op_TAILCALL(fib, argument);            break;
+    case INSTR_SELF_TAILCALL:       fiber_op_SELF_TAILCALL(fib, argument);       break;
+    case INSTR_SET_CONST:           fiber_op_SET_CONST(fib, argument);           break;
+    case INSTR_SET_CONST_DROP:      fiber_op_SET_CONST_DROP(fib, argument);      break;
+    case INSTR_DEFINE_CONST:        fiber_op_DEFINE_CONST(fib, argument);        break;
+    case INSTR_DEFINE_CONST_DROP:   fiber_op_DEFINE_CONST_DROP(fib, argument);   break;
+    case INSTR_POP:                 fiber_op_POP(fib, argument);                 break;
+    case INSTR_MAKE_CLOSURE:        fiber_op_MAKE_CLOSURE(fib, argument);        break;
+    case INSTR_COMPILE_TO_THUNK:    fiber_op_COMPILE_TO_THUNK(fib, argument);    break;
 
-            // Unpack parameters
-            object = fiber_unwrap_params(fib,
-                                         argument,
-                                         closure_prototype->parameter_vector,
-                                         closure_prototype->rest_parameter);
-            decrease_refcount(fib->environment);
-            fib->environment = object;
-            increase_refcount(fib->environment);
+    /*
+     * Inlined builtins
+     */
 
-            // Set code pointer
-            code_pointer_enter_func(&(fib->instr_pointer), closure->prototype);
-        } else {
-            // XXX: error: can't call this!
-        }
-        decrease_refcount(func);
-	break;
+    case INSTR_CAR:     fiber_op_CAR(fib, argument);     break;
+    case INSTR_CDR:     fiber_op_CDR(fib, argument);     break;
+    case INSTR_NULL:    fiber_op_NULL(fib, argument);    break;
+    case INSTR_NOT:     fiber_op_NOT(fib, argument);     break;
+    case INSTR_CONS:    fiber_op_CONS(fib, argument);    break;
+    case INSTR_EQ:      fiber_op_EQ(fib, argument);      break;
+    case INSTR_ADD:     fiber_op_ADD(fib, argument);     break;
+    case INSTR_SUB:     fiber_op_SUB(fib, argument);     break;
+    case INSTR_LT:      fiber_op_LT(fib, argument);      break;
+    case INSTR_NUM_EQ:  fiber_op_NUM_EQ(fib, argument);  break;
 
-    case INSTR_SET_CONST:
-        object = fiber_pop(fib);
-        environment_bind(fib->environment,
-                         code_pointer_get_constant(&(fib->instr_pointer),
-                                                   argument),
-                         object);
-        fiber_push(fib, object);
-        decrease_refcount(object);
-	break;
 
-    case INSTR_DEFINE_CONST:
-        object = fiber_pop(fib);
-        environment_bind(fib->environment,
-                         code_pointer_get_constant(&(fib->instr_pointer),
-                                                   argument),
-                         object);
-        fiber_push(fib, object);
-        decrease_refcount(object);
-	break;
+    /*
+     * Superinstructions execute both of their parts with a
+     * single dispatch.
+     */
 
-    case INSTR_POP:
-        for (unsigned int i = 0; i < argument; i++)
-        {
-            decrease_refcount(fiber_pop(fib));
-        }
-	break;
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS) \
+    case INSTR_##NAME:  fiber_op_##NAME(fib, argument);  break;
 
-    case INSTR_MAKE_CLOSURE:
-        object = code_pointer_get_constant(&(fib->instr_pointer), argument);
-        fiber_push(fib, make_closure_from_prototype(object, fib->environment));
-	break;
+    SUPERINSTRUCTION_TABLE
 
-    case INSTR_COMPILE_TO_THUNK:
-        object2 = fiber_pop(fib);
-        object = fiber_pop(fib);
-        fiber_push(fib, compile_to_thunk(object, object2));
-        decrease_refcount(object2);
-        decrease_refcount(object);
-        break;
+#undef SUPERINSTRUCTION
         
     default:
 	// TODO
@@ -4,6 +4,7 @@
 #define FIBER_H_
 
 #include <stdbool.h>
+#include <stdio.h>
 
 #include "object.h"
 #include "compiler.h"
@@ -69,7 +70,15 @@ struct fiber {
 
 struct fiber *start_in_fiber(objptr_t);
 
+// The operand stack, the popped object has a reference for the caller
+void fiber_push(struct fiber*, objptr_t);
+objptr_t fiber_pop(struct fiber*);
+
 void run_main_loop();
 
+#ifdef NIL_PROFILE_OPCODES
+void print_opcode_profile(FILE*);
+#endif
+
 
 #endif
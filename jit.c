@@ -0,0 +1,518 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bytecode.h"
+#include "fiber.h"
+#include "number.h"
+#include "pair.h"
+#include "primitive.h"
+
+#include "jit.h"
+
+#ifdef NIL_JIT
+#include <sys/mman.h>
+#endif
+
+
+
+/*
+ * Instructions which never change the offset or leave the
+ * procedure don't need the check after the handler.
+ */
+bool jit_is_straight_instruction(unsigned int opcode)
+{
+    switch (opcode) {
+    case INSTR_PUSH_CONST:
+    case INSTR_LOOKUP_CONST:
+    case INSTR_SET_CONST:
+    case INSTR_SET_CONST_DROP:
+    case INSTR_DEFINE_CONST:
+    case INSTR_DEFINE_CONST_DROP:
+    case INSTR_POP:
+    case INSTR_MAKE_CLOSURE:
+    case INSTR_COMPILE_TO_THUNK:
+    case INSTR_LOOKUP_LOOKUP:
+        return true;
+    default:
+        return false;
+    }
+}
+
+
+
+#ifdef NIL_JIT
+
+/*
+ * Fast paths
+ *
+ * The templates of some inlined builtins first call one of these,
+ * which handles fixnums and pairs without the generic number code.
+ * When the builtin was rebound or the operands don't qualify, they
+ * leave the stack alone and the template calls the handler.
+ */
+
+static bool get_fixnum(objptr_t object, int *value)
+{
+    struct number buffer;
+    struct number *number;
+
+    if (!is_of_type(object, &TYPE_NUMBER)) return false;
+    number = number_view(object, &buffer);
+    if (number->type != NUMBER_INTEGER) return false;
+    *value = number->value.integer;
+    return true;
+}
+
+
+static bool get_fixnum_operands(struct fiber *fib, unsigned int opcode, int *a, int *b)
+{
+    return PRIMITIVE_INLINE_GUARDS[opcode]
+        && get_fixnum(get_car(get_cdr(fib->stack_ptr)), a)
+        && get_fixnum(get_car(fib->stack_ptr), b);
+}
+
+
+static void drop_operands(struct fiber *fib, unsigned int count)
+{
+    while (count-- > 0) {
+        decrease_refcount(fiber_pop(fib));
+    }
+}
+
+
+// ADD and SUB which don't overflow
+static bool fast_arithmetic(struct fiber *fib, unsigned int opcode)
+{
+    int a, b, result;
+    bool overflow;
+
+    if (!get_fixnum_operands(fib, opcode, &a, &b)) return false;
+    overflow = (opcode == INSTR_ADD)
+        ? __builtin_add_overflow(a, b, &result)
+        : __builtin_sub_overflow(a, b, &result);
+    if (overflow) return false;
+
+    drop_operands(fib, 2);
+    fiber_push(fib, make_integer(result));
+    return true;
+}
+
+
+// LT and NUM_EQ before a JMP_IF_NOT, -1 when the handler must run
+static int fast_compare(struct fiber *fib, unsigned int opcode)
+{
+    int a, b;
+
+    if (!get_fixnum_operands(fib, opcode, &a, &b)) return -1;
+    drop_operands(fib, 2);
+    return (opcode == INSTR_LT) ? (a < b) : (a == b);
+}
+
+
+// CAR and CDR of a pair
+static bool fast_pair_access(struct fiber *fib, unsigned int opcode)
+{
+    objptr_t pair;
+
+    if (!PRIMITIVE_INLINE_GUARDS[opcode]
+        || !is_of_type(get_car(fib->stack_ptr), &TYPE_PAIR)) {
+        return false;
+    }
+
+    pair = fiber_pop(fib);
+    fiber_push(fib, (opcode == INSTR_CAR) ? get_car(pair) : get_cdr(pair));
+    decrease_refcount(pair);
+    return true;
+}
+
+
+// Pops the condition of a JMP_IF_NOT and tells whether it holds
+static bool pop_condition(struct fiber *fib, unsigned int argument)
+{
+    objptr_t object;
+
+    object = fiber_pop(fib);
+    decrease_refcount(object);
+    return object != NIL_FALSE;
+}
+
+
+
+/*
+ * Code layout
+ *
+ *   entry:     save registers, load the fiber (rbx), the expected
+ *              code (r12), the jump budget (r13) and the offset
+ *              (eax), then jump to select
+ *   dispatch:  count a taken jump, leave when the budget is spent
+ *   select:    leave if the offset is past the end, otherwise jump
+ *              to the instruction through the jump table
+ *   exit:      restore registers and return
+ *   L_0 ...:   one template per instruction
+ *   L_n:       the end of the procedure
+ *   table:     addresses of L_0 ...
+ *
+ * Every template first stores the offset of the next instruction,
+ * just like the interpreter's fetch, and then calls the handler.
+ * Afterwards it checks that the handler didn't leave the procedure
+ * and continues with the next template, or jumps through dispatch
+ * if the handler changed the offset.
+ *
+ * Jumps, conditional jumps and comparisons followed by one branch
+ * to their target's template directly, counting against the budget
+ * on their own. ADD, SUB, CAR and CDR try a fast path before the
+ * handler.
+ */
+
+#define OFFSET_DISPLACEMENT offsetof(struct fiber, instr_pointer.offset)
+#define CODE_DISPLACEMENT   offsetof(struct fiber, instr_pointer.code)
+
+// Longest template, see emit_instruction()
+#define MAX_TEMPLATE_SIZE 160
+#define MAX_FRAME_SIZE    128
+
+// Condition codes of jcc rel32
+#define JZ  0x84
+#define JNZ 0x85
+#define JS  0x88
+
+
+// A rel32 field to patch with the address of a template
+struct fixup {
+    unsigned char *field;
+    unsigned int target;
+};
+
+
+struct emitter {
+    unsigned char *start;
+    unsigned char *position;
+    unsigned char *dispatch;
+    unsigned char *exit;
+    struct fixup *fixups;
+    unsigned int fixup_count;
+};
+
+
+static void emit_bytes(struct emitter *e, const void *bytes, size_t size)
+{
+    memcpy(e->position, bytes, size);
+    e->position += size;
+}
+
+
+static void emit_byte(struct emitter *e, unsigned char byte)
+{
+    *(e->position++) = byte;
+}
+
+
+static void emit_u32(struct emitter *e, uint32_t value)
+{
+    emit_bytes(e, &value, sizeof(value));
+}
+
+
+static void emit_u64(struct emitter *e, uint64_t value)
+{
+    emit_bytes(e, &value, sizeof(value));
+}
+
+
+// Emits a rel32 field pointing at TARGET, or a placeholder for NULL
+static unsigned char *emit_rel32(struct emitter *e, unsigned char *target)
+{
+    unsigned char *field;
+
+    field = e->position;
+    emit_u32(e, target == NULL ? 0 : (uint32_t) (target - (field + 4)));
+    return field;
+}
+
+
+static void patch_rel32(unsigned char *field, unsigned char *target)
+{
+    uint32_t value;
+
+    value = (uint32_t) (target - (field + 4));
+    memcpy(field, &value, sizeof(value));
+}
+
+
+// Emits a rel32 field pointing at the template of instruction TARGET
+static void emit_label_rel32(struct emitter *e, unsigned int target)
+{
+    e->fixups[e->fixup_count].field = emit_rel32(e, NULL);
+    e->fixups[e->fixup_count].target = target;
+    e->fixup_count++;
+}
+
+
+static void emit_jmp(struct emitter *e, unsigned char *target)
+{
+    emit_byte(e, 0xe9);                                  // jmp rel32
+    emit_rel32(e, target);
+}
+
+
+static unsigned char *emit_jcc(struct emitter *e, unsigned char condition, unsigned char *target)
+{
+    emit_byte(e, 0x0f); emit_byte(e, condition);         // jcc rel32
+    return emit_rel32(e, target);
+}
+
+
+static void emit_store_offset(struct emitter *e, unsigned int offset)
+{
+    emit_byte(e, 0xc7); emit_byte(e, 0x83);              // mov dword [rbx + offset], value
+    emit_u32(e, OFFSET_DISPLACEMENT);
+    emit_u32(e, offset);
+}
+
+
+// Calls FUNCTION with the fiber and ARGUMENT
+static void emit_call(struct emitter *e, uintptr_t function, unsigned int argument)
+{
+    emit_byte(e, 0x48); emit_byte(e, 0x89); emit_byte(e, 0xdf);  // mov rdi, rbx
+    emit_byte(e, 0xbe); emit_u32(e, argument);           // mov esi, argument
+    emit_byte(e, 0x48); emit_byte(e, 0xb8);              // mov rax, function
+    emit_u64(e, (uint64_t) function);
+    emit_byte(e, 0xff); emit_byte(e, 0xd0);              // call rax
+}
+
+
+// A taken jump within the procedure
+static void emit_jump(struct emitter *e, unsigned int target)
+{
+    emit_store_offset(e, target);
+    emit_byte(e, 0x41); emit_byte(e, 0xff); emit_byte(e, 0xcd);  // dec r13d
+    emit_jcc(e, JZ, e->exit);
+    emit_byte(e, 0xe9);                                  // jmp L_target
+    emit_label_rel32(e, target);
+}
+
+
+static void emit_handler(struct emitter *e,
+                         fiber_op_t handler,
+                         unsigned int opcode,
+                         unsigned int argument,
+                         unsigned int offset)
+{
+    emit_store_offset(e, offset + 1);
+    emit_call(e, (uintptr_t) handler, argument);
+
+    if (opcode == INSTR_HALT) {
+        emit_jmp(e, e->exit);
+    } else if (!jit_is_straight_instruction(opcode)) {
+        emit_byte(e, 0x4c); emit_byte(e, 0x3b); emit_byte(e, 0xa3);  // cmp r12, [rbx + code]
+        emit_u32(e, CODE_DISPLACEMENT);
+        emit_jcc(e, JNZ, e->exit);
+        emit_byte(e, 0x8b); emit_byte(e, 0x83);          // mov eax, [rbx + offset]
+        emit_u32(e, OFFSET_DISPLACEMENT);
+        emit_byte(e, 0x3d); emit_u32(e, offset + 1);     // cmp eax, next
+        emit_jcc(e, JNZ, e->dispatch);
+    }
+}
+
+
+static void emit_instruction(struct emitter *e,
+                             struct code *code,
+                             unsigned int offset,
+                             const fiber_op_t *handlers)
+{
+    unsigned int opcode, argument;
+    unsigned char *false_field, *slow_field;
+
+    opcode = INSTRUCTION_PART(code->codes[offset]);
+    argument = ARGUMENT_PART(code->codes[offset]);
+
+    switch (opcode) {
+    case INSTR_JMP:
+        emit_jump(e, argument);
+        return;
+
+    case INSTR_JMP_IF_NOT:
+        emit_store_offset(e, offset + 1);
+        emit_call(e, (uintptr_t) pop_condition, 0);
+        emit_byte(e, 0x84); emit_byte(e, 0xc0);          // test al, al
+        emit_byte(e, 0x0f); emit_byte(e, JNZ);           // jnz L_(offset + 1)
+        emit_label_rel32(e, offset + 1);
+        emit_jump(e, argument);
+        return;
+
+    case INSTR_LT:
+    case INSTR_NUM_EQ:
+        if (offset + 1 < code->code_size
+            && INSTRUCTION_PART(code->codes[offset + 1]) == INSTR_JMP_IF_NOT) {
+            emit_store_offset(e, offset + 1);
+            emit_call(e, (uintptr_t) fast_compare, opcode);
+            emit_byte(e, 0x85); emit_byte(e, 0xc0);      // test eax, eax
+            slow_field = emit_jcc(e, JS, NULL);
+            false_field = emit_jcc(e, JZ, NULL);
+            emit_byte(e, 0xe9);                          // jmp L_(offset + 2)
+            emit_label_rel32(e, offset + 2);
+            patch_rel32(false_field, e->position);
+            emit_jump(e, ARGUMENT_PART(code->codes[offset + 1]));
+            patch_rel32(slow_field, e->position);
+        }
+        break;
+
+    case INSTR_ADD:
+    case INSTR_SUB:
+    case INSTR_CAR:
+    case INSTR_CDR:
+        emit_store_offset(e, offset + 1);
+        emit_call(e, (opcode == INSTR_ADD || opcode == INSTR_SUB)
+                  ? (uintptr_t) fast_arithmetic
+                  : (uintptr_t) fast_pair_access,
+                  opcode);
+        emit_byte(e, 0x84); emit_byte(e, 0xc0);          // test al, al
+        emit_byte(e, 0x0f); emit_byte(e, JNZ);           // jnz L_(offset + 1)
+        emit_label_rel32(e, offset + 1);
+        break;
+    }
+
+    emit_handler(e, handlers[opcode], opcode, argument, offset);
+}
+
+
+bool jit_compile(struct code *code, const fiber_op_t *handlers)
+{
+    struct emitter e;
+    struct jit_code *native;
+    size_t size, page_size;
+    void *mapping;
+    unsigned char *budget_field, *end_field, *table_field;
+    unsigned char **labels;
+    uint64_t *table;
+    unsigned int i;
+
+    if (code->code_size == 0 || code->native != NULL) return false;
+
+    labels = malloc((code->code_size + 1) * sizeof(unsigned char*));
+    e.fixups = malloc(2 * code->code_size * sizeof(struct fixup));
+    if (labels == NULL || e.fixups == NULL) {
+        free(labels);
+        free(e.fixups);
+        return false;
+    }
+    e.fixup_count = 0;
+
+    page_size = 4096;
+    size = sizeof(struct jit_code) + MAX_FRAME_SIZE
+        + code->code_size * (MAX_TEMPLATE_SIZE + sizeof(uint64_t)) + sizeof(uint64_t);
+    size = (size + page_size - 1) / page_size * page_size;
+
+    mapping = mmap(NULL, size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        free(labels);
+        free(e.fixups);
+        return false;
+    }
+
+    native = mapping;
+    native->size = size;
+    e.start = (unsigned char*) mapping + sizeof(struct jit_code);
+    e.position = e.start;
+
+    // entry
+    emit_byte(&e, 0x53);                                 // push rbx
+    emit_byte(&e, 0x41); emit_byte(&e, 0x54);            // push r12
+    emit_byte(&e, 0x41); emit_byte(&e, 0x55);            // push r13
+    emit_byte(&e, 0x48); emit_byte(&e, 0x89); emit_byte(&e, 0xfb);  // mov rbx, rdi
+    emit_byte(&e, 0x49); emit_byte(&e, 0xbc);            // mov r12, code
+    emit_u64(&e, (uint64_t) (uintptr_t) code);
+    emit_byte(&e, 0x41); emit_byte(&e, 0xbd);            // mov r13d, budget
+    emit_u32(&e, JIT_JUMP_BUDGET);
+    emit_byte(&e, 0x8b); emit_byte(&e, 0x83);            // mov eax, [rbx + offset]
+    emit_u32(&e, OFFSET_DISPLACEMENT);
+    emit_byte(&e, 0xeb); emit_byte(&e, 9);               // jmp short select
+
+    // dispatch
+    e.dispatch = e.position;
+    emit_byte(&e, 0x41); emit_byte(&e, 0xff); emit_byte(&e, 0xcd);  // dec r13d
+    emit_byte(&e, 0x0f); emit_byte(&e, 0x84);            // jz exit
+    budget_field = emit_rel32(&e, NULL);
+
+    // select
+    emit_byte(&e, 0x3d); emit_u32(&e, code->code_size);  // cmp eax, code_size
+    emit_byte(&e, 0x0f); emit_byte(&e, 0x83);            // jae exit
+    end_field = emit_rel32(&e, NULL);
+    emit_byte(&e, 0x48); emit_byte(&e, 0x8d); emit_byte(&e, 0x0d);  // lea rcx, [rip + table]
+    table_field = emit_rel32(&e, NULL);
+    emit_byte(&e, 0xff); emit_byte(&e, 0x24); emit_byte(&e, 0xc1);  // jmp [rcx + rax * 8]
+
+    // exit
+    e.exit = e.position;
+    emit_byte(&e, 0x41); emit_byte(&e, 0x5d);            // pop r13
+    emit_byte(&e, 0x41); emit_byte(&e, 0x5c);            // pop r12
+    emit_byte(&e, 0x5b);                                 // pop rbx
+    emit_byte(&e, 0xc3);                                 // ret
+
+    patch_rel32(budget_field, e.exit);
+    patch_rel32(end_field, e.exit);
+
+    for (i = 0; i < code->code_size; i++) {
+        labels[i] = e.position;
+        emit_instruction(&e, code, i, handlers);
+    }
+    labels[i] = e.position;  // Return from the procedure
+    emit_store_offset(&e, code->code_size);
+    emit_jmp(&e, e.exit);
+
+    for (i = 0; i < e.fixup_count; i++) {
+        patch_rel32(e.fixups[i].field, labels[e.fixups[i].target]);
+    }
+    free(e.fixups);
+
+    // table
+    while (((uintptr_t) e.position) % sizeof(uint64_t) != 0) {
+        emit_byte(&e, 0xcc);                             // int3
+    }
+    table = (uint64_t*) e.position;
+    patch_rel32(table_field, e.position);
+    for (i = 0; i < code->code_size; i++) {
+        table[i] = (uint64_t) (uintptr_t) labels[i];
+    }
+    free(labels);
+
+    native->entry = (void (*)(struct fiber*)) e.start;
+    if (mprotect(mapping, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(mapping, size);
+        return false;
+    }
+
+    code->native = native;
+    return true;
+}
+
+#endif
+
+
+void jit_run(struct code *code, struct fiber *fib)
+{
+    objptr_t func;
+
+    /*
+     * A tail call may drop the last reference to the running
+     * prototype, which must not be freed before its code returned.
+     */
+    func = fib->instr_pointer.func;
+    increase_refcount(func);
+    code->native->entry(fib);
+    decrease_refcount(func);
+}
+
+
+void jit_free(struct code *code)
+{
+#ifdef NIL_JIT
+    if (code->native != NULL && code->native->size > 0) {
+        munmap(code->native, code->native->size);
+    }
+#endif
+    code->native = NULL;
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#ifndef JIT_H_
+#define JIT_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "compiler.h"
+
+
+/*
+ * Baseline JIT
+ *
+ * Hot prototypes are translated to x86-64 code which calls the
+ * interpreter's instruction handlers one after another, so the
+ * fetch, decode and dispatch of the bytecode loop disappear. The
+ * fiber and the running code are kept in registers, and jumps
+ * within the procedure are native jumps. Fixnum +, -, < and =, car
+ * and cdr try guarded fast paths first, and a comparison followed
+ * by a conditional jump branches on the result without pushing
+ * it. These fast paths are C functions too, which keep the
+ * operand stack and allocate like the handlers. Whenever control
+ * leaves the procedure (calls, returns, HALT), the native code
+ * returns to the interpreter, which continues with the next
+ * procedure.
+ *
+ * The JIT is opt-in: build with -DNIL_JIT to use it. It only pays
+ * off when the handlers it calls are optimized, and in the default
+ * -g build it is slower than the interpreter. It is left out on
+ * other architectures and when profiling opcodes.
+ */
+
+#if defined(NIL_JIT) && (!defined(__x86_64__) || defined(NIL_PROFILE_OPCODES))
+#undef NIL_JIT
+#endif
+
+// Calls and backward jumps of a prototype before it gets compiled
+#define JIT_THRESHOLD 16
+
+// Jumps taken by compiled code before returning to the main loop
+#define JIT_JUMP_BUDGET 4096
+
+
+struct fiber;
+
+typedef void (*fiber_op_t)(struct fiber*, unsigned int);
+
+// The interpreter's instruction handlers by opcode
+extern const fiber_op_t FIBER_OPS[256];
+
+// The names of the handlers after "fiber_op_", NULL for unknown opcodes
+extern const char *const FIBER_OP_NAMES[256];
+
+
+/*
+ * The handlers of the basic instructions, which ahead-of-time
+ * compiled code calls directly. Superinstructions have handlers
+ * named after them too, see bytecode.h.
+ */
+#define FIBER_OP_TABLE            \
+    FIBER_OP(HALT)                \
+    FIBER_OP(PUSH_CONST)          \
+    FIBER_OP(LOOKUP_CONST)        \
+    FIBER_OP(JMP)                 \
+    FIBER_OP(JMP_IF_NOT)          \
+    FIBER_OP(CALL)                \
+    FIBER_OP(TAILCALL)            \
+    FIBER_OP(SET_CONST)           \
+    FIBER_OP(DEFINE_CONST)        \
+    FIBER_OP(POP)                 \
+    FIBER_OP(MAKE_CLOSURE)        \
+    FIBER_OP(COMPILE_TO_THUNK)    \
+    FIBER_OP(CAR)                 \
+    FIBER_OP(CDR)                 \
+    FIBER_OP(CONS)                \
+    FIBER_OP(EQ)                  \
+    FIBER_OP(NULL)                \
+    FIBER_OP(NOT)                 \
+    FIBER_OP(ADD)                 \
+    FIBER_OP(SUB)                 \
+    FIBER_OP(LT)                  \
+    FIBER_OP(NUM_EQ)              \
+    FIBER_OP(SET_CONST_DROP)      \
+    FIBER_OP(DEFINE_CONST_DROP)   \
+    FIBER_OP(SELF_TAILCALL)
+
+#define FIBER_OP(NAME) void fiber_op_##NAME(struct fiber*, unsigned int);
+FIBER_OP_TABLE
+#undef FIBER_OP
+
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS) \
+    void fiber_op_##NAME(struct fiber*, unsigned int);
+SUPERINSTRUCTION_TABLE
+#undef SUPERINSTRUCTION
+
+
+/*
+ * Native code of a procedure, entered with the fiber's offset
+ * pointing into the procedure. Code from the JIT lives in a mapping
+ * of SIZE bytes, ahead-of-time compiled code (see aot.h) is static
+ * and has a SIZE of 0.
+ */
+struct jit_code {
+    size_t size;
+    void (*entry)(struct fiber*);
+};
+
+
+#ifdef NIL_JIT
+bool jit_compile(struct code*, const fiber_op_t*);
+#endif
+
+bool jit_is_straight_instruction(unsigned int);
+void jit_run(struct code*, struct fiber*);
+void jit_free(struct code*);
+
+
+#endif
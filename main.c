@@ -1,25 +1,206 @@
 #include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
 
 #include "character.h"
+#include "closure.h"
 #include "vector.h"
+#include "string_object.h"
 #include "symbol.h"
+#include "builtins.h"
 
 #include "compiler.h"
 #include "fiber.h"
 #include "baby_io.h"
+#include "bytecode_file.h"
+#include "aot.h"
 
 
-void go()
+#define BOOT_SOURCE   "./lib/boot.scm"
+#define BOOT_BYTECODE "./lib/boot.nilc"
+
+// Forms loaded between collections of their finished fibers
+#define LOAD_COLLECT_INTERVAL 4096
+
+
+objptr_t compile_source_file(const char *path)
 {
+    struct baby_reader reader;
     bool fail;
     objptr_t func;
-    
-    FILE *f = fopen("./lib/boot.scm", "r");
-    func = compile_to_thunk(baby_read(f, &fail), EMPTY_LIST);
+
+    if (!open_file_reader(&reader, path)) return EMPTY_LIST;
+    func = compile_to_thunk(reader_read(&reader, &fail), GLOBAL_ENVIRONMENT);
+    close_reader(&reader);
+    return func;
+}
+
+
+objptr_t load_bytecode_thunk(const char *path)
+{
+    objptr_t proto, func;
+
+    proto = read_bytecode_file(path);
+    if (proto == EMPTY_LIST) return EMPTY_LIST;
+
+    func = make_closure_from_prototype(proto, GLOBAL_ENVIRONMENT);
+    decrease_refcount(proto);
+    return func;
+}
+
+
+/*
+ * Uses the boot library linked into the executable if there is one.
+ * Otherwise uses the compiled boot file if it is at least as new as
+ * the source, and compiles the source if it isn't.
+ */
+objptr_t load_boot_thunk()
+{
+    struct stat source_info, bytecode_info;
+    objptr_t proto, func;
+
+    proto = aot_load("boot");
+    if (proto != EMPTY_LIST) {
+        func = make_closure_from_prototype(proto, GLOBAL_ENVIRONMENT);
+        decrease_refcount(proto);
+        return func;
+    }
+
+    if (stat(BOOT_BYTECODE, &bytecode_info) == 0 &&
+        (stat(BOOT_SOURCE, &source_info) != 0 ||
+         bytecode_info.st_mtime >= source_info.st_mtime)) {
+        func = load_bytecode_thunk(BOOT_BYTECODE);
+        if (func != EMPTY_LIST) return func;
+        fprintf(stderr, "Ignoring unusable %s\n", BOOT_BYTECODE);
+    }
+
+    return compile_source_file(BOOT_SOURCE);
+}
+
+
+void run_thunk(objptr_t func)
+{
     declare_root_object(func);
     start_in_fiber(func);
     run_main_loop();
-    fclose(f);
+}
+
+
+/*
+ * Runs the boot library. Returns false if there is none.
+ */
+bool go()
+{
+    objptr_t func;
+
+    func = load_boot_thunk();
+    if (func == EMPTY_LIST) return false;
+
+    run_thunk(func);
+    return true;
+}
+
+
+/*
+ * Reads, compiles and runs the forms of a source file one at a time,
+ * so that only one form and a buffer of the file are in memory at
+ * once. Reads the standard input for "-". Reports the throughput on
+ * the standard error unless QUIET is set. Returns false if the file
+ * can't be read or a form can't be parsed.
+ */
+bool load_source_file(const char *path, bool quiet)
+{
+    struct baby_reader reader;
+    struct timespec start, end;
+    FILE *stream;
+    unsigned long forms;
+    bool fail;
+    objptr_t expr, func;
+    double seconds;
+
+    stream = (strcmp(path, "-") == 0) ? stdin : fopen(path, "r");
+    if (stream == NULL) {
+        fprintf(stderr, "Could not load %s\n", path);
+        return false;
+    }
+    if (!open_stream_reader(&reader, stream)) {
+        fprintf(stderr, "Could not load %s: out of memory\n", path);
+        if (stream != stdin) fclose(stream);
+        return false;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    forms = 0;
+    fail = false;
+    while (!reader_at_end(&reader)) {
+        expr = reader_read(&reader, &fail);
+        if (fail) {
+            fprintf(stderr, "Syntax error in %s at byte %zu\n",
+                    path, reader_offset(&reader));
+            break;
+        }
+
+        increase_refcount(expr);
+        func = compile_to_thunk(expr, GLOBAL_ENVIRONMENT);
+        decrease_refcount(expr);
+        if (func == EMPTY_LIST) {
+            fprintf(stderr, "Could not compile form %lu of %s\n", forms + 1, path);
+            fail = true;
+            break;
+        }
+
+        // The fiber holds on to the thunk's code and environment
+        increase_refcount(func);
+        start_in_fiber(func);
+        decrease_refcount(func);
+        run_main_loop();
+
+        // Finished fibers are only freed by the collector
+        if (++forms % LOAD_COLLECT_INTERVAL == 0) garbage_collect();
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    if (!quiet) {
+        seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+        if (seconds <= 0) seconds = 1e-9;
+        fprintf(stderr, "Loaded %s: %lu forms, %zu bytes in %.3f s"
+                " (%.0f forms/s, %.2f MB/s)\n",
+                path, forms, reader_offset(&reader), seconds,
+                forms / seconds, reader_offset(&reader) / seconds / 1e6);
+    }
+
+    close_reader(&reader);
+    if (stream != stdin) fclose(stream);
+    return !fail;
+}
+
+
+/*
+ * Restores the state after booting from an image and runs the
+ * given file, either compiled or as source.
+ */
+bool go_from_image(const char *image, const char *path)
+{
+    objptr_t func;
+
+    if (!read_image_file(image)) {
+        fprintf(stderr, "Could not load image %s\n", image);
+        return false;
+    }
+
+    // Keep the restored library shared with forked processes
+    seal_heap();
+
+    func = load_bytecode_thunk(path);
+    if (func == EMPTY_LIST) func = compile_source_file(path);
+    if (func == EMPTY_LIST) {
+        fprintf(stderr, "Could not load %s\n", path);
+        return false;
+    }
+
+    run_thunk(func);
+    return true;
 }
 
 
@@ -29,24 +210,92 @@ void init()
     // TODO: More type inits
     init_characters();
     init_vectors();
+    init_strings();
     init_symbols();
+    init_constant_pool();
+    init_builtins();
 }
 
 
 void terminate()
 {
+#ifdef NIL_PROFILE_OPCODES
+    print_opcode_profile(stderr);
+#endif
+
     end_memory_system();
     // TODO: Free all type instances, like this:
+    terminate_builtins();
+    terminate_constant_pool();
     terminate_symbols();
+    terminate_strings();
     terminate_vectors();
     terminate_characters();
 }
 
 
+/*
+ * Loads source files, stopping at the first one which fails.
+ */
+bool load_source_files(char *paths[], int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++) {
+        if (!load_source_file(paths[i], false)) return false;
+    }
+    return true;
+}
+
+
+/*
+ * Usage:
+ *   nil [--no-boot] [MODE]
+ *
+ * Runs the boot library, then does what the mode says:
+ *   --compile SOURCE DESTINATION
+ *   --compile-c SOURCE DESTINATION MODULE
+ *   --save-image IMAGE [FILE ...]   loads the files, then saves
+ *   --image IMAGE FILE
+ *   --load FILE ...
+ *
+ * --no-boot skips the boot library, and so do --load and --save-image
+ * if there is none. The compile modes and --image never run it.
+ */
 int main(int argc, char *argv[])
 {
+    bool success = true;
+    bool boot = true;
+
     init();
-    go();
+    if (argc >= 2 && strcmp(argv[1], "--no-boot") == 0) {
+        boot = false;
+        argc--;
+        argv++;
+    }
+
+    if (argc == 4 && strcmp(argv[1], "--compile") == 0) {
+        success = compile_file(argv[2], argv[3]);
+        if (!success) fprintf(stderr, "Could not compile %s to %s\n", argv[2], argv[3]);
+    } else if (argc == 5 && strcmp(argv[1], "--compile-c") == 0) {
+        success = compile_file_to_c(argv[2], argv[3], argv[4]);
+        if (!success) fprintf(stderr, "Could not compile %s to %s\n", argv[2], argv[3]);
+    } else if (argc >= 3 && strcmp(argv[1], "--save-image") == 0) {
+        if (boot) go();
+        success = load_source_files(argv + 3, argc - 3);
+        if (success) {
+            success = write_image_file(argv[2]);
+            if (!success) fprintf(stderr, "Could not write image %s\n", argv[2]);
+        }
+    } else if (argc == 4 && strcmp(argv[1], "--image") == 0) {
+        success = go_from_image(argv[2], argv[3]);
+    } else if (argc >= 3 && strcmp(argv[1], "--load") == 0) {
+        if (boot) go();
+        success = load_source_files(argv + 2, argc - 2);
+    } else if (boot) {
+        success = go();
+        if (!success) fprintf(stderr, "Could not load %s\n", BOOT_SOURCE);
+    }
     terminate();
-    return 0;
+    return success ? 0 : 1;
 }
@@ -1,4 +1,9 @@
 
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
 #include "number.h"
 
 
@@ -11,6 +16,12 @@ void init_number(struct number *number)
 
 void terminate_number(struct number *number)
 {
+    if (number->type == NUMBER_BIGNUM) {
+	free(number->value.bignum.limbs);
+    } else if (number->type == NUMBER_BIG_RATIONAL) {
+	free(number->value.big_rational.numerator);
+	free(number->value.big_rational.denominator);
+    }
 }
 
 
@@ -20,7 +31,7 @@ bool number_eqv(struct number *e1,
 {
     if (e1 == e2) return true;
     
-    if (e1->type != e2->type) {
+    if (e1->type == e2->type) {
 	switch (e1->type) {
 	case NUMBER_INTEGER:
 	    if (e1->value.integer == e2->value.integer) {
@@ -44,6 +55,26 @@ bool number_eqv(struct number *e1,
 		return true;
 	    }
 	    break;
+	case NUMBER_BIGNUM:
+	    if (e1->value.bignum.negative == e2->value.bignum.negative
+		&& bignum_compare(e1->value.bignum.limbs, e1->value.bignum.length,
+				  e2->value.bignum.limbs, e2->value.bignum.length) == 0) {
+		return true;
+	    }
+	    break;
+	case NUMBER_BIG_RATIONAL:
+	    if (e1->value.big_rational.negative == e2->value.big_rational.negative
+		&& bignum_compare(e1->value.big_rational.numerator,
+				  e1->value.big_rational.numerator_length,
+				  e2->value.big_rational.numerator,
+				  e2->value.big_rational.numerator_length) == 0
+		&& bignum_compare(e1->value.big_rational.denominator,
+				  e1->value.big_rational.denominator_length,
+				  e2->value.big_rational.denominator,
+				  e2->value.big_rational.denominator_length) == 0) {
+		return true;
+	    }
+	    break;
 	}
     }
 
@@ -67,9 +98,1207 @@ DEFTYPE(TYPE_NUMBER,
 	NULL,
 	number_eqv);
 
+
+
+objptr_t make_integer(int value)
+{
+    objptr_t ptr;
+    struct number *number;
+
+    ptr = object_allocate(&TYPE_NUMBER);
+    if (ptr != EMPTY_LIST) {
+	number = (struct number*) dereference(ptr);
+	number->type = NUMBER_INTEGER;
+	number->value.integer = value;
+    }
+
+    return ptr;
+}
+
+
+/*
+ * Makes an integer from a sign and a magnitude, taking ownership of
+ * the limbs. Values which fit into an int become plain integers.
+ */
+objptr_t make_integer_from_limbs(bool negative, limb_t *limbs, unsigned int length)
+{
+    objptr_t ptr;
+    struct number *number;
+    uint64_t magnitude;
+
+    length = bignum_normalize(limbs, length);
+    if (length <= 2) {
+	magnitude = (length > 0) ? limbs[0] : 0;
+	if (length == 2) magnitude |= (uint64_t) limbs[1] << LIMB_BITS;
+	if (magnitude <= (negative ? (uint64_t) INT_MAX + 1 : (uint64_t) INT_MAX)) {
+	    free(limbs);
+	    return make_integer(negative ? (int) -(long long) magnitude : (int) magnitude);
+	}
+    }
+
+    ptr = object_allocate(&TYPE_NUMBER);
+    if (ptr == EMPTY_LIST) {
+	free(limbs);
+	return ptr;
+    }
+
+    number = (struct number*) dereference(ptr);
+    number->type = NUMBER_BIGNUM;
+    number->value.bignum.negative = negative;
+    number->value.bignum.length = length;
+    number->value.bignum.limbs = limbs;
+
+    return ptr;
+}
+
+
+// The largest magnitude of an int with the given sign
+#define INT_MAGNITUDE(NEGATIVE) \
+    ((NEGATIVE) ? (unsigned long long) INT_MAX + 1 : (unsigned long long) INT_MAX)
+
+
+// Stores a magnitude in a new array, returns NULL if there is no memory
+static limb_t *make_limbs(unsigned long long magnitude, unsigned int *length)
+{
+    limb_t *limbs;
+
+    limbs = malloc(2 * sizeof(limb_t));
+    if (limbs != NULL) {
+	limbs[0] = (limb_t) magnitude;
+	limbs[1] = (limb_t) (magnitude >> LIMB_BITS);
+	*length = bignum_normalize(limbs, 2);
+    }
+    return limbs;
+}
+
+
+static objptr_t make_integer_from_magnitude(bool negative, unsigned long long magnitude)
+{
+    limb_t *limbs;
+    unsigned int length;
+
+    if (magnitude <= INT_MAGNITUDE(negative)) {
+	return make_integer(negative ? (int) -(long long) magnitude : (int) magnitude);
+    }
+
+    limbs = make_limbs(magnitude, &length);
+    if (limbs == NULL) return EMPTY_LIST;
+
+    return make_integer_from_limbs(negative, limbs, length);
+}
+
+
+objptr_t make_integer_from_long_long(long long value)
+{
+    return make_integer_from_magnitude(value < 0, (value < 0) ? -(unsigned long long) value
+				       : (unsigned long long) value);
+}
+
+
+/*
+ * Returns the number a reference points to. Unboxed reals are
+ * unpacked into the buffer.
+ */
+struct number *number_view(objptr_t ptr, struct number *buffer)
+{
+#ifdef NIL_NAN_BOXING
+    if (IS_UNBOXED_REAL(ptr)) {
+	buffer->type = NUMBER_REAL;
+	buffer->value.real = unbox_real(ptr);
+	return buffer;
+    }
+#endif
+    return (struct number*) dereference(ptr);
+}
+
+
+objptr_t make_real(double value)
+{
+#ifdef NIL_NAN_BOXING
+    return box_real(value);
+#else
+    objptr_t ptr;
+    struct number *number;
+
+    ptr = object_allocate(&TYPE_NUMBER);
+    if (ptr != EMPTY_LIST) {
+	number = (struct number*) dereference(ptr);
+	number->type = NUMBER_REAL;
+	number->value.real = value;
+    }
+
+    return ptr;
+#endif
+}
+
+
+objptr_t make_rational(int numerator, unsigned int denominator)
+{
+    objptr_t ptr;
+    struct number *number;
+
+    ptr = object_allocate(&TYPE_NUMBER);
+    if (ptr != EMPTY_LIST) {
+	number = (struct number*) dereference(ptr);
+	number->type = NUMBER_RATIONAL;
+	number->value.rational.numerator = numerator;
+	number->value.rational.denominator = denominator;
+    }
+
+    return ptr;
+}
+
+
+/*
+ * Takes ownership of the limbs, which must be in lowest terms with a
+ * denominator above 1
+ */
+static objptr_t make_big_rational(bool negative,
+				  limb_t *numerator, unsigned int numerator_length,
+				  limb_t *denominator, unsigned int denominator_length)
+{
+    objptr_t ptr;
+    struct number *number;
+
+    ptr = object_allocate(&TYPE_NUMBER);
+    if (ptr == EMPTY_LIST) {
+	free(numerator);
+	free(denominator);
+	return ptr;
+    }
+
+    number = (struct number*) dereference(ptr);
+    number->type = NUMBER_BIG_RATIONAL;
+    number->value.big_rational.negative = negative;
+    number->value.big_rational.numerator_length = numerator_length;
+    number->value.big_rational.denominator_length = denominator_length;
+    number->value.big_rational.numerator = numerator;
+    number->value.big_rational.denominator = denominator;
+
+    return ptr;
+}
+
+
+objptr_t make_complex(double real, double imaginary)
+{
+    objptr_t ptr;
+    struct number *number;
+
+    ptr = object_allocate(&TYPE_NUMBER);
+    if (ptr != EMPTY_LIST) {
+	number = (struct number*) dereference(ptr);
+	number->type = NUMBER_COMPLEX;
+	number->value.complex.real = real;
+	number->value.complex.imaginary = imaginary;
+    }
+
+    return ptr;
+}
+
+
+
+/*
+ * Arithmetic
+ *
+ * Integers and reals take fast paths which don't look at other
+ * types. Integer results that don't fit are promoted to bignums,
+ * rationals whose parts don't fit to big rationals. The other cases
+ * go through the general path below.
+ */
+
+#define LIKELY(X)   __builtin_expect(!!(X), 1)
+#define UNLIKELY(X) __builtin_expect(!!(X), 0)
+
+
+enum arithmetic_operation {
+    OPERATION_ADD,
+    OPERATION_SUBTRACT,
+    OPERATION_MULTIPLY,
+    OPERATION_DIVIDE
+};
+
+
+static double bignum_to_double(struct number *number)
+{
+    double result;
+    unsigned int i;
+
+    result = 0.0;
+    for (i = number->value.bignum.length; i > 0; i--) {
+	result = result * 4294967296.0 + number->value.bignum.limbs[i - 1];
+    }
+    return number->value.bignum.negative ? -result : result;
+}
+
+
+// Returns a magnitude as the result times 2^EXPONENT
+static double scale_limbs(const limb_t *limbs, unsigned int length, int *exponent)
+{
+    double result;
+    unsigned int i, low;
+
+    // The top three limbs hold more bits than a double
+    low = (length > 3) ? length - 3 : 0;
+    result = 0.0;
+    for (i = length; i > low; i--) {
+	result = result * 4294967296.0 + limbs[i - 1];
+    }
+    *exponent = low * LIMB_BITS;
+    return result;
+}
+
+
+static double big_rational_to_double(struct number *number)
+{
+    double numerator, denominator, result;
+    int numerator_exponent, denominator_exponent;
+
+    numerator = scale_limbs(number->value.big_rational.numerator,
+			    number->value.big_rational.numerator_length,
+			    &numerator_exponent);
+    denominator = scale_limbs(number->value.big_rational.denominator,
+			      number->value.big_rational.denominator_length,
+			      &denominator_exponent);
+    result = ldexp(numerator / denominator, numerator_exponent - denominator_exponent);
+    return number->value.big_rational.negative ? -result : result;
+}
+
+
+static double number_to_double(struct number *number)
+{
+    switch (number->type) {
+    case NUMBER_INTEGER:  return (double) number->value.integer;
+    case NUMBER_REAL:     return number->value.real;
+    case NUMBER_RATIONAL:
+	return (double) number->value.rational.numerator
+	    / (double) number->value.rational.denominator;
+    case NUMBER_COMPLEX:  return number->value.complex.real;
+    case NUMBER_BIGNUM:   return bignum_to_double(number);
+    case NUMBER_BIG_RATIONAL:  return big_rational_to_double(number);
+    default:              return 0.0;
+    }
+}
+
+
+static bool is_integer(struct number *number)
+{
+    return number->type == NUMBER_INTEGER || number->type == NUMBER_BIGNUM;
+}
+
+
+static bool is_exact(struct number *number)
+{
+    return number->type == NUMBER_INTEGER || number->type == NUMBER_RATIONAL
+	|| number->type == NUMBER_BIGNUM || number->type == NUMBER_BIG_RATIONAL;
+}
+
+
+// Exact numbers with small parts
+static bool is_small_exact(struct number *number)
+{
+    return number->type == NUMBER_INTEGER || number->type == NUMBER_RATIONAL;
+}
+
+
+static void exact_parts(struct number *number,
+			long long *numerator, long long *denominator)
+{
+    if (number->type == NUMBER_INTEGER) {
+	*numerator = number->value.integer;
+	*denominator = 1;
+    } else {
+	*numerator = number->value.rational.numerator;
+	*denominator = number->value.rational.denominator;
+    }
+}
+
+
+static unsigned long long gcd(unsigned long long a, unsigned long long b)
+{
+    unsigned long long t;
+
+    while (b != 0) {
+	t = a % b;
+	a = b;
+	b = t;
+    }
+    return a;
+}
+
+
+/*
+ * Exact division by zero has no result
+ */
+static objptr_t division_by_zero()
+{
+    fprintf(stderr, "Error: Division by zero\n");
+    return EMPTY_LIST;
+}
+
+
+/*
+ * Makes the number numerator/denominator in lowest terms from a sign
+ * and magnitudes. The denominator must not be zero.
+ */
+static objptr_t make_small_exact(bool negative, unsigned long long numerator,
+				 unsigned long long denominator)
+{
+    unsigned long long divisor;
+    limb_t *numerator_limbs, *denominator_limbs;
+    unsigned int numerator_length, denominator_length;
+
+    divisor = gcd(numerator, denominator);
+    numerator /= divisor;
+    denominator /= divisor;
+
+    if (denominator == 1) {
+	return make_integer_from_magnitude(negative, numerator);
+    } else if (numerator <= INT_MAGNITUDE(negative) && denominator <= UINT_MAX) {
+	return make_rational(negative ? (int) -(long long) numerator : (int) numerator,
+			     (unsigned int) denominator);
+    }
+
+    numerator_limbs = make_limbs(numerator, &numerator_length);
+    denominator_limbs = make_limbs(denominator, &denominator_length);
+    if (numerator_limbs == NULL || denominator_limbs == NULL) {
+	free(numerator_limbs);
+	free(denominator_limbs);
+	return EMPTY_LIST;
+    }
+    return make_big_rational(negative, numerator_limbs, numerator_length,
+			     denominator_limbs, denominator_length);
+}
+
+
+// The same for signed parts
+static objptr_t make_exact(long long numerator, long long denominator)
+{
+    return make_small_exact((numerator < 0) != (denominator < 0),
+			    (numerator < 0) ? -(unsigned long long) numerator
+			    : (unsigned long long) numerator,
+			    (denominator < 0) ? -(unsigned long long) denominator
+			    : (unsigned long long) denominator);
+}
+
+
+static objptr_t integer_arithmetic(enum arithmetic_operation operation,
+				   int i1, int i2)
+{
+    int result;
+
+    switch (operation) {
+    case OPERATION_ADD:
+	if (LIKELY(!__builtin_add_overflow(i1, i2, &result))) {
+	    return make_integer(result);
+	}
+	return make_integer_from_long_long((long long) i1 + i2);
+    case OPERATION_SUBTRACT:
+	if (LIKELY(!__builtin_sub_overflow(i1, i2, &result))) {
+	    return make_integer(result);
+	}
+	return make_integer_from_long_long((long long) i1 - i2);
+    case OPERATION_MULTIPLY:
+	if (LIKELY(!__builtin_mul_overflow(i1, i2, &result))) {
+	    return make_integer(result);
+	}
+	return make_integer_from_long_long((long long) i1 * i2);
+    case OPERATION_DIVIDE:
+	if (UNLIKELY(i2 == 0)) return division_by_zero();
+	if (UNLIKELY(i2 == -1)) {
+	    // Before i1 % i2, which traps for INT_MIN / -1
+	    return make_integer_from_long_long(-(long long) i1);
+	}
+	if (i1 % i2 == 0) return make_integer(i1 / i2);
+	return make_exact(i1, i2);
+    }
+
+    return EMPTY_LIST;
+}
+
+
+/*
+ * Integers as sign and magnitude, small ones use the buffer
+ */
+struct integer_view {
+    bool negative;
+    unsigned int length;
+    const limb_t *limbs;
+    limb_t buffer[2];
+};
+
+
+static void view_magnitude(struct integer_view *view, bool negative,
+			   unsigned long long magnitude)
+{
+    view->negative = negative;
+    view->buffer[0] = (limb_t) magnitude;
+    view->buffer[1] = (limb_t) (magnitude >> LIMB_BITS);
+    view->limbs = view->buffer;
+    view->length = bignum_normalize(view->buffer, 2);
+}
+
+
+static void view_integer(struct integer_view *view, struct number *number)
+{
+    if (number->type == NUMBER_BIGNUM) {
+	view->negative = number->value.bignum.negative;
+	view->length = number->value.bignum.length;
+	view->limbs = number->value.bignum.limbs;
+    } else {
+	view_magnitude(view, number->value.integer < 0,
+		       (number->value.integer < 0) ? -(long long) number->value.integer
+		       : number->value.integer);
+    }
+}
+
+
+static int compare_integers(struct integer_view *a, struct integer_view *b)
+{
+    int order;
+
+    if (a->length == 0 && b->length == 0) return 0;
+    if (a->negative != b->negative) return a->negative ? -1 : 1;
+
+    order = bignum_compare(a->limbs, a->length, b->limbs, b->length);
+    return a->negative ? -order : order;
+}
+
+
+/*
+ * Adds A and B, B with the given sign, into a new array and stores
+ * the sign of the sum. Returns NULL if there is no memory.
+ */
+static limb_t *add_limbs(struct integer_view *a, struct integer_view *b,
+			 bool b_negative, bool *negative, unsigned int *length)
+{
+    limb_t *limbs;
+
+    limbs = malloc(((a->length > b->length) ? a->length : b->length) * sizeof(limb_t)
+		   + sizeof(limb_t));
+    if (limbs == NULL) return NULL;
+
+    if (a->negative == b_negative) {
+	*length = bignum_add(limbs, a->limbs, a->length, b->limbs, b->length);
+	*negative = a->negative;
+    } else if (bignum_compare(a->limbs, a->length, b->limbs, b->length) >= 0) {
+	*length = bignum_subtract(limbs, a->limbs, a->length, b->limbs, b->length);
+	*negative = a->negative;
+    } else {
+	*length = bignum_subtract(limbs, b->limbs, b->length, a->limbs, a->length);
+	*negative = b_negative;
+    }
+
+    return limbs;
+}
+
+
+// Multiplies the magnitudes of A and B into a new array, or NULL
+static limb_t *multiply_limbs(struct integer_view *a, struct integer_view *b,
+			      unsigned int *length)
+{
+    limb_t *limbs;
+
+    limbs = malloc((a->length + b->length + 1) * sizeof(limb_t));
+    if (limbs != NULL) {
+	*length = bignum_multiply(limbs, a->limbs, a->length, b->limbs, b->length);
+    }
+    return limbs;
+}
+
+
+// Adds A and B, B with the given sign
+static objptr_t add_integers(struct integer_view *a, struct integer_view *b,
+			     bool b_negative)
+{
+    limb_t *limbs;
+    unsigned int length;
+    bool negative;
+
+    limbs = add_limbs(a, b, b_negative, &negative, &length);
+    if (limbs == NULL) return EMPTY_LIST;
+
+    return make_integer_from_limbs(negative, limbs, length);
+}
+
+
+/*
+ * Divides A by B, truncating towards zero. Returns the quotient and
+ * stores the remainder unless REMAINDER is NULL. Both are EMPTY_LIST
+ * if there is no memory.
+ */
+static objptr_t divide_integers(struct integer_view *a, struct integer_view *b,
+				objptr_t *remainder)
+{
+    limb_t *q, *r;
+    unsigned int q_length, r_length;
+
+    q = malloc((a->length + 1) * sizeof(limb_t));
+    r = malloc((b->length + 1) * sizeof(limb_t));
+    if (q == NULL || r == NULL) {
+	free(q);
+	free(r);
+	if (remainder != NULL) *remainder = EMPTY_LIST;
+	return EMPTY_LIST;
+    }
+    q_length = bignum_divide(q, r, &r_length, a->limbs, a->length, b->limbs, b->length);
+
+    if (remainder != NULL) {
+	*remainder = make_integer_from_limbs(a->negative, r, r_length);
+    } else {
+	free(r);
+    }
+    return make_integer_from_limbs(a->negative != b->negative, q, q_length);
+}
+
+
+/*
+ * Returns the greatest common divisor of A and B in a new array, or
+ * NULL if there is no memory. B must not be zero.
+ */
+static limb_t *gcd_limbs(const limb_t *a, unsigned int a_length,
+			 const limb_t *b, unsigned int b_length,
+			 unsigned int *length)
+{
+    limb_t *x, *y, *r, *q, *t;
+    unsigned int x_length, y_length, r_length, size;
+
+    size = ((a_length > b_length) ? a_length : b_length) + 1;
+    x = malloc(size * sizeof(limb_t));
+    y = malloc(size * sizeof(limb_t));
+    r = malloc(size * sizeof(limb_t));
+    q = malloc(size * sizeof(limb_t));
+    if (x == NULL || y == NULL || r == NULL || q == NULL) {
+	free(x);
+	free(y);
+	free(r);
+	free(q);
+	return NULL;
+    }
+
+    memcpy(x, a, a_length * sizeof(limb_t));
+    x_length = a_length;
+    memcpy(y, b, b_length * sizeof(limb_t));
+    y_length = b_length;
+
+    // Euclid's algorithm
+    while (y_length > 0) {
+	bignum_divide(q, r, &r_length, x, x_length, y, y_length);
+	t = x;
+	x = y;
+	x_length = y_length;
+	y = r;
+	y_length = r_length;
+	r = t;
+    }
+
+    free(y);
+    free(r);
+    free(q);
+    *length = x_length;
+    return x;
+}
+
+
+/*
+ * Divides a numerator and a denominator by their greatest common
+ * divisor, replacing the arrays. Returns false if there is no
+ * memory, the arrays are left alone then.
+ */
+static bool reduce_limbs(limb_t **numerator, unsigned int *numerator_length,
+			 limb_t **denominator, unsigned int *denominator_length)
+{
+    limb_t *divisor, *reduced_numerator, *reduced_denominator, *remainder;
+    unsigned int divisor_length, remainder_length;
+
+    divisor = gcd_limbs(*numerator, *numerator_length,
+			*denominator, *denominator_length, &divisor_length);
+    if (divisor == NULL) return false;
+    if (divisor_length == 1 && divisor[0] == 1) {
+	free(divisor);
+	return true;
+    }
+
+    reduced_numerator = malloc((*numerator_length + 1) * sizeof(limb_t));
+    reduced_denominator = malloc((*denominator_length + 1) * sizeof(limb_t));
+    remainder = malloc((divisor_length + 1) * sizeof(limb_t));
+    if (reduced_numerator == NULL || reduced_denominator == NULL || remainder == NULL) {
+	free(divisor);
+	free(reduced_numerator);
+	free(reduced_denominator);
+	free(remainder);
+	return false;
+    }
+
+    *numerator_length = bignum_divide(reduced_numerator, remainder, &remainder_length,
+				      *numerator, *numerator_length,
+				      divisor, divisor_length);
+    *denominator_length = bignum_divide(reduced_denominator, remainder, &remainder_length,
+					*denominator, *denominator_length,
+					divisor, divisor_length);
+    free(*numerator);
+    free(*denominator);
+    free(divisor);
+    free(remainder);
+    *numerator = reduced_numerator;
+    *denominator = reduced_denominator;
+    return true;
+}
+
+
+// Joins the limbs of a magnitude which fits into 64 bits
+static unsigned long long limbs_to_magnitude(const limb_t *limbs, unsigned int length)
+{
+    unsigned long long magnitude;
+
+    magnitude = (length > 0) ? limbs[0] : 0;
+    if (length > 1) magnitude |= (unsigned long long) limbs[1] << LIMB_BITS;
+    return magnitude;
+}
+
+
+/*
+ * Makes the number numerator/denominator in lowest terms from a sign
+ * and two magnitudes, taking ownership of the limbs. Returns
+ * EMPTY_LIST if the denominator is zero or there is no memory.
+ */
+objptr_t make_rational_from_limbs(bool negative,
+				  limb_t *numerator, unsigned int numerator_length,
+				  limb_t *denominator, unsigned int denominator_length)
+{
+    unsigned long long small_numerator, small_denominator;
+
+    numerator_length = bignum_normalize(numerator, numerator_length);
+    denominator_length = bignum_normalize(denominator, denominator_length);
+
+    if (denominator_length == 0
+	|| ((numerator_length > 2 || denominator_length > 2)
+	    && !reduce_limbs(&numerator, &numerator_length,
+			     &denominator, &denominator_length))) {
+	free(numerator);
+	free(denominator);
+	return EMPTY_LIST;
+    }
+
+    if (numerator_length <= 2 && denominator_length <= 2) {
+	small_numerator = limbs_to_magnitude(numerator, numerator_length);
+	small_denominator = limbs_to_magnitude(denominator, denominator_length);
+	free(numerator);
+	free(denominator);
+	return make_small_exact(negative, small_numerator, small_denominator);
+    } else if (denominator_length == 1 && denominator[0] == 1) {
+	free(denominator);
+	return make_integer_from_limbs(negative, numerator, numerator_length);
+    } else {
+	return make_big_rational(negative, numerator, numerator_length,
+				 denominator, denominator_length);
+    }
+}
+
+
 /*
-objptr_t make_integer(int);
-objptr_t make_real(double);
-objptr_t make_rational(int, unsigned int);
-objptr_t make_complex(double, double);
-*/
+ * Exact numbers as a numerator with the sign and a positive
+ * denominator
+ */
+struct rational_view {
+    struct integer_view numerator;
+    struct integer_view denominator;
+};
+
+
+static void view_rational(struct rational_view *view, struct number *number)
+{
+    switch (number->type) {
+    case NUMBER_RATIONAL:
+	view_magnitude(&view->numerator, number->value.rational.numerator < 0,
+		       (number->value.rational.numerator < 0)
+		       ? -(long long) number->value.rational.numerator
+		       : number->value.rational.numerator);
+	view_magnitude(&view->denominator, false, number->value.rational.denominator);
+	break;
+    case NUMBER_BIG_RATIONAL:
+	view->numerator.negative = number->value.big_rational.negative;
+	view->numerator.length = number->value.big_rational.numerator_length;
+	view->numerator.limbs = number->value.big_rational.numerator;
+	view->denominator.negative = false;
+	view->denominator.length = number->value.big_rational.denominator_length;
+	view->denominator.limbs = number->value.big_rational.denominator;
+	break;
+    default:
+	view_integer(&view->numerator, number);
+	view_magnitude(&view->denominator, false, 1);
+	break;
+    }
+}
+
+
+/*
+ * Exact arithmetic on numbers with parts of any size: a/b and c/d
+ * give (ad + cb)/bd, (ad - cb)/bd, ac/bd and ad/bc in lowest terms
+ */
+static objptr_t rational_arithmetic(enum arithmetic_operation operation,
+				    struct number *n1, struct number *n2)
+{
+    struct rational_view x, y;
+    struct integer_view ad, cb;
+    limb_t *numerator, *denominator;
+    unsigned int numerator_length, denominator_length;
+    bool negative;
+
+    view_rational(&x, n1);
+    view_rational(&y, n2);
+
+    numerator = NULL;
+    denominator = NULL;
+    negative = x.numerator.negative != y.numerator.negative;
+
+    switch (operation) {
+    case OPERATION_ADD:
+    case OPERATION_SUBTRACT:
+	ad.limbs = multiply_limbs(&x.numerator, &y.denominator, &ad.length);
+	cb.limbs = multiply_limbs(&y.numerator, &x.denominator, &cb.length);
+	if (ad.limbs != NULL && cb.limbs != NULL) {
+	    ad.negative = x.numerator.negative;
+	    cb.negative = y.numerator.negative;
+	    numerator = add_limbs(&ad, &cb, (operation == OPERATION_ADD)
+				  ? cb.negative : !cb.negative,
+				  &negative, &numerator_length);
+	}
+	free((limb_t*) ad.limbs);
+	free((limb_t*) cb.limbs);
+	denominator = multiply_limbs(&x.denominator, &y.denominator, &denominator_length);
+	break;
+    case OPERATION_MULTIPLY:
+	numerator = multiply_limbs(&x.numerator, &y.numerator, &numerator_length);
+	denominator = multiply_limbs(&x.denominator, &y.denominator, &denominator_length);
+	break;
+    case OPERATION_DIVIDE:
+	if (y.numerator.length == 0) return division_by_zero();
+	numerator = multiply_limbs(&x.numerator, &y.denominator, &numerator_length);
+	denominator = multiply_limbs(&x.denominator, &y.numerator, &denominator_length);
+	break;
+    }
+
+    if (numerator == NULL || denominator == NULL) {
+	free(numerator);
+	free(denominator);
+	return EMPTY_LIST;
+    }
+    return make_rational_from_limbs(negative, numerator, numerator_length,
+				    denominator, denominator_length);
+}
+
+
+/*
+ * Compares exact numbers with parts of any size by comparing ad with
+ * cb. Returns false if there is no memory.
+ */
+static bool compare_rationals(struct number *n1, struct number *n2, int *order)
+{
+    struct rational_view x, y;
+    limb_t *ad, *cb;
+    unsigned int ad_length, cb_length;
+    int sign1, sign2;
+
+    view_rational(&x, n1);
+    view_rational(&y, n2);
+
+    sign1 = (x.numerator.length == 0) ? 0 : (x.numerator.negative ? -1 : 1);
+    sign2 = (y.numerator.length == 0) ? 0 : (y.numerator.negative ? -1 : 1);
+    if (sign1 != sign2 || sign1 == 0) {
+	*order = (sign1 > sign2) - (sign1 < sign2);
+	return true;
+    }
+
+    ad = multiply_limbs(&x.numerator, &y.denominator, &ad_length);
+    cb = multiply_limbs(&y.numerator, &x.denominator, &cb_length);
+    if (ad != NULL && cb != NULL) {
+	*order = sign1 * bignum_compare(ad, ad_length, cb, cb_length);
+    }
+    free(ad);
+    free(cb);
+    return ad != NULL && cb != NULL;
+}
+
+
+static objptr_t bignum_arithmetic(enum arithmetic_operation operation,
+				  struct number *n1, struct number *n2)
+{
+    struct integer_view a, b;
+    limb_t *limbs, *remainder;
+    unsigned int length, remainder_length;
+
+    view_integer(&a, n1);
+    view_integer(&b, n2);
+
+    switch (operation) {
+    case OPERATION_ADD:
+	return add_integers(&a, &b, b.negative);
+    case OPERATION_SUBTRACT:
+	return add_integers(&a, &b, !b.negative);
+    case OPERATION_MULTIPLY:
+	limbs = multiply_limbs(&a, &b, &length);
+	if (limbs == NULL) return EMPTY_LIST;
+	return make_integer_from_limbs(a.negative != b.negative, limbs, length);
+    case OPERATION_DIVIDE:
+	if (b.length == 0) return division_by_zero();
+	limbs = malloc((a.length + 1) * sizeof(limb_t));
+	remainder = malloc((b.length + 1) * sizeof(limb_t));
+	if (limbs == NULL || remainder == NULL) {
+	    free(limbs);
+	    free(remainder);
+	    return EMPTY_LIST;
+	}
+	length = bignum_divide(limbs, remainder, &remainder_length,
+			       a.limbs, a.length, b.limbs, b.length);
+	free(remainder);
+	if (remainder_length == 0) {
+	    return make_integer_from_limbs(a.negative != b.negative, limbs, length);
+	}
+	free(limbs);
+	return rational_arithmetic(operation, n1, n2);
+    }
+
+    return EMPTY_LIST;
+}
+
+
+static objptr_t real_arithmetic(enum arithmetic_operation operation,
+				double d1, double d2)
+{
+    switch (operation) {
+    case OPERATION_ADD:       return make_real(d1 + d2);
+    case OPERATION_SUBTRACT:  return make_real(d1 - d2);
+    case OPERATION_MULTIPLY:  return make_real(d1 * d2);
+    case OPERATION_DIVIDE:    return make_real(d1 / d2);
+    }
+
+    return EMPTY_LIST;
+}
+
+
+/*
+ * Exact arithmetic on integers and rationals. When the parts of both
+ * operands fit into 32 bits, only the sums and the product of the
+ * denominators may overflow a long long; those results and bignum
+ * parts take the path through limbs.
+ */
+static objptr_t exact_arithmetic(enum arithmetic_operation operation,
+				 struct number *n1, struct number *n2)
+{
+    long long a, b, c, d, numerator, denominator;
+
+    if (is_small_exact(n1) && is_small_exact(n2)) {
+	exact_parts(n1, &a, &b);
+	exact_parts(n2, &c, &d);
+
+	switch (operation) {
+	case OPERATION_ADD:
+	    if (__builtin_add_overflow(a * d, c * b, &numerator)
+		|| __builtin_mul_overflow(b, d, &denominator)) break;
+	    return make_exact(numerator, denominator);
+	case OPERATION_SUBTRACT:
+	    if (__builtin_sub_overflow(a * d, c * b, &numerator)
+		|| __builtin_mul_overflow(b, d, &denominator)) break;
+	    return make_exact(numerator, denominator);
+	case OPERATION_MULTIPLY:
+	    if (__builtin_mul_overflow(b, d, &denominator)) break;
+	    return make_exact(a * c, denominator);
+	case OPERATION_DIVIDE:
+	    if (c == 0) return division_by_zero();
+	    return make_exact(a * d, b * c);
+	}
+    }
+
+    return rational_arithmetic(operation, n1, n2);
+}
+
+
+static objptr_t complex_arithmetic(enum arithmetic_operation operation,
+				   struct number *n1, struct number *n2)
+{
+    double a, b, c, d, scale;
+
+    a = number_to_double(n1);
+    b = (n1->type == NUMBER_COMPLEX) ? n1->value.complex.imaginary : 0.0;
+    c = number_to_double(n2);
+    d = (n2->type == NUMBER_COMPLEX) ? n2->value.complex.imaginary : 0.0;
+
+    switch (operation) {
+    case OPERATION_ADD:       return make_complex(a + c, b + d);
+    case OPERATION_SUBTRACT:  return make_complex(a - c, b - d);
+    case OPERATION_MULTIPLY:  return make_complex(a * c - b * d, a * d + b * c);
+    case OPERATION_DIVIDE:
+	scale = c * c + d * d;
+	return make_complex((a * c + b * d) / scale, (b * c - a * d) / scale);
+    }
+
+    return EMPTY_LIST;
+}
+
+
+static objptr_t arithmetic(enum arithmetic_operation operation,
+			   objptr_t p1, objptr_t p2)
+{
+    struct number *n1, *n2, buffer1, buffer2;
+
+#ifdef NIL_NAN_BOXING
+    if (IS_UNBOXED_REAL(p1) && IS_UNBOXED_REAL(p2)) {
+	return real_arithmetic(operation, unbox_real(p1), unbox_real(p2));
+    }
+#endif
+
+    if (!is_of_type(p1, &TYPE_NUMBER) || !is_of_type(p2, &TYPE_NUMBER)) {
+	return EMPTY_LIST;  // TODO: Error?
+    }
+
+    n1 = number_view(p1, &buffer1);
+    n2 = number_view(p2, &buffer2);
+
+    if (LIKELY(n1->type == NUMBER_INTEGER && n2->type == NUMBER_INTEGER)) {
+	return integer_arithmetic(operation, n1->value.integer, n2->value.integer);
+    } else if (n1->type == NUMBER_REAL && n2->type == NUMBER_REAL) {
+	return real_arithmetic(operation, n1->value.real, n2->value.real);
+    } else if (n1->type == NUMBER_COMPLEX || n2->type == NUMBER_COMPLEX) {
+	return complex_arithmetic(operation, n1, n2);
+    } else if (is_integer(n1) && is_integer(n2)) {
+	return bignum_arithmetic(operation, n1, n2);
+    } else if (is_exact(n1) && is_exact(n2)) {
+	return exact_arithmetic(operation, n1, n2);
+    } else {
+	return real_arithmetic(operation, number_to_double(n1), number_to_double(n2));
+    }
+}
+
+
+objptr_t number_add(objptr_t p1, objptr_t p2)
+{
+    return arithmetic(OPERATION_ADD, p1, p2);
+}
+
+
+objptr_t number_subtract(objptr_t p1, objptr_t p2)
+{
+    return arithmetic(OPERATION_SUBTRACT, p1, p2);
+}
+
+
+objptr_t number_multiply(objptr_t p1, objptr_t p2)
+{
+    return arithmetic(OPERATION_MULTIPLY, p1, p2);
+}
+
+
+objptr_t number_divide(objptr_t p1, objptr_t p2)
+{
+    return arithmetic(OPERATION_DIVIDE, p1, p2);
+}
+
+
+/*
+ * Divides two integers, truncating towards zero like C, and returns
+ * either the quotient or the remainder, which has the sign of the
+ * dividend.
+ */
+static objptr_t integer_division(objptr_t p1, objptr_t p2, bool want_remainder)
+{
+    struct number *n1, *n2, buffer1, buffer2;
+    struct integer_view a, b;
+    objptr_t quotient, remainder;
+    int i1, i2;
+
+    if (!is_of_type(p1, &TYPE_NUMBER) || !is_of_type(p2, &TYPE_NUMBER)) {
+	return EMPTY_LIST;  // TODO: Error?
+    }
+
+    n1 = number_view(p1, &buffer1);
+    n2 = number_view(p2, &buffer2);
+
+    if (LIKELY(n1->type == NUMBER_INTEGER && n2->type == NUMBER_INTEGER)) {
+	i1 = n1->value.integer;
+	i2 = n2->value.integer;
+	if (UNLIKELY(i2 == 0)) return division_by_zero();
+	if (UNLIKELY(i2 == -1)) {
+	    return want_remainder ? make_integer(0) : make_integer_from_long_long(-(long long) i1);
+	}
+	return make_integer(want_remainder ? i1 % i2 : i1 / i2);
+    }
+
+    if (!is_integer(n1) || !is_integer(n2)) {
+	return EMPTY_LIST;  // TODO: Error?
+    }
+
+    view_integer(&a, n1);
+    view_integer(&b, n2);
+    if (b.length == 0) return division_by_zero();
+
+    quotient = divide_integers(&a, &b, &remainder);
+    if (want_remainder) {
+	decrease_refcount(quotient);
+	return remainder;
+    } else {
+	decrease_refcount(remainder);
+	return quotient;
+    }
+}
+
+
+objptr_t number_quotient(objptr_t p1, objptr_t p2)
+{
+    return integer_division(p1, p2, false);
+}
+
+
+objptr_t number_remainder(objptr_t p1, objptr_t p2)
+{
+    return integer_division(p1, p2, true);
+}
+
+
+static bool compare_reals(double d1, double d2, int *order)
+{
+    if (isnan(d1) || isnan(d2)) return false;
+
+    *order = (d1 > d2) - (d1 < d2);
+    return true;
+}
+
+
+/*
+ * Stores -1, 0 or 1 in ORDER as P1 is less than, equal to or greater
+ * than P2. Returns false if they are unordered, because one of them
+ * isn't a number or is NaN, or if there is no memory.
+ */
+bool number_compare(objptr_t p1, objptr_t p2, int *order)
+{
+    struct number *n1, *n2, buffer1, buffer2;
+    struct integer_view a_view, b_view;
+    long long a, b, c, d;
+
+    if (!is_of_type(p1, &TYPE_NUMBER) || !is_of_type(p2, &TYPE_NUMBER)) {
+	return false;
+    }
+
+    n1 = number_view(p1, &buffer1);
+    n2 = number_view(p2, &buffer2);
+
+    if (LIKELY(n1->type == NUMBER_INTEGER && n2->type == NUMBER_INTEGER)) {
+	*order = (n1->value.integer > n2->value.integer)
+	    - (n1->value.integer < n2->value.integer);
+	return true;
+    } else if (n1->type == NUMBER_REAL && n2->type == NUMBER_REAL) {
+	return compare_reals(n1->value.real, n2->value.real, order);
+    } else if (is_integer(n1) && is_integer(n2)) {
+	view_integer(&a_view, n1);
+	view_integer(&b_view, n2);
+	*order = compare_integers(&a_view, &b_view);
+	return true;
+    } else if (is_small_exact(n1) && is_small_exact(n2)) {
+	// The denominators are positive
+	exact_parts(n1, &a, &b);
+	exact_parts(n2, &c, &d);
+	*order = (a * d > c * b) - (a * d < c * b);
+	return true;
+    } else if (is_exact(n1) && is_exact(n2)) {
+	return compare_rationals(n1, n2, order);
+    } else {
+	return compare_reals(number_to_double(n1), number_to_double(n2), order);
+    }
+}
+
+
+/*
+ * Stores a number truncated towards zero in RESULT. Returns false if
+ * the object isn't a number or the value is out of the range of an
+ * int.
+ */
+bool number_get_int(objptr_t ptr, int *result)
+{
+    struct number buffer;
+    struct number *number;
+    double real;
+
+    if (!is_of_type(ptr, &TYPE_NUMBER)) return false;
+
+    number = number_view(ptr, &buffer);
+    switch (number->type) {
+    case NUMBER_INTEGER:
+	*result = number->value.integer;
+	return true;
+    case NUMBER_BIGNUM:
+	// Bignums are only used outside the range of an int
+	return false;
+    default:
+	real = number_to_double(number);
+	if (!(real > (double) INT_MIN - 1.0 && real < (double) INT_MAX + 1.0)) {
+	    return false;
+	}
+	*result = (int) real;
+	return true;
+    }
+}
+
+
+/*
+ * Values out of the range of an int are clamped to it, other objects
+ * give 0.
+ */
+int number_to_int(objptr_t ptr)
+{
+    struct number buffer;
+    struct number *number;
+    int result;
+
+    if (number_get_int(ptr, &result)) return result;
+    if (!is_of_type(ptr, &TYPE_NUMBER)) return 0;
+
+    number = number_view(ptr, &buffer);
+    if (number->type == NUMBER_BIGNUM) {
+	return number->value.bignum.negative ? INT_MIN : INT_MAX;
+    }
+    return (number_to_double(number) < 0) ? INT_MIN : INT_MAX;
+}
+
+
+double number_to_real(objptr_t ptr)
+{
+    struct number buffer;
+
+    if (is_of_type(ptr, &TYPE_NUMBER)) {
+	return number_to_double(number_view(ptr, &buffer));
+    } else {
+	return 0.0;
+    }
+}
+
+
+/*
+ * Integers beyond 64 bits wrap around like a conversion in C,
+ * other numbers are truncated towards zero.
+ */
+long long number_to_long_long(objptr_t ptr)
+{
+    struct number buffer;
+    struct number *number;
+    unsigned long long bits;
+    double real;
+
+    if (!is_of_type(ptr, &TYPE_NUMBER)) return 0;
+
+    number = number_view(ptr, &buffer);
+    switch (number->type) {
+    case NUMBER_INTEGER:
+	return number->value.integer;
+    case NUMBER_BIGNUM:
+	bits = number->value.bignum.limbs[0];
+	if (number->value.bignum.length > 1) {
+	    bits |= (unsigned long long) number->value.bignum.limbs[1] << LIMB_BITS;
+	}
+	return (long long) (number->value.bignum.negative ? -bits : bits);
+    default:
+	real = number_to_double(number);
+	if (real != real) return 0;
+	if (real >= 9223372036854775807.0) return LLONG_MAX;
+	if (real <= -9223372036854775808.0) return LLONG_MIN;
+	return (long long) real;
+    }
+}
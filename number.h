@@ -5,6 +5,7 @@
 
 #include <stdlib.h>
 
+#include "bignum.h"
 #include "object.h"
 
 
@@ -12,7 +13,9 @@ enum number_type {
     NUMBER_INTEGER,
     NUMBER_RATIONAL,
     NUMBER_REAL,
-    NUMBER_COMPLEX
+    NUMBER_COMPLEX,
+    NUMBER_BIGNUM,  // Only for integers which don't fit into an int
+    NUMBER_BIG_RATIONAL  // Only for rationals whose parts don't fit
 };
 
 
@@ -30,6 +33,20 @@ union number_value {
 	double real;
 	double imaginary;
     } complex;
+
+    struct {
+	bool negative;
+	unsigned int length;
+	limb_t *limbs;  // Owned, see bignum.h
+    } bignum;
+
+    struct {
+	bool negative;
+	unsigned int numerator_length;
+	unsigned int denominator_length;
+	limb_t *numerator;    // Owned, in lowest terms with
+	limb_t *denominator;  // a denominator above 1
+    } big_rational;
 };
 
 
@@ -43,5 +60,28 @@ struct number {
 extern struct object_type TYPE_NUMBER;
 
 
+struct number *number_view(objptr_t, struct number*);
+
+objptr_t make_integer(int);
+objptr_t make_integer_from_long_long(long long);
+objptr_t make_integer_from_limbs(bool, limb_t*, unsigned int);
+objptr_t make_real(double);
+objptr_t make_rational(int, unsigned int);
+objptr_t make_rational_from_limbs(bool, limb_t*, unsigned int, limb_t*, unsigned int);
+objptr_t make_complex(double, double);
+
+objptr_t number_add(objptr_t, objptr_t);
+objptr_t number_subtract(objptr_t, objptr_t);
+objptr_t number_multiply(objptr_t, objptr_t);
+objptr_t number_divide(objptr_t, objptr_t);
+objptr_t number_quotient(objptr_t, objptr_t);
+objptr_t number_remainder(objptr_t, objptr_t);
+bool number_compare(objptr_t, objptr_t, int*);
+bool number_get_int(objptr_t, int*);
+int number_to_int(objptr_t);
+double number_to_real(objptr_t);
+long long number_to_long_long(objptr_t);
+
+
 
 #endif
@@ -1,8 +1,10 @@
 
 #include <assert.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "fiber.h"
+#include "number.h"
 
 #include "object.h"
 
@@ -157,6 +159,7 @@ static objptr_t INTERN_object_get_slot(struct object *object, unsigned int slot)
  */
 
 #define HEAP_CELL_FLAG_FREE 0x01
+#define HEAP_CELL_FLAG_SEALED 0x02  // See seal_heap()
 
 struct heap_cell {
     uint8_t flags;
@@ -168,6 +171,8 @@ struct heap_cell {
 
 static unsigned long HEAP_ARRAY_SLOT_COUNT = 0;
 static unsigned long HEAP_ARRAY_USED_SLOT_COUNT = 0;
+static unsigned long HEAP_ARRAY_SEALED_SLOT_COUNT = 0;  // Below the last sealed cell
+static unsigned long HEAP_ARRAY_FREE_SLOT_COUNT = 0;    // On the freelist
 static struct heap_cell *HEAP_ARRAY = NULL;
 objptr_t HEAP_ARRAY_FREELIST;
 bool GLOBAL_REFCOUNT_LOCK = false;
@@ -191,12 +196,20 @@ static struct heap_cell *dereference_slot(objptr_t ptr)
 }
 
 
+static bool is_sealed(objptr_t ptr)
+{
+    return ptr < HEAP_ARRAY_SEALED_SLOT_COUNT
+	&& (HEAP_ARRAY[ptr].flags & HEAP_CELL_FLAG_SEALED) != 0;
+}
+
+
 static void add_to_freelist(struct heap_cell *slot)
 {
     assert(slot != NULL);
     slot->flags |= HEAP_CELL_FLAG_FREE;
     slot->value.next = HEAP_ARRAY_FREELIST;
     HEAP_ARRAY_FREELIST = heap_array_address_to_objptr(slot);
+    HEAP_ARRAY_FREE_SLOT_COUNT++;
     HEAP_ARRAY_USED_SLOT_COUNT--;
 }
 
@@ -211,6 +224,12 @@ static void grow_heap_array(unsigned int slot_delta)
 	 */
 	HEAP_ARRAY = realloc(HEAP_ARRAY, (HEAP_ARRAY_SLOT_COUNT + slot_delta) * sizeof(struct heap_cell));
 
+	if (HEAP_ARRAY_SLOT_COUNT == 0) {
+	    // The cell of the empty list never holds an object
+	    HEAP_ARRAY[0].flags = 0;
+	    HEAP_ARRAY[0].value.object = NULL;
+	}
+
 	/*
 	 * Add new slots to heap array free list.
 	 * Note: Since EMPTY_LIST has to be set before
@@ -260,13 +279,14 @@ static struct heap_cell *find_fresh_heap_array_slot()
     slot = dereference_slot(HEAP_ARRAY_FREELIST);
     if (HEAP_ARRAY_FREELIST != EMPTY_LIST && slot != NULL) {
 	HEAP_ARRAY_FREELIST = slot->value.next;
+	HEAP_ARRAY_FREE_SLOT_COUNT--;
     }
 
     /*
      * Initialize slot
      */
     if (slot != NULL) {
-	slot->flags &= ~HEAP_CELL_FLAG_FREE;
+	slot->flags &= ~(HEAP_CELL_FLAG_FREE | HEAP_CELL_FLAG_SEALED);
 	slot->value.object = NULL;
 	HEAP_ARRAY_USED_SLOT_COUNT++;
     }
@@ -300,12 +320,44 @@ static void object_deallocate(objptr_t ptr)
  */
 
 
+#ifdef NIL_NAN_BOXING
+
+#define CANONICAL_NAN 0x7ff8000000000000ull
+
+objptr_t box_real(double value)
+{
+    uint64_t bits;
+
+    if (value != value) {
+	bits = CANONICAL_NAN;
+    } else {
+	memcpy(&bits, &value, sizeof(bits));
+    }
+    return bits + OBJPTR_REAL_OFFSET;
+}
+
+
+double unbox_real(objptr_t ptr)
+{
+    uint64_t bits;
+    double value;
+
+    bits = ptr - OBJPTR_REAL_OFFSET;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+#endif
+
+
 /*
  * TODO: optimize
  */
 struct object *dereference(objptr_t ptr)
 {
     // TODO: Bounds check! --> return EMPTY_LIST
+    if (IS_UNBOXED_REAL(ptr)) return NULL;
+
     if ((HEAP_ARRAY[ptr].flags & HEAP_CELL_FLAG_FREE) != 0) {
 	return NULL;
     } else {
@@ -321,6 +373,8 @@ bool is_of_type(objptr_t ptr, struct object_type *type)
 {
     struct object *object;
 
+    if (IS_UNBOXED_REAL(ptr)) return type == &TYPE_NUMBER;
+
     object = dereference(ptr);
     if (object != NULL) {
 	return object->type == type;
@@ -339,6 +393,14 @@ bool eqv(objptr_t p1, objptr_t p2, enum eqv_strictness strictness)
     struct object *o2;
 
     if (p1 == p2) return true;
+
+#ifdef NIL_NAN_BOXING
+    if (IS_UNBOXED_REAL(p1) || IS_UNBOXED_REAL(p2)) {
+	// All reals are unboxed, compare them like number_eqv()
+	return IS_UNBOXED_REAL(p1) && IS_UNBOXED_REAL(p2)
+	    && unbox_real(p1) == unbox_real(p2);
+    }
+#endif
     
     o1 = dereference(p1);
     o2 = dereference(p2);
@@ -396,6 +458,18 @@ objptr_t object_allocate(struct object_type *type)
 }
 
 
+/*
+ * Grows the heap at once so that COUNT objects can be allocated
+ * without growing it again, for loading many objects in bulk.
+ */
+void reserve_heap_slots(unsigned long count)
+{
+    if (count > HEAP_ARRAY_FREE_SLOT_COUNT) {
+	grow_heap_array(count - HEAP_ARRAY_FREE_SLOT_COUNT);
+    }
+}
+
+
 /*
  * TODO: optimize
  */
@@ -405,6 +479,8 @@ void increase_refcount(objptr_t ptr)
     struct object *object;
 
     if (GLOBAL_REFCOUNT_LOCK
+	|| is_sealed(ptr)
+	|| IS_UNBOXED_REAL(ptr)
 	|| ptr == EMPTY_LIST
 	|| ptr == NIL_TRUE
 	|| ptr == NIL_FALSE) {
@@ -434,13 +510,21 @@ void decrease_refcount(objptr_t ptr)
     struct object *object;
 
 
-    if (ptr == EMPTY_LIST
+    if (is_sealed(ptr)
+	|| IS_UNBOXED_REAL(ptr)
+	|| ptr == EMPTY_LIST
 	|| ptr == NIL_TRUE
 	|| ptr == NIL_FALSE) {
 	return;
     }
     
     slot = dereference_slot(ptr);
+
+    if (GLOBAL_REFCOUNT_LOCK && ((slot->flags & HEAP_CELL_FLAG_FREE) != 0)) {
+	// The sweeper has already released this object
+	return;
+    }
+    
     assert((slot != NULL) && ((slot->flags & HEAP_CELL_FLAG_FREE) == 0));
 
     object = slot->value.object;
@@ -461,6 +545,22 @@ void decrease_refcount(objptr_t ptr)
 }
 
 
+/*
+ * Drops a reference like decrease_refcount(), but keeps an object
+ * that isn't referenced anymore, so that it can be handed over like
+ * a fresh one.
+ */
+void decrease_refcount_keep(objptr_t ptr)
+{
+    bool lock;
+
+    lock = GLOBAL_REFCOUNT_LOCK;
+    GLOBAL_REFCOUNT_LOCK = true;
+    decrease_refcount(ptr);
+    GLOBAL_REFCOUNT_LOCK = lock;
+}
+
+
 
 
 /*
@@ -468,37 +568,73 @@ void decrease_refcount(objptr_t ptr)
  */
 
 
-static void mark_object(objptr_t ptr)
+/*
+ * Objects which are marked, but whose slots haven't been marked yet.
+ * The stack is explicit, so that long lists don't overflow the
+ * native stack.
+ */
+static objptr_t *MARK_STACK = NULL;
+static unsigned long MARK_STACK_SIZE = 0;
+static unsigned long MARK_STACK_ALLOC_SIZE = 0;
+
+// Set when a marked object didn't fit on the stack
+static bool MARK_STACK_OVERFLOWED = false;
+
+
+static void mark_and_push(objptr_t ptr)
 {
-    unsigned int index;
-    unsigned int count;
     struct object *object;
-    
+    objptr_t *stack;
+    unsigned long alloc;
+
     /*
-     * Get the object
+     * Sealed objects are never marked, see mark_sealed_region()
      */
+    if (is_sealed(ptr) || IS_UNBOXED_REAL(ptr)) return;
+
     object = dereference(ptr);
+    if ((object == NULL) || INTERN_object_is_marked(object)) return;
+    INTERN_mark_object(object);
 
-    /*
-     * Check whether the object has to be marked and do so if needed
-     */
-    if ((object == NULL)
-	|| INTERN_object_is_marked(object)) {
-	return;
-    } else {
-	INTERN_mark_object(object);
+    if (MARK_STACK_SIZE == MARK_STACK_ALLOC_SIZE) {
+	alloc = (MARK_STACK_ALLOC_SIZE == 0) ? 1024 : 2 * MARK_STACK_ALLOC_SIZE;
+	stack = realloc(MARK_STACK, alloc * sizeof(objptr_t));
+	if (stack == NULL) {
+	    /*
+	     * The object stays marked, its slots are marked by
+	     * mark_overflowed()
+	     */
+	    MARK_STACK_OVERFLOWED = true;
+	    return;
+	}
+	MARK_STACK = stack;
+	MARK_STACK_ALLOC_SIZE = alloc;
     }
-    
+    MARK_STACK[MARK_STACK_SIZE++] = ptr;
+}
+
+
+static void mark_object(objptr_t ptr)
+{
+    unsigned int index;
+    unsigned int count;
+    struct object *object;
+
+    mark_and_push(ptr);
+
     /*
-     * Loop over the object's slots and mark them.
-     * TODO: Use an external stack for this to avoid a
-     *       native return stack overflow!
+     * Mark the slots of the objects marked so far, until there
+     * are no new ones
      */
-    count = INTERN_object_slot_count(object);
-    
-    for (index = 0; index < count; index++)
+    while (MARK_STACK_SIZE > 0)
     {
-	mark_object(INTERN_object_get_slot(object, index));
+	object = dereference(MARK_STACK[--MARK_STACK_SIZE]);
+	count = INTERN_object_slot_count(object);
+
+	for (index = 0; index < count; index++)
+	{
+	    mark_and_push(INTERN_object_get_slot(object, index));
+	}
     }
 }
 
@@ -539,6 +675,66 @@ void make_refcount_immune(objptr_t ptr)
 
 
 
+/*
+ * Sealed objects are roots. Instead of marking them, which would
+ * write to their pages, the objects they refer to are marked.
+ */
+static void mark_sealed_region()
+{
+    unsigned long current_slot;
+    unsigned int index;
+    unsigned int count;
+    struct object *object;
+
+    for (current_slot = 0;
+	 current_slot < HEAP_ARRAY_SEALED_SLOT_COUNT;
+	 current_slot++)
+    {
+	if (!is_sealed((objptr_t) current_slot)) continue;
+	object = dereference((objptr_t) current_slot);
+	if (object == NULL) continue;
+
+	count = INTERN_object_slot_count(object);
+	for (index = 0; index < count; index++)
+	{
+	    mark_object(INTERN_object_get_slot(object, index));
+	}
+    }
+}
+
+
+/*
+ * Marks the slots of the marked objects in the heap, as long as some
+ * of them didn't fit on the mark stack.
+ */
+static void mark_overflowed()
+{
+    unsigned long current_slot;
+    unsigned int index;
+    unsigned int count;
+    struct object *object;
+
+    while (MARK_STACK_OVERFLOWED) {
+	MARK_STACK_OVERFLOWED = false;
+
+	for (current_slot = 0;
+	     current_slot < HEAP_ARRAY_SLOT_COUNT;
+	     current_slot++)
+	{
+	    if ((HEAP_ARRAY[current_slot].flags & HEAP_CELL_FLAG_FREE) != 0) continue;
+	    object = HEAP_ARRAY[current_slot].value.object;
+	    if ((object == NULL) || !INTERN_object_is_marked(object)) continue;
+
+	    count = INTERN_object_slot_count(object);
+	    for (index = 0; index < count; index++)
+	    {
+		mark_object(INTERN_object_get_slot(object, index));
+	    }
+	}
+    }
+}
+
+
 extern struct fiber *FIBER_LIST;
 
 static void mark()
@@ -554,6 +750,8 @@ static void mark()
 	mark_object(ROOT_OBJECT_POOL[index]);
     }
 
+    mark_sealed_region();
+
     /*
      * Mark fibers
      */
@@ -565,6 +763,8 @@ static void mark()
             fib = fib->next;
         } while (fib != NULL && fib != end);
     }
+
+    mark_overflowed();
 }
 
 
@@ -590,10 +790,11 @@ static void sweep()
 	 current_slot++)
     {
 	if (((HEAP_ARRAY[current_slot].flags & HEAP_CELL_FLAG_FREE) != 0)
-	    || (HEAP_ARRAY[current_slot].value.object == NULL)) {
+	    || (HEAP_ARRAY[current_slot].value.object == NULL)
+	    || is_sealed((objptr_t) current_slot)) {
 	    /*
-	     * The current slot is either NULL or a freelist element.
-	     * Therefore, we can leave it unaffected.
+	     * The current slot is either NULL, a freelist element or
+	     * sealed. Therefore, we can leave it unaffected.
 	     */
 	    continue;
 	}
@@ -620,7 +821,7 @@ static void sweep()
 }
 
 
-static void garbage_collect()
+void garbage_collect()
 {
     mark();
     sweep();
@@ -640,6 +841,39 @@ void maybe_garbage_collect()
 
 
 
+/*
+ * Makes every live object immortal. Refcount changes and the
+ * collector leave sealed objects alone, so their memory stays
+ * shared with processes forked afterwards. Garbage is collected
+ * first, so that it isn't sealed along with them, and the cells it
+ * leaves stay on the freelist.
+ */
+void seal_heap()
+{
+    unsigned long current_slot;
+
+    garbage_collect();
+
+    for (current_slot = 0;
+	 current_slot < HEAP_ARRAY_SLOT_COUNT;
+	 current_slot++)
+    {
+	if (((HEAP_ARRAY[current_slot].flags & HEAP_CELL_FLAG_FREE) == 0)
+	    && (HEAP_ARRAY[current_slot].value.object != NULL)) {
+	    HEAP_ARRAY[current_slot].flags |= HEAP_CELL_FLAG_SEALED;
+	    HEAP_ARRAY_SEALED_SLOT_COUNT = current_slot + 1;
+	}
+    }
+}
+
+
+unsigned long heap_size()
+{
+    return HEAP_ARRAY_SLOT_COUNT;
+}
+
+
+
 /*
  * INIT SECTION
  */
@@ -677,6 +911,7 @@ void end_memory_system()
      */
     // Avoid decreasing refcount of already sweeped objects
     GLOBAL_REFCOUNT_LOCK = true;
+    HEAP_ARRAY_SEALED_SLOT_COUNT = 0;
     sweep();
 
     
@@ -687,10 +922,15 @@ void end_memory_system()
     if (ROOT_OBJECT_POOL != NULL) {
 	free(ROOT_OBJECT_POOL);
     }
+
+    free(MARK_STACK);
+    MARK_STACK = NULL;
+    MARK_STACK_ALLOC_SIZE = 0;
     
     if (HEAP_ARRAY != NULL) {
 	HEAP_ARRAY_SLOT_COUNT = 0;
 	HEAP_ARRAY_FREELIST = EMPTY_LIST;
+	HEAP_ARRAY_FREE_SLOT_COUNT = 0;
 	free(HEAP_ARRAY);
     }
 }
@@ -14,8 +14,37 @@
 
 
 struct object;
+
+
+/*
+ * Object references
+ *
+ * References are indices into the heap array. When building with
+ * -DNIL_NAN_BOXING, they are 64 bit wide instead: indices below
+ * 2^48 stay as they are, and reals are stored unboxed as their bits
+ * plus 2^48, which moves every double, with NaNs canonicalized,
+ * above the indices. Unboxed reals are of TYPE_NUMBER but have no
+ * object, dereference() returns NULL for them.
+ */
+
+#ifdef NIL_NAN_BOXING
+
+typedef uint64_t objptr_t;
+
+#define OBJPTR_REAL_OFFSET ((uint64_t) 1 << 48)
+#define IS_UNBOXED_REAL(P) ((P) >= OBJPTR_REAL_OFFSET)
+
+objptr_t box_real(double);
+double unbox_real(objptr_t);
+
+#else
+
 typedef unsigned int objptr_t;
 
+#define IS_UNBOXED_REAL(P) false
+
+#endif
+
 extern objptr_t EMPTY_LIST, NIL_TRUE, NIL_FALSE;
 
 
@@ -99,6 +128,7 @@ struct object {
 
 // Memory access functions
 objptr_t object_allocate(struct object_type*);
+void reserve_heap_slots(unsigned long);
 struct object *dereference(objptr_t);
 
 // Type and equality functions
@@ -115,8 +145,12 @@ void make_refcount_immune(objptr_t);
 
 void increase_refcount(objptr_t);
 void decrease_refcount(objptr_t);
+void decrease_refcount_keep(objptr_t);
 
+void garbage_collect();
 void maybe_garbage_collect();
+void seal_heap();
+unsigned long heap_size();
 
 // Init/Termination functions
 void free_type_instances(struct object_type*);
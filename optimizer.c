@@ -0,0 +1,414 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "bytecode.h"
+
+#include "optimizer.h"
+
+
+
+/*
+ * Peephole optimizer
+ *
+ * The compiler emits code in a single pass and doesn't look
+ * at its neighbourhood. This pass cleans up afterwards:
+ *
+ *  - jumps to unconditional jumps are threaded
+ *  - unreachable code and jumps to the next instruction are removed
+ *  - values which are pushed only to be popped again are dropped
+ *  - remaining instructions are compacted and jumps relabeled
+ *  - frequent pairs of instructions are fused into superinstructions
+ */
+
+
+#define MAX_OPTIMIZER_ROUNDS 8
+#define MAX_JUMP_CHAIN 16
+
+
+static bool superinstruction_parts(unsigned int opcode,
+                                   unsigned int *first,
+                                   unsigned int *second,
+                                   unsigned int *bits)
+{
+    switch (opcode) {
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS)       \
+    case INSTR_##NAME:                                          \
+        *first = INSTR_##FIRST;                                 \
+        *second = INSTR_##SECOND;                               \
+        *bits = BITS;                                           \
+        return true;
+
+    SUPERINSTRUCTION_TABLE
+
+#undef SUPERINSTRUCTION
+    default:
+        return false;
+    }
+}
+
+
+static unsigned int fused_opcode(unsigned int first, unsigned int second)
+{
+#define SUPERINSTRUCTION(NAME, CODE, FIRST, SECOND, BITS)               \
+    if ((first == INSTR_##FIRST) && (second == INSTR_##SECOND)) {       \
+        return INSTR_##NAME;                                            \
+    }
+
+    SUPERINSTRUCTION_TABLE
+
+#undef SUPERINSTRUCTION
+    return INSTR_HALT;
+}
+
+
+static bool is_jump(unsigned int opcode)
+{
+    unsigned int first, second, bits;
+
+    if (superinstruction_parts(opcode, &first, &second, &bits)) {
+        // Jumps are only allowed as the second part
+        return is_jump(second);
+    }
+
+    return (opcode == INSTR_JMP) || (opcode == INSTR_JMP_IF_NOT);
+}
+
+
+static unsigned int jump_target(instr_t instruction)
+{
+    unsigned int first, second, bits;
+
+    if (superinstruction_parts(INSTRUCTION_PART(instruction),
+                               &first, &second, &bits)) {
+        return SUPERINSTRUCTION_SECOND_ARGUMENT(ARGUMENT_PART(instruction), bits);
+    }
+
+    return ARGUMENT_PART(instruction);
+}
+
+
+static instr_t set_jump_target(instr_t instruction, unsigned int target)
+{
+    unsigned int first, second, bits;
+
+    if (superinstruction_parts(INSTRUCTION_PART(instruction),
+                               &first, &second, &bits)) {
+        return INSTRUCTION(INSTRUCTION_PART(instruction),
+                           SUPERINSTRUCTION_ARGUMENT(
+                               SUPERINSTRUCTION_FIRST_ARGUMENT(ARGUMENT_PART(instruction),
+                                                               bits),
+                               target,
+                               bits));
+    }
+
+    return INSTRUCTION(INSTRUCTION_PART(instruction), target);
+}
+
+
+static bool pushes_without_side_effect(unsigned int opcode)
+{
+    return (opcode == INSTR_PUSH_CONST)
+        || (opcode == INSTR_LOOKUP_CONST)
+        || (opcode == INSTR_MAKE_CLOSURE);
+}
+
+
+
+static bool thread_jumps(struct code *code)
+{
+    unsigned int i;
+    unsigned int chain;
+    unsigned int target;
+    bool changed;
+
+    changed = false;
+
+    for (i = 0; i < code->code_size; i++)
+    {
+        if (!is_jump(INSTRUCTION_PART(code->codes[i]))) {
+            continue;
+        }
+
+        target = jump_target(code->codes[i]);
+        for (chain = 0; chain < MAX_JUMP_CHAIN; chain++)
+        {
+            if ((target >= code->code_size)
+                || (INSTRUCTION_PART(code->codes[target]) != INSTR_JMP)
+                || (jump_target(code->codes[target]) == target)) {
+                break;
+            }
+            target = jump_target(code->codes[target]);
+        }
+
+        if (target != jump_target(code->codes[i])) {
+            code->codes[i] = set_jump_target(code->codes[i], target);
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+
+static void mark_reachable(struct code *code, bool *reachable, unsigned int *worklist)
+{
+    unsigned int count;
+    unsigned int i;
+    unsigned int opcode;
+
+    count = 0;
+
+    if (code->code_size > 0) {
+        worklist[count++] = 0;
+        reachable[0] = true;
+    }
+
+    while (count > 0)
+    {
+        i = worklist[--count];
+        opcode = INSTRUCTION_PART(code->codes[i]);
+
+        if (is_jump(opcode)
+            && (jump_target(code->codes[i]) < code->code_size)
+            && !reachable[jump_target(code->codes[i])]) {
+            reachable[jump_target(code->codes[i])] = true;
+            worklist[count++] = jump_target(code->codes[i]);
+        }
+
+        /*
+         * Everything except for jumps and HALT may fall through.
+         * Tailcalls of primitives continue with the next instruction.
+         */
+        if ((opcode != INSTR_JMP)
+            && (opcode != INSTR_HALT)
+            && (i + 1 < code->code_size)
+            && !reachable[i + 1]) {
+            reachable[i + 1] = true;
+            worklist[count++] = i + 1;
+        }
+    }
+}
+
+
+static void mark_jump_targets(struct code *code, bool *deleted, bool *is_target)
+{
+    unsigned int i;
+
+    memset(is_target, 0, (code->code_size + 1) * sizeof(bool));
+
+    for (i = 0; i < code->code_size; i++)
+    {
+        if (!deleted[i] && is_jump(INSTRUCTION_PART(code->codes[i]))) {
+            is_target[jump_target(code->codes[i])] = true;
+        }
+    }
+}
+
+
+static unsigned int next_live(struct code *code, bool *deleted, unsigned int i)
+{
+    for (i++; (i < code->code_size) && deleted[i]; i++);
+    return i;
+}
+
+
+static bool remove_redundancies(struct code *code, bool *deleted, bool *is_target)
+{
+    unsigned int i, next;
+    unsigned int opcode, next_opcode;
+    unsigned int argument, next_argument;
+    bool changed;
+
+    changed = false;
+
+    for (i = 0; i < code->code_size; i++)
+    {
+        if (deleted[i]) {
+            continue;
+        }
+
+        opcode = INSTRUCTION_PART(code->codes[i]);
+        argument = ARGUMENT_PART(code->codes[i]);
+
+        if ((opcode == INSTR_POP) && (argument == 0)) {
+            deleted[i] = true;
+            changed = true;
+            continue;
+        }
+
+        if ((opcode == INSTR_JMP)
+            && (jump_target(code->codes[i]) == next_live(code, deleted, i))) {
+            deleted[i] = true;
+            changed = true;
+            continue;
+        }
+
+        /*
+         * The remaining patterns combine two instructions, which
+         * is only possible if nobody jumps between them.
+         */
+        next = next_live(code, deleted, i);
+        if ((next >= code->code_size) || is_target[next]) {
+            continue;
+        }
+
+        next_opcode = INSTRUCTION_PART(code->codes[next]);
+        next_argument = ARGUMENT_PART(code->codes[next]);
+
+        if (next_opcode != INSTR_POP || next_argument == 0) {
+            continue;
+        }
+
+        if (pushes_without_side_effect(opcode)) {
+            deleted[i] = true;
+            code->codes[next] = INSTRUCTION(INSTR_POP, next_argument - 1);
+            changed = true;
+        } else if ((opcode == INSTR_DEFINE_CONST) || (opcode == INSTR_SET_CONST)) {
+            code->codes[i] = INSTRUCTION((opcode == INSTR_DEFINE_CONST)
+                                         ? INSTR_DEFINE_CONST_DROP
+                                         : INSTR_SET_CONST_DROP,
+                                         argument);
+            code->codes[next] = INSTRUCTION(INSTR_POP, next_argument - 1);
+            changed = true;
+        } else if (opcode == INSTR_POP) {
+            code->codes[i] = INSTRUCTION(INSTR_POP, argument + next_argument);
+            deleted[next] = true;
+            changed = true;
+        }
+    }
+
+    return changed;
+}
+
+
+static void compact(struct code *code, bool *deleted, unsigned int *new_index)
+{
+    unsigned int i, j;
+
+    for (i = 0, j = 0; i < code->code_size; i++)
+    {
+        new_index[i] = j;
+        if (!deleted[i]) {
+            j++;
+        }
+    }
+    new_index[code->code_size] = j;
+
+    for (i = 0, j = 0; i < code->code_size; i++)
+    {
+        if (deleted[i]) {
+            continue;
+        }
+
+        if (is_jump(INSTRUCTION_PART(code->codes[i]))) {
+            code->codes[j++] = set_jump_target(code->codes[i],
+                                               new_index[jump_target(code->codes[i])]);
+        } else {
+            code->codes[j++] = code->codes[i];
+        }
+    }
+
+    code->code_size = j;
+}
+
+
+static void fuse_superinstructions(struct code *code, bool *deleted, bool *is_target,
+                                   unsigned int *new_index)
+{
+    unsigned int i;
+    unsigned int opcode;
+    unsigned int first, second, bits;
+
+    memset(deleted, 0, (code->code_size + 1) * sizeof(bool));
+    mark_jump_targets(code, deleted, is_target);
+
+    for (i = 0; i + 1 < code->code_size; i++)
+    {
+        if (is_target[i + 1]) {
+            continue;
+        }
+
+        opcode = fused_opcode(INSTRUCTION_PART(code->codes[i]),
+                              INSTRUCTION_PART(code->codes[i + 1]));
+        if (opcode == INSTR_HALT) {
+            continue;
+        }
+
+        superinstruction_parts(opcode, &first, &second, &bits);
+        if (!SUPERINSTRUCTION_ARGUMENTS_FIT(ARGUMENT_PART(code->codes[i]),
+                                            ARGUMENT_PART(code->codes[i + 1]),
+                                            bits)) {
+            continue;
+        }
+
+        code->codes[i] = INSTRUCTION(opcode,
+                                     SUPERINSTRUCTION_ARGUMENT(ARGUMENT_PART(code->codes[i]),
+                                                               ARGUMENT_PART(code->codes[i + 1]),
+                                                               bits));
+        deleted[i + 1] = true;
+        i++;
+    }
+
+    compact(code, deleted, new_index);
+}
+
+
+void optimize_code(struct code *code)
+{
+    unsigned int i;
+    unsigned int round;
+    bool changed;
+    bool *deleted;
+    bool *is_target;
+    unsigned int *indexes;
+
+    if (code->code_size == 0) {
+        return;
+    }
+
+    /*
+     * The code stays as it is if there's no memory to work in.
+     * The worklist of mark_reachable() and the new positions of
+     * compact() share the indexes, they are never used together.
+     */
+    deleted = malloc((code->code_size + 1) * sizeof(bool));
+    is_target = malloc((code->code_size + 1) * sizeof(bool));
+    indexes = malloc((code->code_size + 1) * sizeof(unsigned int));
+    if (deleted == NULL || is_target == NULL || indexes == NULL) {
+        free(indexes);
+        free(is_target);
+        free(deleted);
+        return;
+    }
+
+    for (round = 0, changed = true; changed && round < MAX_OPTIMIZER_ROUNDS; round++)
+    {
+        changed = thread_jumps(code);
+
+        /*
+         * Everything that can't be reached is deleted.
+         */
+        memset(deleted, 0, (code->code_size + 1) * sizeof(bool));
+        mark_reachable(code, deleted, indexes);
+        for (i = 0; i < code->code_size; i++)
+        {
+            deleted[i] = !deleted[i];
+            changed = changed || deleted[i];
+        }
+
+        mark_jump_targets(code, deleted, is_target);
+        changed = remove_redundancies(code, deleted, is_target) || changed;
+
+        compact(code, deleted, indexes);
+    }
+
+    /*
+     * Fusing comes last, the other passes only know about
+     * plain instructions.
+     */
+    fuse_superinstructions(code, deleted, is_target, indexes);
+
+    free(indexes);
+    free(is_target);
+    free(deleted);
+}
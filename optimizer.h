@@ -0,0 +1,12 @@
+#pragma once
+
+#ifndef OPTIMIZER_H_
+#define OPTIMIZER_H_
+
+
+#include "compiler.h"
+
+
+void optimize_code(struct code*);
+
+#endif
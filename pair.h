@@ -1,7 +1,7 @@
 #pragma once
 
-#ifndef NUMBERS_H_
-#define NUMBERS_H_
+#ifndef PAIR_H_
+#define PAIR_H_
 
 #include <stdlib.h>
 
@@ -0,0 +1,917 @@
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "baby_io.h"
+#include "bignum.h"
+#include "character.h"
+#include "number.h"
+#include "pair.h"
+#include "string_kernels.h"
+#include "string_object.h"
+#include "symbol.h"
+#include "vector.h"
+
+#include "parallel_reader.h"
+
+
+// Pieces per thread, so that threads done early take on more
+#define PIECES_PER_THREAD 4
+
+// Smaller pieces aren't worth a hand-over
+#define MIN_PIECE_SIZE 65536
+
+
+
+/*
+ * Staged data
+ *
+ * The nodes of a piece are its forms in prefix order: lists, vectors
+ * and rationals are followed by their parts. Symbols are numbers
+ * into the piece's own symbol table, whose names are interned once
+ * per piece when the objects are made.
+ */
+
+
+enum staged_kind {
+    STAGED_TRUE,
+    STAGED_FALSE,
+    STAGED_INTEGER,
+    STAGED_BIGNUM,      // COUNT limbs, negative if FLAG
+    STAGED_RATIONAL,    // Followed by the numerator and denominator
+    STAGED_REAL,
+    STAGED_CHARACTER,
+    STAGED_STRING,      // COUNT codes from the offset
+    STAGED_SYMBOL,
+    STAGED_LIST,        // Followed by COUNT elements and the tail if FLAG
+    STAGED_VECTOR       // Followed by COUNT elements
+};
+
+
+struct staged_node {
+    unsigned char kind;
+    bool flag;
+    unsigned int count;
+    union {
+        long long integer;
+        double real;
+        unichar_t character;
+        size_t offset;
+        unsigned int symbol;
+        limb_t *limbs;      // Owned until the bignum is made
+    } value;
+};
+
+
+struct staged_symbol {
+    size_t offset;          // Of the name in the names
+    unsigned int length;
+    unsigned int hash;
+};
+
+
+struct piece {
+    const char *start;
+    size_t size;
+
+    struct staged_node *nodes;
+    size_t node_count;
+    size_t node_alloc;
+
+    unichar_t *codes;       // Of all strings
+    size_t code_count;
+    size_t code_alloc;
+
+    char *names;            // Of all symbols
+    size_t name_length;
+    size_t name_alloc;
+
+    struct staged_symbol *symbols;
+    size_t symbol_count;
+    size_t symbol_alloc;
+
+    // Open addressing, holding symbol numbers plus one
+    unsigned int *buckets;
+    size_t bucket_count;
+
+    unsigned long forms;
+    bool failed;
+    bool is_staged;
+};
+
+
+enum stage_state {
+    STAGE_ELEMENTS,
+    STAGE_DOTTED_TAIL,      // After the dot
+    STAGE_CLOSING,          // After the dotted tail
+    STAGE_QUOTED            // Waiting for the quoted datum
+};
+
+
+struct stage_frame {
+    size_t node;            // The list or vector
+    unsigned int count;
+    bool is_vector;
+    enum stage_state state;
+};
+
+
+/*
+ * Makes room for one more item in the array at ARRAY of ALLOC items
+ * of SIZE bytes, of which COUNT are used. Returns false if there is
+ * no memory for it.
+ */
+static bool reserve_item(void **array, size_t *alloc, size_t count, size_t size)
+{
+    size_t new_alloc;
+    void *items;
+
+    if (count < *alloc) return true;
+
+    new_alloc = (*alloc < 64) ? 64 : 2 * *alloc;
+    items = realloc(*array, new_alloc * size);
+    if (items == NULL) return false;
+
+    *array = items;
+    *alloc = new_alloc;
+    return true;
+}
+
+
+// Returns NULL if there is no memory for the node
+static struct staged_node *add_node(struct piece *piece, enum staged_kind kind)
+{
+    struct staged_node *node;
+
+    if (!reserve_item((void**) &piece->nodes, &piece->node_alloc,
+                      piece->node_count, sizeof(struct staged_node))) {
+        return NULL;
+    }
+    node = &piece->nodes[piece->node_count++];
+    node->kind = kind;
+    node->flag = false;
+    node->count = 0;
+    node->value.integer = 0;
+    return node;
+}
+
+
+static bool rehash_symbols(struct piece *piece)
+{
+    unsigned int *buckets;
+    size_t i, j, count, mask;
+
+    count = (piece->bucket_count < 256) ? 256 : 2 * piece->bucket_count;
+    buckets = calloc(count, sizeof(unsigned int));
+    if (buckets == NULL) return false;
+
+    free(piece->buckets);
+    piece->buckets = buckets;
+    piece->bucket_count = count;
+
+    mask = piece->bucket_count - 1;
+    for (i = 0; i < piece->symbol_count; i++) {
+        for (j = piece->symbols[i].hash & mask; piece->buckets[j] != 0; j = (j + 1) & mask);
+        piece->buckets[j] = i + 1;
+    }
+    return true;
+}
+
+
+/*
+ * Adds a node for the symbol NAME, numbered in the piece. Returns
+ * false if there is no memory for it.
+ */
+static bool stage_symbol(struct piece *piece, const char *name, unsigned int length)
+{
+    struct staged_node *node;
+    struct staged_symbol *symbol;
+    unsigned int hash;
+    size_t i, mask, alloc;
+    char *names;
+
+    node = add_node(piece, STAGED_SYMBOL);
+    if (node == NULL) return false;
+    if (2 * (piece->symbol_count + 1) > piece->bucket_count
+        && !rehash_symbols(piece)) {
+        return false;
+    }
+
+    hash = units8_hash((const uint8_t*) name, length);
+    mask = piece->bucket_count - 1;
+    for (i = hash & mask; piece->buckets[i] != 0; i = (i + 1) & mask) {
+        symbol = &piece->symbols[piece->buckets[i] - 1];
+        if (symbol->hash == hash && symbol->length == length
+            && memcmp(piece->names + symbol->offset, name, length) == 0) {
+            node->value.symbol = piece->buckets[i] - 1;
+            return true;
+        }
+    }
+
+    if (piece->name_length + length > piece->name_alloc) {
+        alloc = 2 * (piece->name_length + length);
+        names = realloc(piece->names, alloc);
+        if (names == NULL) return false;
+        piece->names = names;
+        piece->name_alloc = alloc;
+    }
+    if (!reserve_item((void**) &piece->symbols, &piece->symbol_alloc,
+                      piece->symbol_count, sizeof(struct staged_symbol))) {
+        return false;
+    }
+
+    memcpy(piece->names + piece->name_length, name, length);
+    symbol = &piece->symbols[piece->symbol_count];
+    symbol->offset = piece->name_length;
+    symbol->length = length;
+    symbol->hash = hash;
+    piece->name_length += length;
+
+    piece->buckets[i] = ++piece->symbol_count;
+    node->value.symbol = piece->symbol_count - 1;
+    return true;
+}
+
+
+// Returns false if there is no memory for the integer
+static bool stage_integer(struct piece *piece, const char *digits, size_t count, bool negative)
+{
+    struct staged_node *node;
+    unsigned long long value;
+    limb_t *limbs;
+    size_t i;
+
+    // Up to 18 digits fit into a long long
+    if (count <= 18) {
+        value = 0;
+        for (i = 0; i < count; i++) {
+            value = 10 * value + (digits[i] - '0');
+        }
+        node = add_node(piece, STAGED_INTEGER);
+        if (node == NULL) return false;
+        node->value.integer = negative ? -(long long) value : (long long) value;
+        return true;
+    }
+
+    limbs = malloc((count / 9 + 1) * sizeof(limb_t));
+    if (limbs == NULL) return false;
+    node = add_node(piece, STAGED_BIGNUM);
+    if (node == NULL) {
+        free(limbs);
+        return false;
+    }
+    node->flag = negative;
+    node->value.limbs = limbs;
+    node->count = bignum_from_decimal(limbs, digits, count);
+    return true;
+}
+
+
+// Returns false on syntax errors and if there is no memory for the atom
+static bool stage_atom(struct piece *piece, const char *token, size_t length)
+{
+    struct atom_syntax atom;
+    struct staged_node *node;
+
+    classify_atom(token, length, &atom);
+    switch (atom.type) {
+    case ATOM_TRUE:
+        return add_node(piece, STAGED_TRUE) != NULL;
+    case ATOM_FALSE:
+        return add_node(piece, STAGED_FALSE) != NULL;
+    case ATOM_INTEGER:
+        return stage_integer(piece, atom.digits, atom.digit_count, atom.negative);
+    case ATOM_RATIONAL:
+        return add_node(piece, STAGED_RATIONAL) != NULL
+            && stage_integer(piece, atom.digits, atom.digit_count, atom.negative)
+            && stage_integer(piece, atom.denominator, atom.denominator_count, false);
+    case ATOM_REAL:
+        node = add_node(piece, STAGED_REAL);
+        if (node == NULL) return false;
+        node->value.real = atom.real;
+        return true;
+    case ATOM_SYMBOL:
+        return stage_symbol(piece, token, length);
+    default:
+        return false;
+    }
+}
+
+
+// Returns false if there is no memory for the string
+static bool stage_string(struct piece *piece, struct baby_reader *reader)
+{
+    struct staged_node *node;
+    unichar_t *codes;
+    size_t alloc;
+
+    if (piece->code_count + reader->code_count > piece->code_alloc) {
+        alloc = 2 * (piece->code_count + reader->code_count);
+        codes = realloc(piece->codes, alloc * sizeof(unichar_t));
+        if (codes == NULL) return false;
+        piece->codes = codes;
+        piece->code_alloc = alloc;
+    }
+
+    node = add_node(piece, STAGED_STRING);
+    if (node == NULL) return false;
+    node->count = reader->code_count;
+    node->value.offset = piece->code_count;
+
+    memcpy(piece->codes + piece->code_count, reader->codes,
+           reader->code_count * sizeof(unichar_t));
+    piece->code_count += reader->code_count;
+    return true;
+}
+
+
+// Returns NULL if there is no memory for the frame
+static struct stage_frame *push_stage_frame(struct stage_frame **frames,
+                                            size_t *frame_alloc, size_t depth)
+{
+    if (!reserve_item((void**) frames, frame_alloc, depth, sizeof(struct stage_frame))) {
+        return NULL;
+    }
+    return &(*frames)[depth];
+}
+
+
+/*
+ * Parses the forms of a piece into its nodes. Runs on the worker
+ * threads, so it only uses the lexer and the piece. Syntax errors
+ * and running out of memory fail the piece.
+ */
+static void stage_piece(struct piece *piece)
+{
+    struct baby_reader reader;
+    struct stage_frame *frames, *frame;
+    struct staged_node *node;
+    size_t depth, frame_alloc;
+    enum token_type token;
+    bool failed;
+
+    open_buffer_reader(&reader, piece->start, piece->size);
+    frames = NULL;
+    frame_alloc = 0;
+    depth = 0;
+    failed = false;
+
+    while (!failed) {
+        token = reader_next_token(&reader);
+        if (token == TOKEN_END) {
+            failed = (depth > 0);
+            break;
+        }
+
+        switch (token) {
+        case TOKEN_QUOTE:
+            frame = push_stage_frame(&frames, &frame_alloc, depth++);
+            if (frame == NULL) {
+                failed = true;
+                continue;
+            }
+            frame->node = piece->node_count;
+            frame->count = 0;
+            frame->is_vector = false;
+            frame->state = STAGE_QUOTED;
+            node = add_node(piece, STAGED_LIST);
+            if (node != NULL) node->count = 2;
+            failed = (node == NULL) || !stage_symbol(piece, "quote", 5);
+            continue;
+        case TOKEN_OPEN:
+        case TOKEN_OPEN_VECTOR:
+            frame = push_stage_frame(&frames, &frame_alloc, depth++);
+            if (frame == NULL) {
+                failed = true;
+                continue;
+            }
+            frame->node = piece->node_count;
+            frame->count = 0;
+            frame->is_vector = (token == TOKEN_OPEN_VECTOR);
+            frame->state = STAGE_ELEMENTS;
+            failed = (add_node(piece, frame->is_vector ? STAGED_VECTOR : STAGED_LIST) == NULL);
+            continue;
+        case TOKEN_CLOSE:
+            frame = (depth > 0) ? &frames[depth - 1] : NULL;
+            if (frame == NULL || frame->state == STAGE_QUOTED
+                || frame->state == STAGE_DOTTED_TAIL) {
+                failed = true;
+                continue;
+            }
+            piece->nodes[frame->node].count = frame->count;
+            piece->nodes[frame->node].flag = (frame->state == STAGE_CLOSING);
+            depth--;
+            break;
+        case TOKEN_DOT:
+            frame = (depth > 0) ? &frames[depth - 1] : NULL;
+            if (frame == NULL || frame->is_vector || frame->count == 0
+                || frame->state != STAGE_ELEMENTS) {
+                failed = true;
+                continue;
+            }
+            frame->state = STAGE_DOTTED_TAIL;
+            continue;
+        case TOKEN_STRING:
+            failed = !stage_string(piece, &reader);
+            break;
+        case TOKEN_CHARACTER:
+            node = add_node(piece, STAGED_CHARACTER);
+            if (node != NULL) node->value.character = reader.character;
+            failed = (node == NULL);
+            break;
+        case TOKEN_ATOM:
+            failed = !stage_atom(piece, reader.token, reader.token_length);
+            break;
+        default:
+            failed = true;
+            continue;
+        }
+
+        // A datum is complete, count it in the enclosing frames
+        for (;;) {
+            if (depth == 0) {
+                piece->forms++;
+                break;
+            }
+
+            frame = &frames[depth - 1];
+            if (frame->state == STAGE_QUOTED) {
+                depth--;
+                continue;
+            } else if (frame->state == STAGE_DOTTED_TAIL) {
+                frame->state = STAGE_CLOSING;
+            } else if (frame->state == STAGE_CLOSING) {
+                failed = true;
+            } else {
+                frame->count++;
+            }
+            break;
+        }
+    }
+
+    piece->failed = failed;
+    free(frames);
+    close_reader(&reader);
+}
+
+
+static void free_piece(struct piece *piece)
+{
+    size_t i;
+
+    // Bignums not made yet still own their limbs
+    for (i = 0; i < piece->node_count; i++) {
+        if (piece->nodes[i].kind == STAGED_BIGNUM) free(piece->nodes[i].value.limbs);
+    }
+
+    free(piece->nodes);
+    free(piece->codes);
+    free(piece->names);
+    free(piece->symbols);
+    free(piece->buckets);
+    memset(piece, 0, sizeof(struct piece));
+}
+
+
+
+/*
+ * Splitting
+ */
+
+
+static bool is_whitespace_char(char c)
+{
+    return (c == ' ') || (c == '\t') || (c == '\n')
+        || (c == '\r') || (c == '\f') || (c == '\v');
+}
+
+
+/*
+ * Splits the SIZE bytes at DATA into up to COUNT pieces of about the
+ * same size, cutting only at whitespace between top-level forms.
+ * The scan keeps track of just enough syntax to know the depth:
+ * strings, comments and characters like #\( . Returns the number of
+ * pieces.
+ */
+static unsigned int split_forms(const char *data, size_t size,
+                                struct piece *pieces, unsigned int count)
+{
+    const char *p, *end, *start, *newline;
+    unsigned int n;
+    size_t depth;
+    bool quoted, in_token;
+
+    p = data;
+    end = data + size;
+    start = data;
+    n = 0;
+    depth = 0;
+    quoted = false;     // After a quote, which belongs to the next datum
+    in_token = false;
+
+    for (; p < end; p++) {
+        switch (*p) {
+        case ';':
+            newline = memchr(p, '\n', end - p);
+            p = (newline != NULL) ? newline - 1 : end - 1;
+            in_token = false;
+            continue;
+        case '"':
+            for (p++; p < end && *p != '"'; p++) {
+                if (*p == '\\') p++;
+            }
+            quoted = false;
+            in_token = false;
+            continue;
+        case '(':
+            depth++;
+            quoted = false;
+            in_token = false;
+            continue;
+        case ')':
+            if (depth > 0) depth--;
+            in_token = false;
+            continue;
+        case '\'':
+            quoted = true;
+            in_token = false;
+            continue;
+        case '#':
+            // The character after #\ may be a delimiter
+            if (!in_token && p + 1 < end && p[1] == '\\') {
+                p = (p + 2 < end) ? p + 2 : end - 1;
+                quoted = false;
+                in_token = true;
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+
+        if (!is_whitespace_char(*p)) {
+            quoted = false;
+            in_token = true;
+            continue;
+        }
+
+        in_token = false;
+        if (depth == 0 && !quoted && n + 1 < count
+            && (size_t) (p - data) >= (n + 1) * (size / count)) {
+            pieces[n].start = start;
+            pieces[n].size = p - start;
+            start = p;
+            n++;
+        }
+    }
+
+    pieces[n].start = start;
+    pieces[n].size = end - start;
+    return n + 1;
+}
+
+
+
+/*
+ * Making objects
+ */
+
+
+// Frees a fresh object nothing refers to
+static void release(objptr_t ptr)
+{
+    increase_refcount(ptr);
+    decrease_refcount(ptr);
+}
+
+
+struct make_frame {
+    enum staged_kind kind;
+    unsigned int remaining;
+    bool is_dotted;
+    objptr_t head;          // The list, vector or numerator
+    objptr_t tail;          // The last pair of a list
+};
+
+
+/*
+ * Appends the forms of a staged piece to FORMS. Takes over the limbs
+ * of its bignums. Returns false if there is no memory for the
+ * objects.
+ */
+static bool make_piece_forms(struct piece *piece, objptr_t forms)
+{
+    struct staged_node *node;
+    struct make_frame *frames, *frame;
+    size_t i, depth, frame_alloc;
+    objptr_t *symbols, datum, pair;
+    bool failed;
+
+    symbols = malloc((piece->symbol_count + 1) * sizeof(objptr_t));
+    if (symbols == NULL) return false;
+    for (i = 0; i < piece->symbol_count; i++) {
+        symbols[i] = latin1_to_symbol(piece->names + piece->symbols[i].offset,
+                                      piece->symbols[i].length,
+                                      piece->symbols[i].hash);
+        if (symbols[i] == EMPTY_LIST) {
+            free(symbols);
+            return false;
+        }
+    }
+
+    vector_reserve(forms, vector_length(forms) + piece->forms);
+    frames = NULL;
+    frame_alloc = 0;
+    depth = 0;
+    failed = false;
+
+    for (i = 0; i < piece->node_count && !failed; i++) {
+        node = &piece->nodes[i];
+        switch (node->kind) {
+        case STAGED_TRUE:
+            datum = NIL_TRUE;
+            break;
+        case STAGED_FALSE:
+            datum = NIL_FALSE;
+            break;
+        case STAGED_INTEGER:
+            datum = make_integer_from_long_long(node->value.integer);
+            failed = (datum == EMPTY_LIST);
+            break;
+        case STAGED_BIGNUM:
+            datum = make_integer_from_limbs(node->flag, node->value.limbs, node->count);
+            // The number owns the limbs now, or freed them
+            node->kind = STAGED_INTEGER;
+            failed = (datum == EMPTY_LIST);
+            break;
+        case STAGED_REAL:
+            datum = make_real(node->value.real);
+            failed = (datum == EMPTY_LIST);
+            break;
+        case STAGED_CHARACTER:
+            datum = get_character(node->value.character);
+            break;
+        case STAGED_STRING:
+            datum = make_string_from_codes(piece->codes + node->value.offset, node->count);
+            if (datum != EMPTY_LIST) {
+                ((struct string*) dereference(datum))->is_immutable = true;
+            }
+            failed = (datum == EMPTY_LIST);
+            break;
+        case STAGED_SYMBOL:
+            datum = symbols[node->value.symbol];
+            break;
+        default:
+            if (node->kind == STAGED_LIST && node->count == 0) {
+                datum = EMPTY_LIST;
+                break;
+            }
+
+            if (!reserve_item((void**) &frames, &frame_alloc, depth, sizeof(struct make_frame))) {
+                failed = true;
+                continue;
+            }
+            frame = &frames[depth++];
+            frame->kind = node->kind;
+            frame->remaining = (node->kind == STAGED_RATIONAL) ? 2 : node->count;
+            frame->is_dotted = node->flag;
+            frame->head = EMPTY_LIST;
+            frame->tail = EMPTY_LIST;
+
+            if (node->kind != STAGED_VECTOR) continue;
+            frame->head = make_vector(EMPTY_LIST, 0);
+            vector_reserve(frame->head, node->count);
+            if (node->count > 0) continue;
+
+            datum = frame->head;
+            depth--;
+            break;
+        }
+
+        if (failed) continue;
+
+        // Add the datum to the enclosing frames it completes
+        while (depth > 0) {
+            frame = &frames[depth - 1];
+            if (frame->kind == STAGED_VECTOR) {
+                vector_append(frame->head, datum);
+                if (--frame->remaining > 0) break;
+                datum = frame->head;
+            } else if (frame->kind == STAGED_RATIONAL) {
+                if (--frame->remaining > 0) {
+                    frame->head = datum;
+                    break;
+                }
+                pair = datum;
+                datum = number_divide(frame->head, pair);
+                release(frame->head);
+                release(pair);
+                if (datum == EMPTY_LIST) {
+                    failed = true;
+                    depth--;
+                    break;
+                }
+            } else if (frame->remaining > 0) {
+                pair = cons(datum, EMPTY_LIST);
+                if (frame->head == EMPTY_LIST) {
+                    frame->head = pair;
+                } else {
+                    set_cdr(frame->tail, pair);
+                }
+                frame->tail = pair;
+                if (--frame->remaining > 0 || frame->is_dotted) break;
+                datum = frame->head;
+            } else {
+                set_cdr(frame->tail, datum);
+                datum = frame->head;
+            }
+            depth--;
+        }
+
+        if (depth == 0 && !failed) vector_append(forms, datum);
+    }
+
+    // Free the unfinished lists, vectors and numerators
+    for (; failed && depth > 0; depth--) {
+        release(frames[depth - 1].head);
+    }
+    free(frames);
+    free(symbols);
+    return !failed;
+}
+
+
+
+/*
+ * Reading
+ */
+
+
+struct parallel_read {
+    struct piece *pieces;
+    unsigned int piece_count;
+    unsigned int next_piece;    // The next one to stage
+    bool is_cancelled;
+    pthread_mutex_t lock;
+    pthread_cond_t staged;
+};
+
+
+static void *stage_pieces(void *argument)
+{
+    struct parallel_read *read = argument;
+    unsigned int index;
+
+    for (;;) {
+        pthread_mutex_lock(&read->lock);
+        index = read->is_cancelled ? read->piece_count : read->next_piece;
+        if (index < read->piece_count) read->next_piece++;
+        pthread_mutex_unlock(&read->lock);
+
+        if (index >= read->piece_count) return NULL;
+        stage_piece(&read->pieces[index]);
+
+        pthread_mutex_lock(&read->lock);
+        read->pieces[index].is_staged = true;
+        pthread_cond_broadcast(&read->staged);
+        pthread_mutex_unlock(&read->lock);
+    }
+}
+
+
+// Reads the file straight into the heap, without staging
+static objptr_t read_file_sequential(const char *path, bool *fail)
+{
+    struct baby_reader reader;
+    objptr_t forms, datum;
+
+    if (!open_file_reader(&reader, path)) {
+        *fail = true;
+        return EMPTY_LIST;
+    }
+
+    forms = make_vector(EMPTY_LIST, 0);
+    while (!reader_at_end(&reader)) {
+        datum = reader_read(&reader, fail);
+        if (*fail) break;
+        vector_append(forms, datum);
+    }
+    close_reader(&reader);
+
+    if (*fail) {
+        release(forms);
+        return EMPTY_LIST;
+    }
+    return forms;
+}
+
+
+/*
+ * Returns a vector of the forms in the file at PATH, read with up to
+ * THREADS threads. Sets FAIL if the file can't be read or has a
+ * syntax error.
+ */
+objptr_t read_file_parallel(const char *path, unsigned int threads, bool *fail)
+{
+    struct stat info;
+    struct parallel_read read;
+    pthread_t *workers;
+    unsigned int i, started;
+    objptr_t forms;
+    char *data;
+    int fd;
+
+    *fail = false;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0 || fstat(fd, &info) != 0) {
+        if (fd >= 0) close(fd);
+        *fail = true;
+        return EMPTY_LIST;
+    }
+
+    // Staging only pays off when pieces are staged side by side
+    if (threads <= 1 || info.st_size < 2 * MIN_PIECE_SIZE) {
+        close(fd);
+        return read_file_sequential(path, fail);
+    }
+
+    data = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        *fail = true;
+        return EMPTY_LIST;
+    }
+    madvise(data, info.st_size, MADV_SEQUENTIAL);
+
+    read.piece_count = threads * PIECES_PER_THREAD;
+    if (read.piece_count > info.st_size / MIN_PIECE_SIZE) {
+        read.piece_count = info.st_size / MIN_PIECE_SIZE + 1;
+    }
+    read.pieces = calloc(read.piece_count, sizeof(struct piece));
+    if (read.pieces == NULL) {
+        munmap(data, info.st_size);
+        *fail = true;
+        return EMPTY_LIST;
+    }
+    read.piece_count = split_forms(data, info.st_size, read.pieces, read.piece_count);
+    read.next_piece = 0;
+    read.is_cancelled = false;
+    pthread_mutex_init(&read.lock, NULL);
+    pthread_cond_init(&read.staged, NULL);
+
+    if (threads > read.piece_count) threads = read.piece_count;
+    workers = malloc(threads * sizeof(pthread_t));
+    for (started = 0; workers != NULL && started < threads; started++) {
+        if (pthread_create(&workers[started], NULL, stage_pieces, &read) != 0) break;
+    }
+    // Stage everything here if no thread could be started
+    if (started == 0) stage_pieces(&read);
+
+    // Make the objects in file order while the later pieces are staged
+    forms = make_vector(EMPTY_LIST, 0);
+    for (i = 0; i < read.piece_count; i++) {
+        pthread_mutex_lock(&read.lock);
+        while (!read.pieces[i].is_staged) {
+            pthread_cond_wait(&read.staged, &read.lock);
+        }
+        if (read.pieces[i].failed) read.is_cancelled = true;
+        pthread_mutex_unlock(&read.lock);
+
+        if (read.pieces[i].failed) {
+            *fail = true;
+            break;
+        }
+        if (!make_piece_forms(&read.pieces[i], forms)) {
+            pthread_mutex_lock(&read.lock);
+            read.is_cancelled = true;
+            pthread_mutex_unlock(&read.lock);
+            *fail = true;
+            break;
+        }
+        free_piece(&read.pieces[i]);
+    }
+
+    for (i = 0; i < started; i++) {
+        pthread_join(workers[i], NULL);
+    }
+    for (i = 0; i < read.piece_count; i++) {
+        free_piece(&read.pieces[i]);
+    }
+
+    free(workers);
+    free(read.pieces);
+    pthread_cond_destroy(&read.staged);
+    pthread_mutex_destroy(&read.lock);
+    munmap(data, info.st_size);
+
+    if (*fail) {
+        release(forms);
+        return EMPTY_LIST;
+    }
+    return forms;
+}
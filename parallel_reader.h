@@ -0,0 +1,25 @@
+#pragma once
+
+#ifndef PARALLEL_READER_H_
+#define PARALLEL_READER_H_
+
+#include <stdbool.h>
+
+#include "object.h"
+
+
+/*
+ * Parallel reader
+ *
+ * Reads data files made of many independent top-level forms. The
+ * file is split into pieces at top-level form boundaries, and worker
+ * threads parse the pieces into staged nodes of their own, since
+ * they can't touch the heap or the symbol table. The main thread
+ * then interns the symbols of each piece and makes the objects, in
+ * file order, while the workers go on with the later pieces.
+ */
+
+objptr_t read_file_parallel(const char*, unsigned int, bool*);
+
+
+#endif
@@ -0,0 +1,159 @@
+#include <stdlib.h>
+
+#include "bytecode.h"
+#include "symbol.h"
+
+#include "primitive.h"
+
+
+
+void init_primitive(struct primitive *primitive)
+{
+    primitive->name = EMPTY_LIST;
+    primitive->min_arity = 0;
+    primitive->max_arity = PRIMITIVE_VARIADIC;
+    primitive->function = NULL;
+    primitive->inline_opcode = INSTR_HALT;
+    primitive->inline_operand_count = 0;
+}
+
+
+void terminate_primitive(struct primitive *primitive)
+{
+    decrease_refcount(primitive->name);
+    primitive->name = EMPTY_LIST;
+    primitive->function = NULL;
+}
+
+
+unsigned int primitive_slot_count(struct primitive *primitive)
+{
+    return 1;
+}
+
+
+objptr_t primitive_slot_accessor(struct primitive *primitive,
+                                 unsigned int slot)
+{
+    if (slot == 0) {
+        return primitive->name;
+    } else {
+        return EMPTY_LIST;
+    }
+}
+
+
+bool primitive_eqv(struct primitive *p1,
+                   struct primitive *p2,
+                   enum eqv_strictness strictness)
+{
+    return p1 == p2;
+}
+
+
+DEFTYPE(TYPE_PRIMITIVE,
+        struct primitive,
+        init_primitive,
+        terminate_primitive,
+        primitive_slot_count,
+        primitive_slot_accessor,
+        primitive_eqv);
+
+
+
+objptr_t make_primitive(objptr_t name,
+                        primitive_function_t function,
+                        unsigned int min_arity,
+                        unsigned int max_arity)
+{
+    objptr_t ptr;
+    struct primitive *instance;
+
+    ptr = object_allocate(&TYPE_PRIMITIVE);
+
+    if (ptr != EMPTY_LIST) {
+        instance = (struct primitive*) dereference(ptr);
+        instance->name = name;
+        increase_refcount(instance->name);
+        instance->function = function;
+        instance->min_arity = min_arity;
+        instance->max_arity = max_arity;
+    }
+
+    return ptr;
+}
+
+
+bool primitive_accepts(objptr_t ptr, unsigned int argument_count)
+{
+    struct primitive *primitive;
+
+    if (is_of_type(ptr, &TYPE_PRIMITIVE)) {
+        primitive = (struct primitive*) dereference(ptr);
+        return (argument_count >= primitive->min_arity)
+            && (argument_count <= primitive->max_arity);
+    } else {
+        return false;
+    }
+}
+
+
+
+/*
+ * Inline opcodes
+ *
+ * The compiler replaces calls of some builtins by dedicated
+ * opcodes. Each of these opcodes is guarded by a flag which
+ * is cleared as soon as the builtin's name gets rebound. The
+ * names are marked with their opcode, so that rebinding other
+ * names doesn't have to look for them.
+ */
+
+bool PRIMITIVE_INLINE_GUARDS[256];
+
+
+void primitive_set_inline_opcode(objptr_t ptr,
+                                 unsigned int opcode,
+                                 unsigned int operand_count)
+{
+    struct primitive *primitive;
+
+    if (!is_of_type(ptr, &TYPE_PRIMITIVE) || opcode == INSTR_HALT) {
+        return;
+    }
+
+    primitive = (struct primitive*) dereference(ptr);
+    primitive->inline_opcode = opcode;
+    primitive->inline_operand_count = operand_count;
+
+    if (is_of_type(primitive->name, &TYPE_SYMBOL)) {
+        ((struct symbol*) dereference(primitive->name))->inline_opcode = opcode;
+    }
+    PRIMITIVE_INLINE_GUARDS[opcode] = true;
+}
+
+
+unsigned int primitive_inline_opcode(objptr_t ptr, unsigned int operand_count)
+{
+    struct primitive *primitive;
+
+    if (is_of_type(ptr, &TYPE_PRIMITIVE)) {
+        primitive = (struct primitive*) dereference(ptr);
+        if (primitive->inline_opcode != INSTR_HALT
+            && primitive->inline_operand_count == operand_count
+            && PRIMITIVE_INLINE_GUARDS[primitive->inline_opcode]) {
+            return primitive->inline_opcode;
+        }
+    }
+
+    return INSTR_HALT;
+}
+
+
+void primitive_invalidate_inline_opcodes(objptr_t name)
+{
+    // Other names have INSTR_HALT, whose guard is never set
+    if (is_of_type(name, &TYPE_SYMBOL)) {
+        PRIMITIVE_INLINE_GUARDS[((struct symbol*) dereference(name))->inline_opcode] = false;
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#ifndef PRIMITIVE_H_
+#define PRIMITIVE_H_
+
+
+#include "object.h"
+
+
+#define PRIMITIVE_VARIADIC (~0u)
+
+
+/*
+ * Primitives are called with their arguments in a C array,
+ * the first argument being at index 0. The arguments stay
+ * referenced by the caller until the primitive returned.
+ */
+typedef objptr_t (*primitive_function_t)(objptr_t*, unsigned int);
+
+
+struct primitive {
+    struct object head;
+
+    objptr_t name;
+    unsigned int min_arity;
+    unsigned int max_arity;  // PRIMITIVE_VARIADIC for no upper bound
+    primitive_function_t function;
+
+    unsigned int inline_opcode;  // INSTR_HALT if there is none
+    unsigned int inline_operand_count;
+};
+
+
+extern struct object_type TYPE_PRIMITIVE;
+
+extern bool PRIMITIVE_INLINE_GUARDS[256];
+
+objptr_t make_primitive(objptr_t, primitive_function_t, unsigned int, unsigned int);
+bool primitive_accepts(objptr_t, unsigned int);
+
+void primitive_set_inline_opcode(objptr_t, unsigned int, unsigned int);
+unsigned int primitive_inline_opcode(objptr_t, unsigned int);
+void primitive_invalidate_inline_opcodes(objptr_t);
+
+#endif
@@ -0,0 +1,385 @@
+#include <string.h>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include "string_kernels.h"
+
+
+
+/*
+ * The comparison kernels are written once against these macros.
+ * A mask has one bit per byte of a vector, so four bits per four
+ * byte unit.
+ */
+#if defined(__AVX2__)
+
+typedef __m256i vector_t;
+#define VECTOR_BYTES        32
+#define VECTOR_LOAD(P)      _mm256_loadu_si256((const __m256i*) (P))
+#define VECTOR_SPLAT8(C)    _mm256_set1_epi8((char) (C))
+#define VECTOR_SPLAT32(C)   _mm256_set1_epi32((int) (C))
+#define VECTOR_EQUAL8(A, B) _mm256_cmpeq_epi8(A, B)
+#define VECTOR_EQUAL32(A, B) _mm256_cmpeq_epi32(A, B)
+#define VECTOR_AND(A, B)    _mm256_and_si256(A, B)
+#define VECTOR_MASK(V)      ((uint32_t) _mm256_movemask_epi8(V))
+#define VECTOR_FULL_MASK    0xffffffffu
+
+#elif defined(__SSE2__)
+
+typedef __m128i vector_t;
+#define VECTOR_BYTES        16
+#define VECTOR_LOAD(P)      _mm_loadu_si128((const __m128i*) (P))
+#define VECTOR_SPLAT8(C)    _mm_set1_epi8((char) (C))
+#define VECTOR_SPLAT32(C)   _mm_set1_epi32((int) (C))
+#define VECTOR_EQUAL8(A, B) _mm_cmpeq_epi8(A, B)
+#define VECTOR_EQUAL32(A, B) _mm_cmpeq_epi32(A, B)
+#define VECTOR_AND(A, B)    _mm_and_si128(A, B)
+#define VECTOR_MASK(V)      ((uint32_t) _mm_movemask_epi8(V))
+#define VECTOR_FULL_MASK    0xffffu
+
+#endif
+
+
+#define FIRST_BIT(MASK) ((size_t) __builtin_ctz(MASK))
+
+
+
+/*
+ * Mismatch
+ */
+
+
+size_t units8_mismatch(const uint8_t *a, const uint8_t *b, size_t length)
+{
+    size_t i = 0;
+
+#ifdef VECTOR_BYTES
+    uint32_t mask;
+
+    for (; i + VECTOR_BYTES <= length; i += VECTOR_BYTES) {
+        mask = VECTOR_MASK(VECTOR_EQUAL8(VECTOR_LOAD(a + i), VECTOR_LOAD(b + i)));
+        if (mask != VECTOR_FULL_MASK) return i + FIRST_BIT(~mask);
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (a[i] != b[i]) return i;
+    }
+    return length;
+}
+
+
+size_t units32_mismatch(const uint32_t *a, const uint32_t *b, size_t length)
+{
+    size_t i = 0;
+
+#ifdef VECTOR_BYTES
+    uint32_t mask;
+
+    for (; i + VECTOR_BYTES / 4 <= length; i += VECTOR_BYTES / 4) {
+        mask = VECTOR_MASK(VECTOR_EQUAL32(VECTOR_LOAD(a + i), VECTOR_LOAD(b + i)));
+        if (mask != VECTOR_FULL_MASK) return i + FIRST_BIT(~mask) / 4;
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (a[i] != b[i]) return i;
+    }
+    return length;
+}
+
+
+
+/*
+ * Find
+ */
+
+
+size_t units8_find(const uint8_t *units, size_t length, uint8_t code)
+{
+    size_t i = 0;
+
+#ifdef VECTOR_BYTES
+    vector_t wanted = VECTOR_SPLAT8(code);
+    uint32_t mask;
+
+    for (; i + VECTOR_BYTES <= length; i += VECTOR_BYTES) {
+        mask = VECTOR_MASK(VECTOR_EQUAL8(VECTOR_LOAD(units + i), wanted));
+        if (mask != 0) return i + FIRST_BIT(mask);
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (units[i] == code) return i;
+    }
+    return length;
+}
+
+
+size_t units32_find(const uint32_t *units, size_t length, uint32_t code)
+{
+    size_t i = 0;
+
+#ifdef VECTOR_BYTES
+    vector_t wanted = VECTOR_SPLAT32(code);
+    uint32_t mask;
+
+    for (; i + VECTOR_BYTES / 4 <= length; i += VECTOR_BYTES / 4) {
+        mask = VECTOR_MASK(VECTOR_EQUAL32(VECTOR_LOAD(units + i), wanted));
+        if (mask != 0) return i + FIRST_BIT(mask) / 4;
+    }
+#endif
+
+    for (; i < length; i++) {
+        if (units[i] == code) return i;
+    }
+    return length;
+}
+
+
+
+/*
+ * Search
+ *
+ * Candidate positions are those where both the first and the last
+ * unit of the needle match; only these are compared in full. This
+ * checks a whole vector of positions per step.
+ */
+
+
+size_t units8_search(const uint8_t *haystack, size_t length,
+                     const uint8_t *needle, size_t needle_length)
+{
+    size_t i = 0;
+
+    if (needle_length == 0) return 0;
+    if (needle_length > length) return length;
+    if (needle_length == 1) return units8_find(haystack, length, needle[0]);
+
+#ifdef VECTOR_BYTES
+    vector_t first = VECTOR_SPLAT8(needle[0]);
+    vector_t last = VECTOR_SPLAT8(needle[needle_length - 1]);
+    uint32_t mask;
+    size_t position;
+
+    for (; i + needle_length - 1 + VECTOR_BYTES <= length; i += VECTOR_BYTES) {
+        mask = VECTOR_MASK(VECTOR_AND(
+                   VECTOR_EQUAL8(VECTOR_LOAD(haystack + i), first),
+                   VECTOR_EQUAL8(VECTOR_LOAD(haystack + i + needle_length - 1), last)));
+        while (mask != 0) {
+            position = i + FIRST_BIT(mask);
+            if (memcmp(haystack + position + 1, needle + 1, needle_length - 2) == 0) {
+                return position;
+            }
+            mask &= mask - 1;
+        }
+    }
+#endif
+
+    for (; i + needle_length <= length; i++) {
+        if (haystack[i] == needle[0] &&
+            memcmp(haystack + i + 1, needle + 1, needle_length - 1) == 0) {
+            return i;
+        }
+    }
+    return length;
+}
+
+
+size_t units32_search(const uint32_t *haystack, size_t length,
+                      const uint32_t *needle, size_t needle_length)
+{
+    size_t i = 0;
+
+    if (needle_length == 0) return 0;
+    if (needle_length > length) return length;
+    if (needle_length == 1) return units32_find(haystack, length, needle[0]);
+
+#ifdef VECTOR_BYTES
+    vector_t first = VECTOR_SPLAT32(needle[0]);
+    vector_t last = VECTOR_SPLAT32(needle[needle_length - 1]);
+    uint32_t mask;
+    size_t position;
+
+    for (; i + needle_length - 1 + VECTOR_BYTES / 4 <= length; i += VECTOR_BYTES / 4) {
+        mask = VECTOR_MASK(VECTOR_AND(
+                   VECTOR_EQUAL32(VECTOR_LOAD(haystack + i), first),
+                   VECTOR_EQUAL32(VECTOR_LOAD(haystack + i + needle_length - 1), last)));
+        while (mask != 0) {
+            position = i + FIRST_BIT(mask) / 4;
+            if (memcmp(haystack + position + 1, needle + 1,
+                       (needle_length - 2) * sizeof(uint32_t)) == 0) {
+                return position;
+            }
+            // All four bits of a lane are set together
+            mask &= ~(0xfu << FIRST_BIT(mask));
+        }
+    }
+#endif
+
+    for (; i + needle_length <= length; i++) {
+        if (haystack[i] == needle[0] &&
+            memcmp(haystack + i + 1, needle + 1,
+                   (needle_length - 1) * sizeof(uint32_t)) == 0) {
+            return i;
+        }
+    }
+    return length;
+}
+
+
+
+/*
+ * Hashing
+ *
+ * Short strings get FNV-1a over their codes. Longer ones run FNV-1a
+ * in eight interleaved lanes, code I going to lane I % 8, which
+ * vectorizes; the lanes and the length are then folded with FNV-1a
+ * again. The FNV prime is 2^24 + 2^8 + 2^7 + 2^4 + 2 + 1, so the
+ * vector code multiplies with shifts and adds, which SSE2 has for
+ * 32 bit lanes.
+ */
+
+#define FNV_BASIS 2166136261u
+#define FNV_PRIME 16777619u
+
+#define HASH_LANES     8
+#define HASH_THRESHOLD 16
+
+
+#if defined(__AVX2__)
+
+static inline __m256i fnv_multiply(__m256i x)
+{
+    return _mm256_add_epi32(
+        _mm256_add_epi32(_mm256_add_epi32(x, _mm256_slli_epi32(x, 1)),
+                         _mm256_add_epi32(_mm256_slli_epi32(x, 4), _mm256_slli_epi32(x, 7))),
+        _mm256_add_epi32(_mm256_slli_epi32(x, 8), _mm256_slli_epi32(x, 24)));
+}
+
+#elif defined(__SSE2__)
+
+static inline __m128i fnv_multiply(__m128i x)
+{
+    return _mm_add_epi32(
+        _mm_add_epi32(_mm_add_epi32(x, _mm_slli_epi32(x, 1)),
+                      _mm_add_epi32(_mm_slli_epi32(x, 4), _mm_slli_epi32(x, 7))),
+        _mm_add_epi32(_mm_slli_epi32(x, 8), _mm_slli_epi32(x, 24)));
+}
+
+#endif
+
+
+static void init_lanes(uint32_t *lanes)
+{
+    unsigned int j;
+
+    for (j = 0; j < HASH_LANES; j++) {
+        lanes[j] = FNV_BASIS ^ j;
+    }
+}
+
+
+static uint32_t fold_lanes(const uint32_t *lanes, size_t length)
+{
+    uint32_t hash = FNV_BASIS;
+    unsigned int j;
+
+    for (j = 0; j < HASH_LANES; j++) {
+        hash = (hash ^ lanes[j]) * FNV_PRIME;
+    }
+    return (hash ^ (uint32_t) length) * FNV_PRIME;
+}
+
+
+uint32_t units8_hash(const uint8_t *units, size_t length)
+{
+    uint32_t lanes[HASH_LANES];
+    uint32_t hash;
+    size_t i = 0;
+
+    if (length < HASH_THRESHOLD) {
+        hash = FNV_BASIS;
+        for (i = 0; i < length; i++) {
+            hash = (hash ^ units[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    init_lanes(lanes);
+
+#if defined(__AVX2__)
+    __m256i all = _mm256_loadu_si256((const __m256i*) lanes);
+
+    for (; i + HASH_LANES <= length; i += HASH_LANES) {
+        all = fnv_multiply(_mm256_xor_si256(
+                  all, _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i*) (units + i)))));
+    }
+    _mm256_storeu_si256((__m256i*) lanes, all);
+#elif defined(__SSE2__)
+    __m128i low = _mm_loadu_si128((const __m128i*) lanes);
+    __m128i high = _mm_loadu_si128((const __m128i*) (lanes + 4));
+    __m128i zero = _mm_setzero_si128();
+    __m128i codes;
+
+    for (; i + HASH_LANES <= length; i += HASH_LANES) {
+        codes = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*) (units + i)), zero);
+        low = fnv_multiply(_mm_xor_si128(low, _mm_unpacklo_epi16(codes, zero)));
+        high = fnv_multiply(_mm_xor_si128(high, _mm_unpackhi_epi16(codes, zero)));
+    }
+    _mm_storeu_si128((__m128i*) lanes, low);
+    _mm_storeu_si128((__m128i*) (lanes + 4), high);
+#endif
+
+    for (; i < length; i++) {
+        lanes[i % HASH_LANES] = (lanes[i % HASH_LANES] ^ units[i]) * FNV_PRIME;
+    }
+
+    return fold_lanes(lanes, length);
+}
+
+
+uint32_t units32_hash(const uint32_t *units, size_t length)
+{
+    uint32_t lanes[HASH_LANES];
+    uint32_t hash;
+    size_t i = 0;
+
+    if (length < HASH_THRESHOLD) {
+        hash = FNV_BASIS;
+        for (i = 0; i < length; i++) {
+            hash = (hash ^ units[i]) * FNV_PRIME;
+        }
+        return hash;
+    }
+
+    init_lanes(lanes);
+
+#if defined(__AVX2__)
+    __m256i all = _mm256_loadu_si256((const __m256i*) lanes);
+
+    for (; i + HASH_LANES <= length; i += HASH_LANES) {
+        all = fnv_multiply(_mm256_xor_si256(
+                  all, _mm256_loadu_si256((const __m256i*) (units + i))));
+    }
+    _mm256_storeu_si256((__m256i*) lanes, all);
+#elif defined(__SSE2__)
+    __m128i low = _mm_loadu_si128((const __m128i*) lanes);
+    __m128i high = _mm_loadu_si128((const __m128i*) (lanes + 4));
+
+    for (; i + HASH_LANES <= length; i += HASH_LANES) {
+        low = fnv_multiply(_mm_xor_si128(low, _mm_loadu_si128((const __m128i*) (units + i))));
+        high = fnv_multiply(_mm_xor_si128(high, _mm_loadu_si128((const __m128i*) (units + i + 4))));
+    }
+    _mm_storeu_si128((__m128i*) lanes, low);
+    _mm_storeu_si128((__m128i*) (lanes + 4), high);
+#endif
+
+    for (; i < length; i++) {
+        lanes[i % HASH_LANES] = (lanes[i % HASH_LANES] ^ units[i]) * FNV_PRIME;
+    }
+
+    return fold_lanes(lanes, length);
+}
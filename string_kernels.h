@@ -0,0 +1,36 @@
+#pragma once
+
+#ifndef STRING_KERNELS_H_
+#define STRING_KERNELS_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+/*
+ * Loops over the code units of strings
+ *
+ * Each function exists for one byte (Latin-1) and four byte
+ * (UTF-32) units. They use SSE2 on x86-64, AVX2 when the compiler
+ * targets it (e.g. CFLAGS=-mavx2), and plain loops elsewhere.
+ * Positions are returned as indices; "not found" is the length.
+ */
+
+size_t units8_mismatch(const uint8_t*, const uint8_t*, size_t);
+size_t units32_mismatch(const uint32_t*, const uint32_t*, size_t);
+
+size_t units8_find(const uint8_t*, size_t, uint8_t);
+size_t units32_find(const uint32_t*, size_t, uint32_t);
+
+size_t units8_search(const uint8_t*, size_t, const uint8_t*, size_t);
+size_t units32_search(const uint32_t*, size_t, const uint32_t*, size_t);
+
+/*
+ * Both hash the code values, so equal strings get the same hash
+ * whatever their unit size.
+ */
+uint32_t units8_hash(const uint8_t*, size_t);
+uint32_t units32_hash(const uint32_t*, size_t);
+
+
+#endif
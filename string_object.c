@@ -0,0 +1,969 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "string_kernels.h"
+
+#include "string_object.h"
+
+
+
+void init_string(struct string *string)
+{
+    string->is_wide = false;
+    string->is_immutable = false;
+    string->depth = 0;
+    string->length = 0;
+    string->alloc = 0;
+    string->units.narrow = NULL;
+    string->left = EMPTY_LIST;
+    string->right = EMPTY_LIST;
+}
+
+
+void terminate_string(struct string *string)
+{
+    // Both members of the union are the same allocation
+    free(string->units.narrow);
+    string->units.narrow = NULL;
+    string->length = 0;
+    string->alloc = 0;
+
+    decrease_refcount(string->left);
+    decrease_refcount(string->right);
+    string->left = EMPTY_LIST;
+    string->right = EMPTY_LIST;
+}
+
+
+unsigned int string_slot_count(struct string *string)
+{
+    return (string->left != EMPTY_LIST) ? 2 : 0;
+}
+
+
+objptr_t string_slot_accessor(struct string *string, unsigned int slot)
+{
+    switch (slot) {
+    case 0: return string->left;
+    case 1: return string->right;
+    default: return EMPTY_LIST;
+    }
+}
+
+
+static bool flatten(struct string*);
+
+
+static unichar_t string_unit(struct string *string, unsigned int index)
+{
+    return string->is_wide ? string->units.wide[index] : string->units.narrow[index];
+}
+
+
+/*
+ * Returns the index of the first differing unit, or the shorter
+ * length.
+ */
+static unsigned int units_mismatch(struct string *s1, struct string *s2)
+{
+    unsigned int i, length;
+
+    length = (s1->length < s2->length) ? s1->length : s2->length;
+
+    if (!s1->is_wide && !s2->is_wide) {
+        return units8_mismatch(s1->units.narrow, s2->units.narrow, length);
+    } else if (s1->is_wide && s2->is_wide) {
+        return units32_mismatch(s1->units.wide, s2->units.wide, length);
+    }
+
+    for (i = 0; i < length; i++) {
+        if (string_unit(s1, i) != string_unit(s2, i)) break;
+    }
+    return i;
+}
+
+
+static bool units_equal(struct string *s1, struct string *s2)
+{
+    if (s1->length != s2->length) return false;
+
+    if (!flatten(s1) || !flatten(s2)) return false;  // TODO: Error?
+    return units_mismatch(s1, s2) == s1->length;
+}
+
+
+bool string_eqv(struct string *s1,
+                struct string *s2,
+                enum eqv_strictness strictness)
+{
+    switch (strictness) {
+    case EQV_STRICT: return s1 == s2;
+    case EQ_STRICT:
+        return (s1 == s2) || (s1->length == 0 && s2->length == 0);
+    case EQUAL_STRICT:
+        return (s1 == s2) || units_equal(s1, s2);
+    default: return false;
+    }
+}
+
+
+DEFTYPE(TYPE_STRING,
+        struct string,
+        init_string,
+        terminate_string,
+        string_slot_count,
+        string_slot_accessor,
+        string_eqv);
+
+
+
+/*
+ * Makes room for ALLOC code units of the current width. Returns
+ * false if there is no memory, the string is left alone then.
+ */
+static bool string_reserve(struct string *string, unsigned int alloc)
+{
+    unsigned char *units;
+
+    if (alloc <= string->alloc) return true;
+
+    if (alloc < 2 * string->alloc) alloc = 2 * string->alloc;
+    if (alloc < 16) alloc = 16;
+
+    units = realloc(string->units.narrow,
+                    alloc * (string->is_wide ? sizeof(unichar_t) : 1));
+    if (units == NULL) return false;
+
+    string->units.narrow = units;
+    string->alloc = alloc;
+    return true;
+}
+
+
+/*
+ * Switches to four byte code units, before storing a character
+ * beyond Latin-1. Returns false if there is no memory.
+ */
+static bool string_widen(struct string *string)
+{
+    unichar_t *wide;
+    unsigned int i;
+
+    wide = malloc((string->alloc > 0 ? string->alloc : 1) * sizeof(unichar_t));
+    if (wide == NULL) return false;
+
+    for (i = 0; i < string->length; i++) {
+        wide[i] = string->units.narrow[i];
+    }
+
+    free(string->units.narrow);
+    string->units.wide = wide;
+    string->is_wide = true;
+    return true;
+}
+
+
+// Frees a new string which couldn't be filled
+static objptr_t drop_string(objptr_t ptr)
+{
+    increase_refcount(ptr);
+    decrease_refcount(ptr);
+    return EMPTY_LIST;
+}
+
+
+/*
+ * Copies COUNT units of the flat string FROM, starting at START,
+ * to position POSITION of TO, which must have room for them. TO
+ * may only be narrow if the units fit.
+ */
+static void copy_units(struct string *to, unsigned int position,
+                       struct string *from, unsigned int start, unsigned int count)
+{
+    unsigned int i;
+
+    if (to->is_wide == from->is_wide) {
+        memcpy(to->units.narrow + position * (to->is_wide ? sizeof(unichar_t) : 1),
+               from->units.narrow + start * (from->is_wide ? sizeof(unichar_t) : 1),
+               count * (to->is_wide ? sizeof(unichar_t) : 1));
+    } else if (to->is_wide) {
+        for (i = 0; i < count; i++) {
+            to->units.wide[position + i] = from->units.narrow[start + i];
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            to->units.narrow[position + i] = (unsigned char) from->units.wide[start + i];
+        }
+    }
+}
+
+
+static bool units_fit_narrow(struct string *string, unsigned int start, unsigned int count)
+{
+    unsigned int i;
+
+    if (!string->is_wide) return true;
+
+    for (i = 0; i < count; i++) {
+        if (string->units.wide[start + i] > 0xff) return false;
+    }
+    return true;
+}
+
+
+static struct string *allocate_string(objptr_t *ptr, unsigned int alloc)
+{
+    struct string *string;
+
+    *ptr = object_allocate(&TYPE_STRING);
+    if (*ptr == EMPTY_LIST) return NULL;
+
+    string = (struct string*) dereference(*ptr);
+    if (!string_reserve(string, alloc)) {
+        *ptr = drop_string(*ptr);
+        return NULL;
+    }
+    return string;
+}
+
+
+/*
+ * Returns the string with its units, flattening it if it is a
+ * rope, or NULL for other objects and if there is no memory.
+ */
+static struct string *flat_string(objptr_t ptr)
+{
+    struct string *string;
+
+    if (!is_of_type(ptr, &TYPE_STRING)) return NULL;
+
+    string = (struct string*) dereference(ptr);
+    return flatten(string) ? string : NULL;
+}
+
+
+objptr_t make_string(unichar_t fill, unsigned int length)
+{
+    objptr_t ptr;
+    struct string *string;
+    unsigned int i;
+
+    string = allocate_string(&ptr, length);
+    if (string == NULL) return ptr;
+
+    if (fill > 0xff) {
+        if (!string_widen(string)) return drop_string(ptr);
+        for (i = 0; i < length; i++) string->units.wide[i] = fill;
+    } else if (length > 0) {
+        memset(string->units.narrow, (int) fill, length);
+    }
+    string->length = length;
+
+    return ptr;
+}
+
+
+objptr_t make_string_from_latin1(const char *characters, unsigned int length)
+{
+    objptr_t ptr;
+    struct string *string;
+
+    string = allocate_string(&ptr, length);
+    if (string == NULL) return ptr;
+
+    if (length > 0) memcpy(string->units.narrow, characters, length);
+    string->length = length;
+
+    return ptr;
+}
+
+
+objptr_t make_string_from_c_string(const char *str)
+{
+    return make_string_from_latin1(str, strlen(str));
+}
+
+
+objptr_t make_string_from_codes(const unichar_t *codes, unsigned int length)
+{
+    objptr_t ptr;
+    struct string *string;
+    unsigned int i;
+
+    string = allocate_string(&ptr, length);
+    if (string == NULL) return ptr;
+
+    for (i = 0; i < length; i++) {
+        if (codes[i] > 0xff) {
+            if (!string_widen(string)) return drop_string(ptr);
+            memcpy(string->units.wide, codes, length * sizeof(unichar_t));
+            break;
+        }
+        string->units.narrow[i] = (unsigned char) codes[i];
+    }
+    string->length = length;
+
+    return ptr;
+}
+
+
+objptr_t string_copy(objptr_t ptr)
+{
+    return substring(ptr, 0, string_length(ptr));
+}
+
+
+objptr_t substring(objptr_t ptr, unsigned int start, unsigned int end)
+{
+    objptr_t copy;
+
+    if (!is_of_type(ptr, &TYPE_STRING)) return EMPTY_LIST;
+
+    copy = make_string('\0', 0);
+    if (!string_append_substring(copy, ptr, start, end)) return drop_string(copy);
+    return copy;
+}
+
+
+unsigned int string_length(objptr_t ptr)
+{
+    if (is_of_type(ptr, &TYPE_STRING)) {
+        return ((struct string*) dereference(ptr))->length;
+    } else {
+        return 0;
+    }
+}
+
+
+unichar_t string_ref(objptr_t ptr, unsigned int index)
+{
+    struct string *string;
+
+    string = flat_string(ptr);
+    if (string != NULL && index < string->length) {
+        return string_unit(string, index);
+    }
+    return 0;  // TODO: Error?
+}
+
+
+/*
+ * Stores the character, extending the string with NULs if the
+ * index is past its end. Returns false if there is no memory.
+ */
+bool string_set(objptr_t ptr, unsigned int index, unichar_t code)
+{
+    struct string *string;
+    unsigned int i;
+
+    if (!is_of_type(ptr, &TYPE_STRING)) return true;  // TODO: Error?
+
+    string = flat_string(ptr);
+    if (string == NULL) return false;
+    if (string->is_immutable) return true;  // TODO: Error?
+
+    if (!string_reserve(string, index + 1)) return false;
+    if (code > 0xff && !string->is_wide && !string_widen(string)) return false;
+
+    for (i = string->length; i < index; i++) {
+        if (string->is_wide) {
+            string->units.wide[i] = 0;
+        } else {
+            string->units.narrow[i] = 0;
+        }
+    }
+
+    if (string->is_wide) {
+        string->units.wide[index] = code;
+    } else {
+        string->units.narrow[index] = (unsigned char) code;
+    }
+
+    if (index >= string->length) string->length = index + 1;
+    return true;
+}
+
+
+bool string_append(objptr_t ptr, unichar_t code)
+{
+    return string_set(ptr, string_length(ptr), code);
+}
+
+
+/*
+ * Appends the characters from START up to END of SOURCE. Returns
+ * false if there is no memory.
+ */
+bool string_append_substring(objptr_t ptr, objptr_t source_ptr,
+                             unsigned int start, unsigned int end)
+{
+    struct string *string, *source;
+
+    if (!is_of_type(ptr, &TYPE_STRING) || !is_of_type(source_ptr, &TYPE_STRING)) {
+        return true;  // TODO: Error?
+    }
+
+    string = flat_string(ptr);
+    source = flat_string(source_ptr);
+    if (string == NULL || source == NULL) return false;
+    if (string->is_immutable) return true;  // TODO: Error?
+
+    if (end > source->length) end = source->length;
+    if (start >= end) return true;
+
+    if (!string_reserve(string, string->length + (end - start))) return false;
+    if (!string->is_wide && !units_fit_narrow(source, start, end - start)
+        && !string_widen(string)) {
+        return false;
+    }
+
+    copy_units(string, string->length, source, start, end - start);
+    string->length += end - start;
+    return true;
+}
+
+
+
+/*
+ * Ropes
+ *
+ * string_concatenate() copies short results, but joins longer ones
+ * in a rope node which only refers to both parts. A rope gets its
+ * own units when they are needed the first time, and drops the
+ * parts then. The parts of a rope never change: mutable strings
+ * are copied before they become one.
+ *
+ * Appending to a rope descends its right edge as long as that stays
+ * no longer than the left part, and prepending descends the left
+ * edge likewise, so repeated appends build a balanced tree instead
+ * of a list. Ropes deeper than
+ * ROPE_MAX_DEPTH are flattened right away, since the collector and
+ * the refcounting walk them recursively.
+ */
+
+#define ROPE_MIN_LENGTH 256
+#define ROPE_MAX_DEPTH  48
+
+
+/*
+ * Copies the leaves of a rope into its own units and drops its
+ * parts. Returns false if there is no memory, the rope stays a rope
+ * then.
+ */
+static bool flatten(struct string *rope)
+{
+    objptr_t *stack;
+    objptr_t left, right;
+    unsigned int size, position;
+    struct string *piece;
+
+    if (rope->left == EMPTY_LIST) return true;
+
+    /*
+     * Copy the leaves from left to right. Every step replaces a
+     * node by its two parts, so the stack never holds more than
+     * the depth plus one entries.
+     */
+    rope->units.narrow = malloc(rope->length * (rope->is_wide ? sizeof(unichar_t) : 1));
+    stack = malloc((rope->depth + 1) * sizeof(objptr_t));
+    if (rope->units.narrow == NULL || stack == NULL) {
+        free(rope->units.narrow);
+        rope->units.narrow = NULL;
+        free(stack);
+        return false;
+    }
+    rope->alloc = rope->length;
+
+    stack[0] = rope->right;
+    stack[1] = rope->left;
+    size = 2;
+    position = 0;
+
+    while (size > 0) {
+        piece = (struct string*) dereference(stack[--size]);
+        if (piece->left != EMPTY_LIST) {
+            stack[size++] = piece->right;
+            stack[size++] = piece->left;
+        } else {
+            copy_units(rope, position, piece, 0, piece->length);
+            position += piece->length;
+        }
+    }
+
+    free(stack);
+
+    left = rope->left;
+    right = rope->right;
+    rope->left = EMPTY_LIST;
+    rope->right = EMPTY_LIST;
+    decrease_refcount(left);
+    decrease_refcount(right);
+    return true;
+}
+
+
+static objptr_t immutable_part(objptr_t ptr)
+{
+    if (!((struct string*) dereference(ptr))->is_immutable) {
+        ptr = string_copy(ptr);
+        ((struct string*) dereference(ptr))->is_immutable = true;
+    }
+    return ptr;
+}
+
+
+static objptr_t make_rope(objptr_t left_ptr, objptr_t right_ptr)
+{
+    objptr_t ptr;
+    struct string *rope, *left, *right;
+
+    left_ptr = immutable_part(left_ptr);
+    right_ptr = immutable_part(right_ptr);
+    left = (struct string*) dereference(left_ptr);
+    right = (struct string*) dereference(right_ptr);
+
+    ptr = object_allocate(&TYPE_STRING);
+    if (ptr == EMPTY_LIST) return ptr;
+    rope = (struct string*) dereference(ptr);
+
+    rope->is_wide = left->is_wide || right->is_wide;
+    rope->is_immutable = true;
+    rope->depth = 1 + ((left->depth > right->depth) ? left->depth : right->depth);
+    rope->length = left->length + right->length;
+    rope->left = left_ptr;
+    rope->right = right_ptr;
+    increase_refcount(left_ptr);
+    increase_refcount(right_ptr);
+
+    // Without memory to flatten it, the rope just gets deeper
+    if (rope->depth > ROPE_MAX_DEPTH) flatten(rope);
+
+    return ptr;
+}
+
+
+objptr_t string_concatenate(objptr_t first_ptr, objptr_t second_ptr)
+{
+    objptr_t result;
+    struct string *first, *second;
+
+    if (!is_of_type(first_ptr, &TYPE_STRING) || !is_of_type(second_ptr, &TYPE_STRING)) {
+        return EMPTY_LIST;  // TODO: Error?
+    }
+
+    first = (struct string*) dereference(first_ptr);
+    second = (struct string*) dereference(second_ptr);
+
+    if (first->length + second->length < ROPE_MIN_LENGTH) {
+        result = make_string('\0', 0);
+        if (!string_append_substring(result, first_ptr, 0, first->length)
+            || !string_append_substring(result, second_ptr, 0, second->length)) {
+            return drop_string(result);
+        }
+        return result;
+    }
+
+    if (first->left != EMPTY_LIST
+        && string_length(first->right) + second->length <= string_length(first->left)) {
+        return make_rope(first->left, string_concatenate(first->right, second_ptr));
+    }
+
+    if (second->left != EMPTY_LIST
+        && first->length + string_length(second->left) <= string_length(second->right)) {
+        return make_rope(string_concatenate(first_ptr, second->left), second->right);
+    }
+
+    return make_rope(first_ptr, second_ptr);
+}
+
+
+
+bool string_equal(objptr_t p1, objptr_t p2)
+{
+    return is_of_type(p1, &TYPE_STRING) && is_of_type(p2, &TYPE_STRING)
+        && units_equal((struct string*) dereference(p1),
+                       (struct string*) dereference(p2));
+}
+
+
+/*
+ * Compares the string to LENGTH Latin-1 characters.
+ */
+bool string_equal_latin1(objptr_t ptr, const char *characters, unsigned int length)
+{
+    struct string *string;
+    unsigned int i;
+
+    string = flat_string(ptr);
+    if (string == NULL || string->length != length) return false;
+
+    if (!string->is_wide) {
+        return units8_mismatch(string->units.narrow,
+                               (const uint8_t*) characters, length) == length;
+    }
+
+    for (i = 0; i < length; i++) {
+        if (string->units.wide[i] != (unsigned char) characters[i]) return false;
+    }
+    return true;
+}
+
+
+/*
+ * Returns a negative number, zero or a positive number as the
+ * first string sorts before, equal to or after the second one,
+ * comparing character codes.
+ */
+int string_compare(objptr_t p1, objptr_t p2)
+{
+    struct string *s1, *s2;
+    unsigned int i;
+    unichar_t c1, c2;
+
+    s1 = flat_string(p1);
+    s2 = flat_string(p2);
+    if (s1 == NULL || s2 == NULL) return 0;  // TODO: Error?
+
+    i = units_mismatch(s1, s2);
+    if (i < s1->length && i < s2->length) {
+        c1 = string_unit(s1, i);
+        c2 = string_unit(s2, i);
+        return (c1 < c2) ? -1 : 1;
+    } else {
+        return (s1->length < s2->length) ? -1 : (s1->length > s2->length);
+    }
+}
+
+
+/*
+ * Returns the first index from START on where the character
+ * occurs, or -1.
+ */
+long string_find(objptr_t ptr, unichar_t code, unsigned int start)
+{
+    struct string *string;
+    size_t index;
+
+    string = flat_string(ptr);
+    if (string == NULL || start >= string->length) return -1;
+
+    if (string->is_wide) {
+        index = units32_find(string->units.wide + start,
+                             string->length - start, code);
+    } else if (code <= 0xff) {
+        index = units8_find(string->units.narrow + start,
+                            string->length - start, (uint8_t) code);
+    } else {
+        return -1;
+    }
+
+    return (start + index < string->length) ? (long) (start + index) : -1;
+}
+
+
+/*
+ * Returns the first index from START on where NEEDLE occurs in
+ * HAYSTACK, or -1.
+ */
+long string_search(objptr_t haystack_ptr, objptr_t needle_ptr, unsigned int start)
+{
+    struct string *haystack, *needle;
+    unsigned int i, j, length;
+    size_t index;
+
+    haystack = flat_string(haystack_ptr);
+    needle = flat_string(needle_ptr);
+    if (haystack == NULL || needle == NULL) return -1;
+
+    if (start > haystack->length) return -1;
+    length = haystack->length - start;
+
+    if (!haystack->is_wide && !needle->is_wide) {
+        index = units8_search(haystack->units.narrow + start, length,
+                              needle->units.narrow, needle->length);
+    } else if (haystack->is_wide && needle->is_wide) {
+        index = units32_search(haystack->units.wide + start, length,
+                               needle->units.wide, needle->length);
+    } else {
+        // Mixed widths are rare enough for the slow way
+        for (index = 0; index + needle->length <= length; index++) {
+            for (j = 0; j < needle->length; j++) {
+                i = start + index + j;
+                if (string_unit(haystack, i) != string_unit(needle, j)) break;
+            }
+            if (j == needle->length) break;
+        }
+    }
+
+    if (needle->length <= length && index + needle->length <= length) {
+        return (long) (start + index);
+    } else {
+        return -1;
+    }
+}
+
+
+unsigned int string_hash(objptr_t ptr)
+{
+    struct string *string;
+
+    string = flat_string(ptr);
+    if (string == NULL) {
+        return units8_hash(NULL, 0);
+    } else if (string->is_wide) {
+        return units32_hash(string->units.wide, string->length);
+    } else {
+        return units8_hash(string->units.narrow, string->length);
+    }
+}
+
+
+/*
+ * Encodes the character as UTF-8 and returns the number of bytes.
+ * Surrogates and codes beyond Unicode become U+FFFD.
+ */
+static unsigned int encode_utf8(unichar_t code, unsigned char *bytes)
+{
+    if (code > 0x10ffff || (code >= 0xd800 && code < 0xe000)) code = 0xfffd;
+
+    if (code < 0x80) {
+        bytes[0] = (unsigned char) code;
+        return 1;
+    } else if (code < 0x800) {
+        bytes[0] = (unsigned char) (0xc0 | (code >> 6));
+        bytes[1] = (unsigned char) (0x80 | (code & 0x3f));
+        return 2;
+    } else if (code < 0x10000) {
+        bytes[0] = (unsigned char) (0xe0 | (code >> 12));
+        bytes[1] = (unsigned char) (0x80 | ((code >> 6) & 0x3f));
+        bytes[2] = (unsigned char) (0x80 | (code & 0x3f));
+        return 3;
+    } else {
+        bytes[0] = (unsigned char) (0xf0 | (code >> 18));
+        bytes[1] = (unsigned char) (0x80 | ((code >> 12) & 0x3f));
+        bytes[2] = (unsigned char) (0x80 | ((code >> 6) & 0x3f));
+        bytes[3] = (unsigned char) (0x80 | (code & 0x3f));
+        return 4;
+    }
+}
+
+
+/*
+ * Returns a malloc()ed, NUL-terminated copy of the string, encoded
+ * like string_print() does, or NULL when out of memory.
+ */
+char *string_to_c_string(objptr_t ptr)
+{
+    struct string *string;
+    unsigned char bytes[4];
+    unsigned int i, length;
+    size_t size;
+    char *result;
+
+    string = flat_string(ptr);
+    length = (string == NULL) ? 0 : string->length;
+
+    size = 0;
+    for (i = 0; i < length; i++) {
+        size += encode_utf8(string_unit(string, i), bytes);
+    }
+
+    result = malloc(size + 1);
+    if (result == NULL) return NULL;
+
+    size = 0;
+    for (i = 0; i < length; i++) {
+        size += encode_utf8(string_unit(string, i), (unsigned char*) result + size);
+    }
+    result[size] = '\0';
+
+    return result;
+}
+
+
+/*
+ * Returns the string's units, four bytes each if IS_WIDE is set and
+ * one byte each otherwise. They stay valid until the string changes.
+ */
+const void *string_units(objptr_t ptr, bool *is_wide)
+{
+    struct string *string;
+
+    string = flat_string(ptr);
+    if (string == NULL) {
+        *is_wide = false;
+        return NULL;
+    }
+
+    *is_wide = string->is_wide;
+    return string->is_wide ? (const void*) string->units.wide : (const void*) string->units.narrow;
+}
+
+
+/*
+ * Writes narrow strings one byte per character, like putchar(), and
+ * wide ones as UTF-8.
+ */
+void string_print(objptr_t ptr, FILE *f)
+{
+    struct string *string;
+    unsigned char bytes[4];
+    unsigned int i, start;
+
+    string = flat_string(ptr);
+    if (string == NULL || string->length == 0) return;
+
+    if (!string->is_wide) {
+        // Runs of ASCII are written as they are, Latin-1 is encoded
+        start = 0;
+        for (i = 0; i < string->length; i++) {
+            if (string->units.narrow[i] >= 0x80) {
+                fwrite(string->units.narrow + start, 1, i - start, f);
+                fwrite(bytes, 1, encode_utf8(string->units.narrow[i], bytes), f);
+                start = i + 1;
+            }
+        }
+        fwrite(string->units.narrow + start, 1, i - start, f);
+    } else {
+        for (i = 0; i < string->length; i++) {
+            fwrite(bytes, 1, encode_utf8(string->units.wide[i], bytes), f);
+        }
+    }
+}
+
+
+
+/*
+ * String builders
+ *
+ * A builder collects characters in a string of its own, which grows
+ * geometrically. Taking the result hands that string over without
+ * copying it and leaves the builder empty.
+ *
+ * The builder doesn't count its reference to the string, so that
+ * the string can be handed over like a fresh object. Nothing else
+ * sees the string before that, and the collector finds it through
+ * the builder's slot.
+ */
+
+
+void init_string_builder(struct string_builder *builder)
+{
+    builder->string = EMPTY_LIST;
+}
+
+
+void terminate_string_builder(struct string_builder *builder)
+{
+    builder->string = EMPTY_LIST;
+}
+
+
+unsigned int string_builder_slot_count(struct string_builder *builder)
+{
+    return 1;
+}
+
+
+objptr_t string_builder_slot_accessor(struct string_builder *builder, unsigned int slot)
+{
+    return (slot == 0) ? builder->string : EMPTY_LIST;
+}
+
+
+bool string_builder_eqv(struct string_builder *b1,
+                        struct string_builder *b2,
+                        enum eqv_strictness strictness)
+{
+    return b1 == b2;
+}
+
+
+DEFTYPE(TYPE_STRING_BUILDER,
+        struct string_builder,
+        init_string_builder,
+        terminate_string_builder,
+        string_builder_slot_count,
+        string_builder_slot_accessor,
+        string_builder_eqv);
+
+
+
+objptr_t make_string_builder()
+{
+    return object_allocate(&TYPE_STRING_BUILDER);
+}
+
+
+static objptr_t builder_string(objptr_t ptr)
+{
+    struct string_builder *builder;
+
+    if (!is_of_type(ptr, &TYPE_STRING_BUILDER)) return EMPTY_LIST;
+
+    builder = (struct string_builder*) dereference(ptr);
+    if (builder->string == EMPTY_LIST) {
+        builder->string = make_string('\0', 0);
+    }
+    return builder->string;
+}
+
+
+/*
+ * The appending functions return false if there is no memory or PTR
+ * isn't a string builder.
+ */
+bool string_builder_append(objptr_t ptr, unichar_t code)
+{
+    objptr_t string;
+
+    string = builder_string(ptr);
+    return string != EMPTY_LIST && string_append(string, code);
+}
+
+
+bool string_builder_append_substring(objptr_t ptr, objptr_t source,
+                                     unsigned int start, unsigned int end)
+{
+    objptr_t string;
+
+    string = builder_string(ptr);
+    return string != EMPTY_LIST && string_append_substring(string, source, start, end);
+}
+
+
+unsigned int string_builder_length(objptr_t ptr)
+{
+    if (!is_of_type(ptr, &TYPE_STRING_BUILDER)) return 0;
+
+    return string_length(((struct string_builder*) dereference(ptr))->string);
+}
+
+
+/*
+ * Returns the collected characters as an immutable string.
+ */
+objptr_t string_builder_finish(objptr_t ptr)
+{
+    objptr_t result;
+
+    result = builder_string(ptr);
+    if (result == EMPTY_LIST) return result;
+
+    ((struct string_builder*) dereference(ptr))->string = EMPTY_LIST;
+    ((struct string*) dereference(result))->is_immutable = true;
+    return result;
+}
+
+
+
+void init_strings()
+{
+}
+
+
+void terminate_strings()
+{
+    free_type_instances(&TYPE_STRING_BUILDER);
+    free_type_instances(&TYPE_STRING);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#ifndef STRING_OBJECT_H_
+#define STRING_OBJECT_H_
+
+#include <stdio.h>
+
+#include "character.h"
+#include "object.h"
+
+
+/*
+ * Strings hold their characters as code units instead of character
+ * objects: one byte per character as long as all of them are below
+ * 256 (Latin-1), four bytes (UTF-32) once a wider one is stored.
+ * The length is kept, so strings may contain NUL characters.
+ *
+ * A rope is a string made by string_concatenate() which has no
+ * units yet, only its two parts, see string_object.c.
+ */
+struct string {
+    struct object head;
+    bool is_wide;
+    bool is_immutable;
+    unsigned char depth;
+    unsigned int length;
+    unsigned int alloc;
+    union {
+        unsigned char *narrow;
+        unichar_t *wide;
+    } units;
+    objptr_t left;
+    objptr_t right;
+};
+
+
+struct string_builder {
+    struct object head;
+    objptr_t string;
+};
+
+
+extern struct object_type TYPE_STRING;
+extern struct object_type TYPE_STRING_BUILDER;
+
+
+objptr_t make_string(unichar_t, unsigned int);
+objptr_t make_string_from_c_string(const char*);
+objptr_t make_string_from_latin1(const char*, unsigned int);
+objptr_t make_string_from_codes(const unichar_t*, unsigned int);
+objptr_t string_copy(objptr_t);
+objptr_t substring(objptr_t, unsigned int, unsigned int);
+objptr_t string_concatenate(objptr_t, objptr_t);
+
+unsigned int string_length(objptr_t);
+unichar_t string_ref(objptr_t, unsigned int);
+bool string_set(objptr_t, unsigned int, unichar_t);
+bool string_append(objptr_t, unichar_t);
+bool string_append_substring(objptr_t, objptr_t, unsigned int, unsigned int);
+
+bool string_equal(objptr_t, objptr_t);
+bool string_equal_latin1(objptr_t, const char*, unsigned int);
+int string_compare(objptr_t, objptr_t);
+long string_find(objptr_t, unichar_t, unsigned int);
+long string_search(objptr_t, objptr_t, unsigned int);
+unsigned int string_hash(objptr_t);
+char *string_to_c_string(objptr_t);
+const void *string_units(objptr_t, bool*);
+void string_print(objptr_t, FILE*);
+
+objptr_t make_string_builder();
+bool string_builder_append(objptr_t, unichar_t);
+bool string_builder_append_substring(objptr_t, objptr_t, unsigned int, unsigned int);
+unsigned int string_builder_length(objptr_t);
+objptr_t string_builder_finish(objptr_t);
+
+void init_strings();
+void terminate_strings();
+
+
+#endif
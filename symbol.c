@@ -1,7 +1,8 @@
 #include <stdlib.h>
 
 
-#include "vector.h"
+#include "bytecode.h"
+#include "string_object.h"
 
 #include "symbol.h"
 
@@ -10,11 +11,22 @@
 
 static struct symbol *SYMBOL_TABLE;
 
+/*
+ * Interned symbols are also kept in a hash table, so that
+ * string_to_symbol() doesn't have to scan SYMBOL_TABLE.
+ */
+static struct symbol **SYMBOL_BUCKETS;
+static unsigned int SYMBOL_BUCKET_COUNT;
+static unsigned int SYMBOL_BUCKET_MEMBERS;
+
 
 objptr_t SYMBOL_DEFINE;
 objptr_t SYMBOL_QUOTE;
 objptr_t SYMBOL_LAMBDA;
 objptr_t SYMBOL_LET;
+objptr_t SYMBOL_LETSTAR;
+objptr_t SYMBOL_LETREC;
+objptr_t SYMBOL_DO;
 objptr_t SYMBOL_SETBANG;
 objptr_t SYMBOL_IF;
 objptr_t SYMBOL_BEGIN;
@@ -28,6 +40,9 @@ void init_symbol(struct symbol *symbol)
      */
     symbol->is_gensym = false;
     symbol->name_string = EMPTY_LIST;
+    symbol->hash = 0;
+    symbol->bucket_next = NULL;
+    symbol->inline_opcode = INSTR_HALT;
 
     /*
      * Insert the symbol into the symbol table.
@@ -47,6 +62,82 @@ void init_symbol(struct symbol *symbol)
 }
 
 
+/*
+ * Adds a symbol to the hash buckets. If they can't grow, the old
+ * buckets get fuller. Returns false if there are none at all.
+ */
+static bool symbol_buckets_insert(struct symbol *symbol)
+{
+    struct symbol **buckets;
+    struct symbol *member;
+    unsigned int count;
+    unsigned int i;
+
+    if (SYMBOL_BUCKET_MEMBERS >= SYMBOL_BUCKET_COUNT) {
+	/*
+	 * Double the number of buckets and redistribute
+	 */
+	count = (SYMBOL_BUCKET_COUNT == 0) ? 256 : SYMBOL_BUCKET_COUNT * 2;
+	buckets = calloc(count, sizeof(struct symbol*));
+
+	if (buckets != NULL) {
+	    for (i = 0; i < SYMBOL_BUCKET_COUNT; i++)
+	    {
+		while (SYMBOL_BUCKETS[i] != NULL)
+		{
+		    member = SYMBOL_BUCKETS[i];
+		    SYMBOL_BUCKETS[i] = member->bucket_next;
+		    member->bucket_next = buckets[member->hash & (count - 1)];
+		    buckets[member->hash & (count - 1)] = member;
+		}
+	    }
+	    free(SYMBOL_BUCKETS);
+	    SYMBOL_BUCKETS = buckets;
+	    SYMBOL_BUCKET_COUNT = count;
+	} else if (SYMBOL_BUCKETS == NULL) {
+	    return false;
+	}
+    }
+
+    symbol->bucket_next = SYMBOL_BUCKETS[symbol->hash & (SYMBOL_BUCKET_COUNT - 1)];
+    SYMBOL_BUCKETS[symbol->hash & (SYMBOL_BUCKET_COUNT - 1)] = symbol;
+    SYMBOL_BUCKET_MEMBERS++;
+    return true;
+}
+
+
+/*
+ * Frees a new symbol which couldn't be added to the buckets
+ */
+static objptr_t drop_symbol(objptr_t ptr)
+{
+    increase_refcount(ptr);
+    decrease_refcount(ptr);
+    return EMPTY_LIST;
+}
+
+
+static void symbol_buckets_remove(struct symbol *symbol)
+{
+    struct symbol **link;
+
+    if (SYMBOL_BUCKETS == NULL) {
+	return;
+    }
+
+    for (link = &(SYMBOL_BUCKETS[symbol->hash & (SYMBOL_BUCKET_COUNT - 1)]);
+	 *link != NULL;
+	 link = &((*link)->bucket_next))
+    {
+	if (*link == symbol) {
+	    *link = symbol->bucket_next;
+	    SYMBOL_BUCKET_MEMBERS--;
+	    return;
+	}
+    }
+}
+
+
 void terminate_symbol(struct symbol *symbol)
 {
     /*
@@ -73,6 +164,10 @@ void terminate_symbol(struct symbol *symbol)
     }
     
 
+    if (!symbol->is_gensym) {
+	symbol_buckets_remove(symbol);
+    }
+
     /*
      * Delete the references
      */
@@ -124,15 +219,20 @@ objptr_t string_to_symbol(objptr_t name)
 {
     objptr_t ptr;
     struct symbol *symbol;
+    unsigned int hash;
 
-    if (SYMBOL_TABLE != NULL) {
-	symbol = SYMBOL_TABLE;
-	do {
-	    if (eqv(name, symbol->name_string, EQUAL_STRICT)) {
+    hash = string_hash(name);
+
+    if (SYMBOL_BUCKETS != NULL) {
+	for (symbol = SYMBOL_BUCKETS[hash & (SYMBOL_BUCKET_COUNT - 1)];
+	     symbol != NULL;
+	     symbol = symbol->bucket_next)
+	{
+	    if (symbol->hash == hash
+		&& string_equal(name, symbol->name_string)) {
 		return symbol->self;
 	    }
-	    symbol = symbol->symbol_table_next;
-	} while(symbol != SYMBOL_TABLE);
+	}
     }
 
     ptr = object_allocate(&TYPE_SYMBOL);
@@ -140,13 +240,72 @@ objptr_t string_to_symbol(objptr_t name)
     symbol = (struct symbol*) dereference(ptr);
     
     symbol->self = ptr;
-    symbol->name_string = vector_copy(name);
+    symbol->name_string = string_copy(name);
     increase_refcount(symbol->name_string);
+    symbol->hash = hash;
+    if (!symbol_buckets_insert(symbol)) return drop_symbol(ptr);
     
     return ptr;
 }
 
 
+/*
+ * Like string_to_symbol() for LENGTH Latin-1 characters whose
+ * string_hash() is HASH. Only new symbols make a string.
+ */
+objptr_t latin1_to_symbol(const char *name, unsigned int length, unsigned int hash)
+{
+    objptr_t ptr;
+    struct symbol *symbol;
+
+    if (SYMBOL_BUCKETS != NULL) {
+	for (symbol = SYMBOL_BUCKETS[hash & (SYMBOL_BUCKET_COUNT - 1)];
+	     symbol != NULL;
+	     symbol = symbol->bucket_next)
+	{
+	    if (symbol->hash == hash
+		&& string_equal_latin1(symbol->name_string, name, length)) {
+		return symbol->self;
+	    }
+	}
+    }
+
+    ptr = object_allocate(&TYPE_SYMBOL);
+    if (ptr == EMPTY_LIST) return ptr;
+    symbol = (struct symbol*) dereference(ptr);
+
+    symbol->self = ptr;
+    symbol->name_string = make_string_from_latin1(name, length);
+    increase_refcount(symbol->name_string);
+    symbol->hash = hash;
+    if (!symbol_buckets_insert(symbol)) return drop_symbol(ptr);
+
+    return ptr;
+}
+
+
+objptr_t gensym(objptr_t ptr)
+{
+    objptr_t gensym;
+    struct symbol *symbol;
+
+    /*
+     * Gensyms carry the name of the symbol they were made from,
+     * but are never returned by string_to_symbol().
+     */
+    gensym = object_allocate(&TYPE_SYMBOL);
+    if (gensym == EMPTY_LIST) return gensym;
+    symbol = (struct symbol*) dereference(gensym);
+
+    symbol->self = gensym;
+    symbol->is_gensym = true;
+    symbol->name_string = string_copy(symbol_to_string(ptr));
+    increase_refcount(symbol->name_string);
+
+    return gensym;
+}
+
+
 objptr_t symbol_to_string(objptr_t ptr)
 {
     struct symbol *symbol;
@@ -173,12 +332,18 @@ void init_global_symbol(objptr_t *slot, const char *name)
 void init_symbols()
 {
     SYMBOL_TABLE = NULL;
+    SYMBOL_BUCKETS = NULL;
+    SYMBOL_BUCKET_COUNT = 0;
+    SYMBOL_BUCKET_MEMBERS = 0;
 
     // Init symbols
     init_global_symbol(&SYMBOL_DEFINE, "define");
     init_global_symbol(&SYMBOL_QUOTE, "quote");
     init_global_symbol(&SYMBOL_LAMBDA, "lambda");
     init_global_symbol(&SYMBOL_LET, "let");
+    init_global_symbol(&SYMBOL_LETSTAR, "let*");
+    init_global_symbol(&SYMBOL_LETREC, "letrec");
+    init_global_symbol(&SYMBOL_DO, "do");
     init_global_symbol(&SYMBOL_SETBANG, "set!");
     init_global_symbol(&SYMBOL_IF, "if");
     init_global_symbol(&SYMBOL_BEGIN, "begin");
@@ -191,5 +356,9 @@ void terminate_symbols()
     // The memory manager will free the instances automatically,
     // therefore we can simply clear the pool handle
     SYMBOL_TABLE = NULL;
+    free(SYMBOL_BUCKETS);
+    SYMBOL_BUCKETS = NULL;
+    SYMBOL_BUCKET_COUNT = 0;
+    SYMBOL_BUCKET_MEMBERS = 0;
     free_type_instances(&TYPE_SYMBOL);
 }
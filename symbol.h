@@ -16,6 +16,13 @@ struct symbol {
 
     bool is_gensym;
     objptr_t name_string;
+
+    // Chain of symbols in the same bucket of the symbol table
+    unsigned int hash;
+    struct symbol *bucket_next;
+
+    // Opcode of the inlined builtin named by the symbol, if any
+    unsigned int inline_opcode;
 };
 
 
@@ -25,6 +32,9 @@ extern objptr_t SYMBOL_DEFINE;
 extern objptr_t SYMBOL_QUOTE;
 extern objptr_t SYMBOL_LAMBDA;
 extern objptr_t SYMBOL_LET;
+extern objptr_t SYMBOL_LETSTAR;
+extern objptr_t SYMBOL_LETREC;
+extern objptr_t SYMBOL_DO;
 extern objptr_t SYMBOL_SETBANG;
 extern objptr_t SYMBOL_IF;
 extern objptr_t SYMBOL_BEGIN;
@@ -32,7 +42,9 @@ extern objptr_t SYMBOL_COMPILE;
 
 objptr_t c_string_to_symbol(const char*);
 objptr_t string_to_symbol(objptr_t);
+objptr_t latin1_to_symbol(const char*, unsigned int, unsigned int);
 objptr_t symbol_to_string(objptr_t);
+objptr_t gensym(objptr_t);
 
 void init_symbols();
 void terminate_symbols();
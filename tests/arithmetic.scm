@@ -0,0 +1,25 @@
+; Arithmetic on fixnums takes fast paths, which switch to bignums
+; when a result doesn't fit, and mixes exact and inexact numbers.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (* 65536 65536))
+(show (* -2147483648 -1))
+(show (- 0 -2147483648))
+(show (quotient -2147483648 -1))
+(show (remainder -2147483648 -1))
+(show (quotient 7 -2))
+(show (remainder -7 2))
+(show (* 1.5 2))
+(show (+ 1 0.5))
+(show (* 46341 46341))
+(show (- 5))
+(show (- -2147483648))
+(show (/ -2147483648 -1))
+(show (+ 1/2 0.25))
+(show (* 2147483647 2147483647 2147483647))
+(show (quotient 123456789012345678901 10))
+(show (remainder 123456789012345678901 10))
+(show (quotient 7 0))
@@ -0,0 +1,9 @@
+; Calling a builtin with the wrong number of arguments is an error.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (vector-length))
+(show (cons 1 2 3))
+(show (vector-length (vector 1 2)))
@@ -0,0 +1,52 @@
+; Integers of any size. Products of long numbers use Karatsuba
+; multiplication, whose results have to agree with the schoolbook
+; method.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (factorial n)
+  (if (= n 0) 1 (* n (factorial (- n 1)))))
+(define (power base n)
+  (if (= n 0) 1 (* base (power base (- n 1)))))
+
+(define f100 (factorial 100))
+(show f100)
+(show (- f100))
+(show (quotient f100 (factorial 98)))
+(show (remainder f100 (+ (factorial 50) 1)))
+(show (quotient (- f100) 7))
+(show (remainder (- f100) 7))
+
+(define big (power 3 700))
+(define other (- (power 7 450) 1))
+(show (* big other))
+(show (- (* big other) (* other big)))
+(show (quotient (* big other) other))
+(show (= (quotient (* big other) big) other))
+(show (* (- big) other))
+(show (+ big (- big)))
+(show (- (power 2 64) 1))
+(show (+ (power 2 64) (- (power 2 64))))
+(show (< (- (power 2 100)) (power 2 100)))
+(show (< (power 2 100) (+ (power 2 100) 1)))
+(show (= (power 2 100) (* (power 2 50) (power 2 50))))
+(show (+ (power 2 31) -1))
+(show (- (power 2 31)))
+(show (/ (power 2 100) (power 2 98)))
+(show (/ (power 10 30) (power 10 28) 4))
+
+; Several levels of recursion, also with operands of unequal length
+(define huge (power 3 5000))
+(define huge2 (+ (power 7 3000) 12345))
+(define p 1000000007)
+(define (check a b)
+  (list (remainder (* a b) p)
+        (remainder (* (remainder a p) (remainder b p)) p)
+        (= (quotient (* a b) b) a)
+        (remainder (* a b) (power 10 12))))
+(show (check huge huge2))
+(show (check huge big))
+(show (check (- huge) huge2))
+(show (check huge (+ (power 2 1024) 1)))
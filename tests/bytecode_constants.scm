@@ -0,0 +1,28 @@
+; Constants of every kind, which the compiled pass of the tests reads
+; back from a bytecode file
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show 42)
+(show -2147483648)
+(show 123456789012345678901234567890)
+(show -98765432109876543210)
+(show 3/4)
+(show -1/340282366920938463463374607431768211456)
+(show 1.5)
+(show -.25e2)
+(show "a string with \"quotes\" and \x3bb;")
+(show "")
+(show (eqv? #\x41 #\A))
+(show (eqv? #\x3bb #\a))
+(show 'symbol)
+(show '(1 (2 . 3) "four" ()))
+(show (vector-ref (vector-ref #(1 #(2 3) "four") 1) 1))
+(show (vector-ref '#(1 #(2 3) "four") 2))
+(show '(#t #f))
+(show (eq? 'symbol 'symbol))
+(show (equal? "same" "same"))
+(show (let loop ((i 0) (acc '()))
+        (if (< i 3) (loop (+ i 1) (cons 'x acc)) acc)))
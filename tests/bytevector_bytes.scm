@@ -0,0 +1,25 @@
+; Bytes are numbers from 0 to 255, and storing them reports bad
+; indices and read-only bytevectors.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (bytevector 1 2 300))
+(show (bytevector -1))
+(show (bytevector 0 255))
+(show (make-bytevector 2 256))
+(show (make-bytevector 2 255))
+
+(define v (make-bytevector 2 0))
+(show (bytevector-u8-set! v 0 256))
+(show (bytevector-u8-set! v 2 1))
+(show (bytevector-u8-set! v -1 1))
+(bytevector-u8-set! v 1 7)
+(show v)
+(show (bytevector-u8-ref v 2))
+(show (bytevector-u8-ref v 1))
+
+(define mapped (file-map "tests/bytevector_bytes.scm"))
+(show (bytevector-u8-set! mapped 0 65))
+(show (bytevector-u8-ref mapped 0))
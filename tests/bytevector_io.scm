@@ -0,0 +1,70 @@
+; Files are read and written straight from and into bytevectors or
+; ranges of them, and slices and mapped files share their storage.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define path "/tmp/nil-test-bytes")
+
+(define bytes (bytevector 10 20 30 40 50 60 70 80))
+
+; Slices see changes of the bytevector and the other way around
+(define middle (bytevector-slice bytes 2 5))
+(show (bytevector-length middle))
+(bytevector-u8-set! bytes 2 33)
+(show (bytevector-u8-ref middle 0))
+(bytevector-u8-set! middle 2 55)
+(show (bytevector-u8-ref bytes 4))
+(show (bytevector-length (bytevector-slice bytes 6)))
+
+; Copies don't
+(define copy (bytevector-copy bytes 1 4))
+(bytevector-u8-set! bytes 1 21)
+(show copy)
+
+; bytevector-copy! handles overlapping ranges
+(define shift (bytevector 1 2 3 4 5 6))
+(bytevector-copy! shift 1 shift 0 5)
+(show shift)
+(bytevector-copy! shift 0 shift 1)
+(show shift)
+
+(define fd (file-open path 'write))
+(show (file-write fd bytes))
+(show (file-write fd bytes 6))
+(show (file-write fd middle 0 1))
+(file-close fd)
+
+(set! fd (file-open path))
+(show (file-size fd))
+(define buffer (make-bytevector 6 0))
+(show (file-read! fd buffer 2 5))
+(show buffer)
+(show (file-read! fd buffer))
+(show buffer)
+(show (file-read! fd buffer))
+(show buffer)
+(show (file-read! fd buffer))
+
+; Reading at an offset leaves the position alone
+(show (file-pread! fd buffer 8 0 3))
+(show buffer)
+(show (file-read! fd buffer))
+(file-close fd)
+
+(set! fd (file-open path 'append))
+(show (file-write fd (bytevector 99)))
+(file-close fd)
+
+; A mapped file is read-only and sees the whole file
+(define mapped (file-map path))
+(show (bytevector-length mapped))
+(show (bytevector-read-only? mapped))
+(show (bytevector-u8-ref mapped 11))
+(show (bytevector-read-only? (bytevector-slice mapped 1 3)))
+(show (bytevector-read-only? (bytevector-copy mapped 1 3)))
+
+(show (file-open "/tmp/nil-test-missing/file"))
+(show (file-map "/tmp/nil-test-missing/file"))
+(show (file-open path 'sideways))
@@ -0,0 +1,27 @@
+; Comparing other objects than numbers is an error, it must not make
+; them equal. NaN is unordered.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (equal-numbers? a b) (= a b))
+(define (less? a b) (< a b))
+
+(show (= 'a 1))
+(show (= "x" "y"))
+(show (< 1 'b))
+(show (equal-numbers? 'a 'a))
+(show (less? "x" 1))
+
+(define nan (/ 0. 0.))
+(show (= nan nan))
+(show (equal-numbers? nan nan))
+(show (< nan 1))
+(show (>= nan 1))
+
+(show (= 1 1 1))
+(show (equal-numbers? 2 2.0))
+(show (less? 1 2))
+(show (<= 1 2 2))
+(show (> 3 2 2))
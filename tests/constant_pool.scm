@@ -0,0 +1,34 @@
+; Equal literals of a compilation unit share one constant, but
+; constants which only compare equal as numbers stay apart.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (reals) (list 0.0 -0.0 1.0 1))
+(show (/ 1 (car (reals))))
+(show (/ 1 (car (cdr (reals)))))
+(show (/ 1 (car (cdr (cdr (reals))))))
+(show (/ 2 (car (cdr (cdr (cdr (reals)))))))
+
+(define (numbers) (list 1/2 0.5 2 2.0 123456789012345678901 123456789012345678901.0))
+(show (/ 1 (car (numbers))))
+(show (/ (car (cdr (cdr (numbers)))) 4))
+(show (/ (car (cdr (cdr (cdr (numbers))))) 4))
+
+(define (strings) (list "same" "same" "other"))
+(show (equal? (car (strings)) (car (cdr (strings)))))
+(show (strings))
+
+(define (symbols) (list 'sym 'sym (string->symbol "sym")))
+(show (eq? (car (symbols)) (car (cdr (cdr (symbols))))))
+
+; Enough constants to grow the indexes several times
+(define (many)
+  (list 0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24
+        25 26 27 28 29 30 31 32 33 34 35 36 37 38 39 40 41 42 43 44 45 46
+        47 48 49 50 51 52 53 54 55 56 57 58 59 60 61 62 63 64 65 66 67 68
+        69 70 71 72 73 74 75 76 77 78 79 80 0.0 -0.0 0 1 2 3 "s" "s"))
+(define (sum items acc)
+  (if (null? items) acc (sum (cdr items) (if (number? (car items)) (+ acc (car items)) acc))))
+(show (sum (many) 0))
@@ -0,0 +1,18 @@
+; Dividing the smallest int by -1 overflows an int, the quotient has
+; to become a bignum instead of trapping.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (/ -2147483648 -1))
+(show (quotient -2147483648 -1))
+(show (remainder -2147483648 -1))
+(show (/ -2147483647 -1))
+(show (/ 12 -4))
+(show (/ 7 -2))
+
+; Exact division by zero is an error
+(show (/ 1 0))
+(show (quotient 1 0))
+(show (/ 1/2 0))
@@ -0,0 +1,68 @@
+; Data written with fasl-write and read back with fasl-read keeps its
+; sharing and cycles, and symbols are interned again when read.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define path "/tmp/nil-test.fasl")
+
+(define shared (list 'a "b"))
+(define both (cons shared shared))
+(define cycle (list 1 2 3))
+(set-cdr! (cdr (cdr cycle)) cycle)
+(define self (vector 'me 0))
+(vector-set! self 1 self)
+
+(define fd (file-open path 'write))
+(show (fasl-write both fd))
+(show (fasl-write cycle fd))
+(show (fasl-write self fd))
+(show (fasl-write (list (* 18446744073709551616 -3) 22/7 -0.5 "\x3bb;-string"
+                        (s16vector -3 7 1000) (bytevector 1 2 255)
+                        '(nested (list . tail)) '())
+                  fd))
+(show (fasl-write 'last fd))
+; Code can't be written
+(show (fasl-write (lambda (x) x) fd))
+(show (fasl-write (list 1 car) fd))
+(file-close fd)
+
+(set! fd (file-open path))
+(define both-read (fasl-read fd))
+(show both-read)
+(show (eq? (car both-read) (cdr both-read)))
+(show (eq? both-read both))
+
+(define cycle-read (fasl-read fd))
+(show (car cycle-read))
+(show (car (cdr (cdr (cdr cycle-read)))))
+(show (eq? (cdr (cdr (cdr cycle-read))) cycle-read))
+
+(define self-read (fasl-read fd))
+(show (vector-ref self-read 0))
+(show (eq? (vector-ref self-read 1) self-read))
+
+(define data (fasl-read fd))
+(show (car data))
+(show (car (cdr data)))
+(show (car (cdr (cdr data))))
+(show (car (cdr (cdr (cdr data)))))
+(show (string-length (car (cdr (cdr (cdr data))))))
+(show (typed-vector-sum (car (cdr (cdr (cdr (cdr data)))))))
+(show (bytevector-u8-ref (car (cdr (cdr (cdr (cdr (cdr data)))))) 2))
+(show (cdr (cdr (cdr (cdr (cdr (cdr data)))))))
+
+(show (eq? (fasl-read fd) 'last))
+; The end of the input gives the default
+(show (fasl-read fd))
+(show (fasl-read fd 'end))
+(file-close fd)
+
+; So does data that isn't a fasl message
+(set! fd (file-open path 'write))
+(file-write fd (bytevector 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16))
+(file-close fd)
+(set! fd (file-open path))
+(show (fasl-read fd 'bad))
+(file-close fd)
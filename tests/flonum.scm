@@ -0,0 +1,34 @@
+; Reals, which builds with -DNIL_NAN_BOXING keep unboxed in the
+; object reference, behave the same in every build.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (+ 0.1 0.2))
+(show (* 1e300 1e10))
+(show (- (* 1e300 1e10)))
+(show (- (* 1e300 1e10) (* 1e300 1e10)))
+(show (/ 0. 0.))
+(show (= (/ 0. 0.) (/ 0. 0.)))
+(show (eqv? 1.5 1.5))
+(show (eq? 2.5 2.5))
+(show (vector-ref (vector 1.25 2) 0))
+(show (car (cons 3.75 '())))
+(show 1e-300)
+(show 4.9e-324)
+(show 1.7976931348623157e308)
+(show (< -inf.0 -1e308))
+(show (+ 2147483647 0.5))
+(show (* 1.0 123456789012345678901))
+(show 123456.789)
+(show -0.0)
+(show (number? 1.5))
+
+(define (sum-reals n acc)
+  (if (= n 0) acc (sum-reals (- n 1) (+ acc 0.5))))
+(show (sum-reals 1000 0))
+(define reals (vector 0.5 -0.5 1e100))
+(vector-set! reals 0 (* (vector-ref reals 0) 4))
+(show (vector-ref reals 0))
+(show (equal? (list 1.5 2.5) (list 1.5 2.5)))
@@ -0,0 +1,45 @@
+; Procedures which get hot with fixnums and pairs, and are then
+; called with other operands or after their builtins were rebound.
+; Builds with the JIT compile them to native code first, which has
+; to fall back to the general instructions.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (add a b) (+ a b))
+(define (sub a b) (- a b))
+(define (less a b) (if (< a b) 'less 'not-less))
+(define (same a b) (if (= a b) 'same 'different))
+(define (head p) (car p))
+(define (tail p) (cdr p))
+
+(define (warm-up n)
+  (if (> n 0)
+      (begin
+        (add n 1) (sub n 1) (less n 1) (same n 1)
+        (head '(1 . 2)) (tail '(1 . 2))
+        (warm-up (- n 1)))))
+(warm-up 100)
+
+(show (add 2147483647 1))
+(show (sub -2147483648 1))
+(show (add 1/2 1/2))
+(show (sub 1.5 1))
+(show (less 3.5 4))
+(show (less 123456789012345678901 1))
+(show (same 2 2.0))
+(show (same 1/3 1/3))
+(show (head '(a b)))
+(show (tail '(a b)))
+
+(define (spin n acc)
+  (if (< n 1) acc (spin (- n 1) (+ acc n))))
+(show (spin 100000 0))
+
+(define + (lambda (a b) (list 'plus a b)))
+(define < (lambda (a b) #f))
+(define car (lambda (p) 'rebound))
+(show (add 1 2))
+(show (less 1 2))
+(show (head '(1 . 2)))
@@ -0,0 +1,22 @@
+; Runs after tests/lib/image.scm, either loaded into the same process
+; or restored from an image
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (counter))
+(show (counter))
+(show (eq? (car both) (cdr both)))
+(show (eq? cycle (cdr (cdr (cdr cycle)))))
+(show (car (cdr (cdr (cdr (cdr cycle))))))
+(show big)
+(show fraction)
+(show (* real 2))
+(show name)
+(show (s16vector->list numbers))
+(show (bytevector-u8-ref bytes 2))
+(show (vector-ref table 1))
+(define other (make-counter))
+(show (other))
+(show (counter))
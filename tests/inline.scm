@@ -0,0 +1,50 @@
+; The inlined builtins give the same results as calling them, for
+; every kind of operand. The loops run long enough to get compiled
+; to native code in builds with the JIT.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (car '(1 . 2)))
+(show (cdr '(1 . 2)))
+(show (cons 1 '()))
+(show (eq? 'a 'a))
+(show (eq? '() '()))
+(show (null? '()))
+(show (null? '(1)))
+(show (not #f))
+(show (not '()))
+
+(show (+ 2147483647 1))
+(show (- -2147483648 1))
+(show (+ 1/2 1/3))
+(show (- 1.5 1))
+(show (< 1 2))
+(show (< 2 1.5))
+(show (= 1 1.0))
+(show (= 1/2 0.5))
+
+(define (sum-to n)
+  (let loop ((i 0) (acc 0))
+    (if (< i n) (loop (+ i 1) (+ acc i)) acc)))
+(show (sum-to 100))
+
+(define (count-down n)
+  (if (= n 0) 'done (count-down (- n 1))))
+(show (count-down 100))
+
+; Crosses into bignums and back within the same loop
+(define (wrap n acc)
+  (if (= n 0) acc (wrap (- n 1) (- (+ acc 2147483647) 2147483646))))
+(show (wrap 100 2147483600))
+
+(define (lengths items acc)
+  (if (null? items) acc (lengths (cdr items) (+ acc (car (car items))))))
+(show (lengths '((1) (2) (3) (4) (5) (6) (7) (8) (9) (10)
+                 (11) (12) (13) (14) (15) (16) (17) (18) (19) (20))
+               0))
+
+(define (mixed n acc)
+  (if (< n 1/2) acc (mixed (- n 1/2) (+ acc 0.5))))
+(show (mixed 20 0))
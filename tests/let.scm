@@ -0,0 +1,45 @@
+; let, let*, letrec, named let and do run without making closures
+; but keep their scoping rules.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define x 'outer)
+(show (let ((x 1) (y x)) (list x y)))
+(show (let* ((x 1) (y (+ x 1))) (list x y)))
+(show (let () 'empty))
+(show (let ((x 1)) (let ((x (+ x 1))) x)))
+(show x)
+
+(show (letrec ((even? (lambda (n) (if (= n 0) #t (odd? (- n 1)))))
+               (odd? (lambda (n) (if (= n 0) #f (even? (- n 1))))))
+        (list (even? 10) (odd? 7))))
+
+(show (let loop ((i 0) (acc '()))
+        (if (= i 5) acc (loop (+ i 1) (cons i acc)))))
+(show (let loop ((i 0))
+        (if (< i 3) (loop (+ i 1)) i)))
+
+; Closures made in the body keep their own bindings
+(define saved
+  (let loop ((i 0) (acc '()))
+    (if (= i 3) acc (loop (+ i 1) (cons (lambda () i) acc)))))
+(show (list ((car saved)) ((car (cdr saved))) ((car (cdr (cdr saved))))))
+(show (let ((a 1))
+        (let ((get (lambda () a)))
+          (set! a 2)
+          (get))))
+
+(show (do ((i 0 (+ i 1)) (acc '() (cons i acc))) ((= i 4) acc)))
+(show (do ((vec (make-vector 3 0)) (i 0 (+ i 1)))
+          ((= i 3) (vector-ref vec 2))
+        (vector-set! vec i (* i i))))
+(show (do ((i 0 (+ i 1)) (fixed 'same)) ((= i 2) fixed)))
+
+; A named let whose name is shadowed in its body
+(show (let loop ((n 2))
+        (if (= n 0)
+            'end
+            (let ((loop (lambda (m) (list 'inner m))))
+              (loop n)))))
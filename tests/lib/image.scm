@@ -0,0 +1,24 @@
+; The library of tests/image.scm, which the compiled pass of the
+; tests saves into an image
+
+(define (make-counter)
+  (let ((count 0))
+    (lambda ()
+      (set! count (+ count 1))
+      count)))
+
+(define counter (make-counter))
+(counter)
+
+(define shared (list 'a 'b))
+(define both (cons shared shared))
+(define cycle (list 1 2 3))
+(set-cdr! (cdr (cdr cycle)) cycle)
+
+(define big (* 18446744073709551616 18446744073709551616))
+(define fraction (/ 1 big))
+(define real 2.5)
+(define name "\x3bb;-library")
+(define numbers (s16vector -3 7 1000))
+(define bytes (bytevector 1 2 255))
+(define table (vector 'x "y" 3))
@@ -0,0 +1,11 @@
+; Loaded before tests/loader.scm, which uses these definitions
+
+(define (make-counter)
+  (let ((count 0))
+    (lambda ()
+      (set! count (+ count 1))
+      count)))
+
+(define bump (make-counter))
+
+(define (describe) "the library's describe")
@@ -0,0 +1,1026 @@
+; The loader runs each form before reading the next one, so forms
+; see the definitions and side effects of earlier forms, in this file
+; and in tests/lib/loader.scm. The thousands of calls below span
+; several collections of finished fibers.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (describe))
+(define (describe) "this file's describe")
+(show (describe))
+
+(define order '())
+(set! order (cons 'first order))
+(set! order (cons 'second order))
+(show order)
+
+(define (later) (helper 20))
+(define (helper n) (+ n 1))
+(show (later))
+
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+(bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump) (bump)
+
+(show (bump))
+(define bump-again bump)
+(show (bump-again))
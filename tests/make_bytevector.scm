@@ -0,0 +1,11 @@
+; Negative lengths are errors, they must not become huge sizes for
+; malloc().
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (make-bytevector -1))
+(show (make-bytevector 2.5e10))
+(show (make-bytevector 3 7))
+(show (bytevector-length (make-bytevector 0)))
@@ -0,0 +1,61 @@
+;; read-file-parallel splits a file at whitespace between top-level
+;; forms. The forms written here have parentheses in strings,
+;; characters and comments, which the split must skip. The file is
+;; large enough for several pieces, and every thread count has to read
+;; the same forms as the sequential reader.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define path "/tmp/nil-test-parallel.scm")
+
+;; The bytes of one line of the file:
+;;   (item "a (string; \"x\")" #\( #\) (n . 3/4) -1.5 sym) ; comment )("
+(define form-line
+  (bytevector
+   40 105 116 101 109 32 34 97 32 40 115 116 114 105 110 103 59 32
+   92 34 120 92 34 41 34 32 35 92 40 32 35 92 41 32 40 110 32 46 32
+   51 47 52 41 32 45 49 46 53 32 115 121 109 41 32 59 32 99 111 109
+   109 101 110 116 32 41 40 34 10))
+
+(define (write-lines fd count)
+  (if (> count 0)
+      (begin
+        (file-write fd form-line)
+        (write-lines fd (- count 1)))))
+
+(define fd (file-open path 'write))
+(write-lines fd 6000)
+(file-close fd)
+
+(define sequential (read-file-parallel path 1))
+(show (vector-length sequential))
+
+(define first (vector-ref sequential 0))
+(show (car first))
+(show (car (cdr first)))
+(show (eqv? (car (cdr (cdr first))) #\())
+(show (eqv? (car (cdr (cdr (cdr first)))) #\)))
+(show (cdr (cdr (cdr (cdr first)))))
+(show (equal? first (vector-ref sequential 5999)))
+
+(define (same-forms? threads)
+  (let ((forms (read-file-parallel path threads)))
+    (and (= (vector-length forms) 6000)
+         (equal? (vector-ref forms 0) first)
+         (equal? (vector-ref forms 2999) first)
+         (equal? (vector-ref forms 5999) first)
+         ;; Symbols are interned once, whichever piece read them
+         (eq? (car (vector-ref forms 4321)) 'item))))
+
+(show (same-forms? 2))
+(show (same-forms? 3))
+(show (same-forms? 8))
+
+;; Files that can't be read or parsed give #f
+(show (read-file-parallel "/tmp/nil-test-missing.scm" 2))
+(set! fd (file-open path 'write))
+(file-write fd (bytevector 40 97 32 40 98 41 10))
+(file-close fd)
+(show (read-file-parallel path 2))
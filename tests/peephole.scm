@@ -0,0 +1,47 @@
+; Code shapes the peephole optimizer rewrites: jumps to jumps from
+; nested ifs, values which are dropped right away, and branches
+; which end at the same place.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (classify n)
+  (if (< n 0)
+      (if (< n -10) 'very-negative 'negative)
+      (if (= n 0)
+          'zero
+          (if (< n 10) 'small 'large))))
+(show (list (classify -20) (classify -1) (classify 0) (classify 5) (classify 50)))
+
+(define (nested-value a b)
+  (+ (if a (if b 1 2) (if b 3 4)) 10))
+(show (list (nested-value #t #t) (nested-value #t #f)
+            (nested-value #f #t) (nested-value #f #f)))
+
+(define (dropped x)
+  (begin 1 'two "three" x))
+(show (dropped 4))
+
+(define (statement x)
+  (if x 'yes 'no)
+  (if x (car '(1)) (cdr '(1)))
+  x)
+(show (statement #t))
+(show (statement #f))
+
+(define (one-armed x)
+  (begin (if x (show 'then)) 'after))
+(show (one-armed #t))
+(show (one-armed #f))
+
+(define (same-end x)
+  (if x (if x 'a 'b) (if x 'c 'd)))
+(show (list (same-end #t) (same-end #f)))
+
+(define (count-evens items acc)
+  (if (null? items)
+      acc
+      (count-evens (cdr items)
+                   (if (= (remainder (car items) 2) 0) (+ acc 1) acc))))
+(show (count-evens '(1 2 3 4 5 6 7 8 9 10) 0))
@@ -0,0 +1,25 @@
+; Builtins are procedures like closures: they can be passed around,
+; stored and called through any variable.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (map1 f items)
+  (if (null? items)
+      '()
+      (cons (f (car items)) (map1 f (cdr items)))))
+
+(show (procedure? car))
+(show (procedure? 'car))
+(show (map1 car '((1 2) (3 4))))
+(show ((car (list + -)) 2 3))
+(show (vector-ref (vector - *) 1))
+
+(define plus +)
+(show (plus 1 2 3))
+(show (plus))
+(show (eq? plus +))
+(show (vector-length ((if (< 1 2) vector list) 1 2)))
+(show (list))
+(show (list 1 "two" 'three))
@@ -0,0 +1,37 @@
+; Exact division and rational arithmetic stay exact when the parts
+; don't fit into 32 bits or are bignums.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define big 18446744073709551616)
+
+(show (/ 1 2147483648))
+(show (/ -6 4294967296))
+(show (+ 1/2147483647 1/2147483646))
+(show (- 1/4294967296 1/4294967296))
+(show (* 4294967296/3 3/4294967296))
+(show (/ 100000000000000000000 30000000000000000000))
+
+; Parts beyond 64 bits
+(show (/ 1 big))
+(show (- 0 (/ 3 big)))
+(show (+ (/ 1 big) (/ 1 big)))
+(show (* (/ 1 big) big))
+(show (/ (* big big 3) (* big 6)))
+(show (/ (* big 5) (* big big 10)))
+(show (- (/ 1 big) (/ 1 (* big big))))
+
+(show (< (/ 1 (* big big)) (/ 1 big)))
+(show (= (/ 2 big) (/ 1 (/ big 2))))
+(show (> (- 0 (/ 1 big)) (/ -1 (* big big))))
+(show (* 1.0 (/ 1 big)))
+
+; Big rationals survive a fasl round-trip
+(define fd (file-open "/tmp/nil-test-rational.fasl" 'write))
+(show (fasl-write (/ -7 (* big big)) fd))
+(file-close fd)
+(define fd (file-open "/tmp/nil-test-rational.fasl"))
+(show (fasl-read fd))
+(file-close fd)
@@ -0,0 +1,27 @@
+; Inlined builtins call their new binding once their name is
+; rebound. The procedures below are compiled, and their opcode pairs
+; fused, before null?, car and cdr are redefined.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (len l n) (if (null? l) n (len (cdr l) (+ n 1))))
+(define (first l) (car l))
+(define (second l) (car (cdr l)))
+(define (count-pairs l) (if (pair? l) (+ 1 (count-pairs (cdr l))) 0))
+
+(show (len '(1 2 3) 0))
+(show (second '(1 2 3)))
+
+(define null? (lambda (x) (eq? x '())))
+(show (len '(1 2 3) 0))
+
+(define car (lambda (p) (if (pair? p) 'car 'none)))
+(show (first '(1 2)))
+(show (list (first '(1 2)) 5))
+
+(define cdr (lambda (p) '()))
+(show (second '(1 2 3)))
+(show (len '(1 2 3) 0))
+(show (count-pairs '(1 2 3)))
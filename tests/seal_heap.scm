@@ -0,0 +1,20 @@
+; Cycles are only freed by the collector. Sealing the heap has to
+; collect them first, so that their cells can be used again.
+
+(define (make-garbage count)
+  (do ((i 0 (+ i 1)))
+      ((= i count))
+    (let ((pair (cons i '())))
+      (set-cdr! pair pair))))
+
+(define (make-pairs count)
+  (do ((i 0 (+ i 1))
+       (pairs '() (cons i pairs)))
+      ((= i count) pairs)))
+
+(make-garbage 100000)
+(seal-heap!)
+(define size (heap-size))
+(define pairs (make-pairs 75000))
+(display (= (heap-size) size))
+(newline)
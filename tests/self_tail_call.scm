@@ -0,0 +1,37 @@
+; Self tail calls jump back to the start of the procedure instead of
+; calling it again. They behave like ordinary calls: closures keep
+; the values of their iteration, and calls to another procedure
+; under the same name aren't affected.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (count n acc)
+  (if (= n 0) acc (count (- n 1) (+ acc 1))))
+(show (count 1000000 0))
+
+(define (capture n acc)
+  (if (= n 0) acc (capture (- n 1) (cons (lambda () n) acc))))
+(define (call-all l)
+  (if (null? l) '() (cons ((car l)) (call-all (cdr l)))))
+(show (call-all (capture 3 '())))
+
+(define (swap a b n)
+  (if (= n 0) (list a b) (swap b a (- n 1))))
+(show (swap 'x 'y 3))
+
+(define (make-looper tag)
+  (define (loop n)
+    (if (= n 0) tag (loop (- n 1))))
+  loop)
+(define loop-a (make-looper 'a))
+(define loop-b (make-looper 'b))
+(show (loop-a 5))
+(show (loop-b 5))
+
+(define (again n)
+  (if (= n 0) 'original (again (- n 1))))
+(define first-again again)
+(define (again n) (list 'replacement n))
+(show (first-again 3))
@@ -0,0 +1,33 @@
+; Strings of Latin-1 characters take a byte per character, others
+; are wide. Both kinds behave alike, also when they are mixed.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define narrow "abc\xe9;")
+(define wide "\x3bb;abc\xe9;")
+(show (string-length narrow))
+(show (string-length wide))
+(show (substring wide 1 5))
+(show (string=? (substring wide 1 5) narrow))
+(show (string=? narrow (substring wide 1 5)))
+(show (string<? narrow wide))
+(show (string>? wide narrow))
+(show (string-append narrow wide narrow))
+(show (string-length (string-append narrow wide)))
+(show (string->symbol (substring wide 1 4)))
+(show (eq? (string->symbol (substring wide 1 4)) 'abc))
+(show (string-length (symbol->string 'abc)))
+(show (substring "" 0 0))
+(show (string=? "" (substring wide 2 2)))
+
+; Names of files are encoded like printed strings
+(define name "/tmp/nil-test-\xe9;\x3bb;.txt")
+(define fd (file-open name 'write))
+(show (file-write fd (bytevector 104 105)))
+(file-close fd)
+(define fd (file-open (string->symbol name)))
+(show (file-size fd))
+(file-close fd)
+(show (bytevector-u8-ref (file-map name) 1))
@@ -0,0 +1,52 @@
+; String builders collect characters and strings, and long results
+; of string-append are ropes. Both give ordinary strings.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define b (make-string-builder))
+(show (string-builder-length b))
+(string-builder-append! b "abc")
+(string-builder-append! b #\d)
+(string-builder-append! b "\x3bb;")
+(show (string-builder-length b))
+(define s (string-builder-result b))
+(show s)
+(show (string-builder-length b))
+(string-builder-append! b "new")
+(show (string-builder-result b))
+(show s)
+(show (string-builder-append! b 5))
+(show (string-builder-result b))
+
+(define (append-times n acc)
+  (if (= n 0) acc (append-times (- n 1) (string-append acc "xy"))))
+(define (prepend-times n acc)
+  (if (= n 0) acc (prepend-times (- n 1) (string-append "xy" acc))))
+(define (alternate n acc)
+  (if (= n 0)
+      acc
+      (alternate (- n 1) (string-append "<" (string-append acc ">")))))
+
+(define appended (append-times 3000 ""))
+(define prepended (prepend-times 3000 ""))
+(show (string-length appended))
+(show (string=? appended prepended))
+(show (substring appended 1001 1007))
+(show (string-search "yxy" prepended 4000))
+
+(define nested (alternate 2000 "\x3bb;"))
+(show (string-length nested))
+(show (substring nested 1998 2003))
+(show (string-search "\x3bb;" nested))
+(show (string<? nested (string-append nested "")))
+(show (string=? nested (string-append (substring nested 0 1000)
+                                       (substring nested 1000 4001))))
+
+(define mixed (string-append appended nested appended))
+(show (string-length mixed))
+(show (string-search "x<" mixed))
+(show (eq? (string->symbol (substring mixed 6000 6005))
+           (string->symbol "<<<<<")))
+(show (string-builder-append! "not a builder" "x"))
@@ -0,0 +1,49 @@
+; Comparison, search and hashing of strings long enough to go
+; through the vector loops, with differences and matches on both
+; sides of their block boundaries.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (repeat s n)
+  (if (= n 0) "" (string-append s (repeat s (- n 1)))))
+
+(define a64 (repeat "a" 64))
+(define wide64 (string-append "\x3bb;" (substring (repeat "a" 64) 1 64)))
+
+(define (with-char base index c)
+  (string-append (substring base 0 index) c
+                 (substring base (+ index 1) (string-length base))))
+
+(define (compare-at index)
+  (list (string=? a64 (with-char a64 index "b"))
+        (string<? a64 (with-char a64 index "b"))
+        (string>? a64 (with-char a64 index "b"))))
+(show (compare-at 0))
+(show (compare-at 15))
+(show (compare-at 16))
+(show (compare-at 31))
+(show (compare-at 32))
+(show (compare-at 63))
+(show (string=? a64 (repeat "a" 64)))
+(show (string<? (repeat "a" 63) a64))
+(show (string<? a64 (repeat "a" 63)))
+(show (string=? wide64 (with-char a64 0 "\x3bb;")))
+(show (string<? a64 wide64))
+(show (string=? (substring wide64 1 64) (substring a64 1 64)))
+
+(define hay (string-append (repeat "ab" 40) "needle" (repeat "ab" 10) "needle"))
+(show (string-search "needle" hay))
+(show (string-search "needle" hay 81))
+(show (string-search "needle" hay 87))
+(show (string-search "missing" hay))
+(show (string-search "b" hay))
+(show (string-search "" hay))
+(show (string-search (string-append hay "x") hay))
+(show (string-search "\x3bb;x" (string-append (repeat "a" 40) "\x3bb;\x3bb;x")))
+(show (string-search "aab" (string-append (repeat "a" 33) "b")))
+
+; Symbols are found through the hash of their name, whatever its width
+(show (eq? (string->symbol (substring wide64 1 64)) (string->symbol (substring a64 1 64))))
+(show (eq? (string->symbol a64) (string->symbol (repeat "a" 64))))
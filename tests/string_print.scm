@@ -0,0 +1,9 @@
+; Strings holding characters beyond Latin-1 print as UTF-8, and empty
+; strings print nothing.
+
+(display "\x3bb;\x1f600;\xe9;")
+(newline)
+(display "")
+(newline)
+(display (string-append "x\xe9;" "\x20ac;"))
+(newline)
@@ -0,0 +1,30 @@
+; Each fused pair of instructions, also where a jump lands right
+; before or after one of them.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define (identity x) x)
+(define (pick a b) (identity (if a b (car b))))
+(define (tail x) (identity x))
+(define (tail-const x) (identity 'constant))
+(define (both a b) (cons a b))
+(define (first-of l) (car l))
+(define (rest-of l) (cdr l))
+(define (choose flag) (if flag 'on 'off))
+(define (walk l n) (if (null? l) n (walk (cdr l) (+ n 1))))
+(define (after-branch flag l) (cons (if flag 1 2) (car l)))
+
+(show (pick #t '(1 2)))
+(show (pick #f '(1 2)))
+(show (tail 'x))
+(show (tail-const 'x))
+(show (both 'a 'b))
+(show (first-of '(1 2)))
+(show (rest-of '(1 2)))
+(show (choose #f))
+(show (choose '()))
+(show (walk '(a b c d) 0))
+(show (after-branch #t '(3)))
+(show (after-branch #f '(4)))
@@ -0,0 +1,44 @@
+; Sums, dot products, extremes and element-wise arithmetic of
+; homogeneous vectors. Sums are exact, element-wise results of the
+; integer types wrap around.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (typed-vector-sum (u8vector 200 100 50)))
+(show (typed-vector-sum (s64vector 9223372036854775807 1)))
+(show (typed-vector-sum (u64vector 18446744073709551615 1)))
+(show (typed-vector-sum (f64vector 0.5 0.25)))
+(show (typed-vector-sum (f32vector)))
+(show (typed-vector-dot (s16vector 1 2 3) (s16vector 4 5 6)))
+(show (typed-vector-dot (u8vector 255 255) (u8vector 255 255)))
+(show (typed-vector-dot (s8vector 1) (s8vector 1 2)))
+(show (typed-vector-dot (s8vector 1) (u8vector 1)))
+(show (typed-vector-min (s32vector 5 -7 3)))
+(show (typed-vector-max (u32vector 5 4294967295 3)))
+(show (typed-vector-min (u8vector)))
+(show (typed-vector-max (f64vector -1.5 2.5)))
+(show (u8vector->list (typed-vector-add (u8vector 250 1) (u8vector 10 2))))
+(show (s8vector->list (typed-vector-subtract (s8vector -128 0) (s8vector 1 1))))
+(show (u16vector->list (typed-vector-multiply (u16vector 300 2) (u16vector 300 3))))
+(show (f64vector->list (typed-vector-divide (f64vector 1 3) (f64vector 4 0))))
+(show (typed-vector-divide (s32vector 1) (s32vector 1)))
+(show (f32vector->list (f32vector 0.1)))
+(show (s64vector->list (typed-vector-add (s64vector 9223372036854775807) (s64vector 1))))
+(define big (make-f64vector 1000 0.5))
+(show (typed-vector-sum big))
+(show (typed-vector-dot big big))
+(define ints (make-s32vector 1001 -3))
+(s32vector-set! ints 1000 7)
+(show (typed-vector-sum ints))
+(show (typed-vector-max ints))
+(show (typed-vector-min ints))
+(show (u8vector->list (typed-vector-add (u8vector 1 2) 255)))
+(show (f64vector->list (typed-vector-multiply (f64vector 1.5 -2) 2)))
+(show (typed-vector-add (u8vector 1 2) 256))
+(show (typed-vector-sum (vector 1 2)))
+(define odd-length (make-u8vector 37 1))
+(u8vector-set! odd-length 36 200)
+(show (typed-vector-sum (typed-vector-multiply odd-length odd-length)))
+(show (typed-vector-max odd-length))
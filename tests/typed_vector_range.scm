@@ -0,0 +1,40 @@
+; Elements of homogeneous vectors must be numbers the element type
+; can represent. Others are errors instead of wrapping around.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(show (make-u8vector 4 300))
+(show (make-u8vector 2 255))
+(show (u8vector 0 255 256))
+(show (u8vector -1))
+(show (list->u8vector '(1 2 256)))
+(show (s8vector -128 127))
+(show (s8vector -129))
+(show (s8vector 128))
+(show (u16vector 65535))
+(show (u16vector 65536))
+(show (s16vector -32768 32767))
+(show (s16vector 32768))
+(show (u32vector 4294967295))
+(show (u32vector 4294967296))
+(show (s32vector -2147483648 2147483647))
+(show (s32vector 2147483648))
+(show (u64vector 0 18446744073709551615))
+(show (u64vector 18446744073709551616))
+(show (u64vector -1))
+(show (s64vector -9223372036854775808 9223372036854775807))
+(show (s64vector 9223372036854775808))
+(show (s64vector -9223372036854775809))
+(show (u8vector 1.5))
+(show (f64vector 1 0.5 1/4))
+(show (f32vector 'a))
+
+(define v (make-u8vector 2 0))
+(show (u8vector-set! v 0 -1))
+(show (u8vector-set! v 2 1))
+(u8vector-set! v 1 200)
+(show v)
+(show (typed-vector-add v 300))
+(show (typed-vector-add v 100))
@@ -0,0 +1,23 @@
+; vector-copy! only copies into the existing members of the target,
+; ranges which don't fit are errors.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define z (vector 1 2))
+(show (vector-copy! z 1 (vector 7 8 9)))
+(show (vector-length z))
+(show (vector-copy! z 3 (vector 7)))
+(show (vector-copy! z 0 (vector 7 8 9) 2 1))
+(show (vector-copy! z 0 (vector 7 8 9) 1 4))
+(show (vector-length z))
+
+(vector-copy! z 1 (vector 7 8 9) 2)
+(show (vector-ref z 0))
+(show (vector-ref z 1))
+(vector-copy! z 0 (vector 7 8 9) 0 2)
+(show (vector-ref z 0))
+(show (vector-ref z 1))
+(vector-copy! z 2 (vector 7 8 9) 0 0)
+(show (vector-length z))
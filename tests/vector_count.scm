@@ -0,0 +1,19 @@
+; Negative counts and indices are errors, they must not wrap around
+; to huge unsigned sizes.
+
+(define (show value)
+  (display value)
+  (newline))
+
+(define v (make-vector 3 0))
+
+(show (make-vector -1))
+(show (vector-grow v -1))
+(show (vector-fill! v 1 0 -1))
+(show (vector-ref v -1))
+(show (make-u8vector -1))
+
+(show (vector-length (vector-grow v 10)))
+(vector-fill! v 7 1)
+(show (vector-ref v 0))
+(show (vector-ref v 2))
@@ -0,0 +1,545 @@
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "number.h"
+
+#include "typed_vector.h"
+
+
+
+/*
+ * The element types, with
+ *  - the C type of the elements,
+ *  - the type in which arithmetic wraps around without overflowing,
+ *  - the accumulators of sums and dot products over a chunk of
+ *    CHUNK_LENGTH elements, which are added up in the total type,
+ *  - whether the elements are INTEGER or REAL numbers.
+ *
+ * Small integer types use long long accumulators, which the
+ * compiler can vectorize; CHUNK_LENGTH keeps them from overflowing.
+ */
+#define ELEMENT_TYPES(X)                                                             \
+    X(U8,  u8,  uint8_t,  unsigned int, long long, long long, __int128, INTEGER)     \
+    X(S8,  s8,  int8_t,   unsigned int, long long, long long, __int128, INTEGER)     \
+    X(U16, u16, uint16_t, unsigned int, long long, long long, __int128, INTEGER)     \
+    X(S16, s16, int16_t,  unsigned int, long long, long long, __int128, INTEGER)     \
+    X(U32, u32, uint32_t, unsigned int, long long, __int128,  __int128, INTEGER)     \
+    X(S32, s32, int32_t,  unsigned int, long long, __int128,  __int128, INTEGER)     \
+    X(U64, u64, uint64_t, uint64_t,     __int128,  __int128,  __int128, INTEGER)     \
+    X(S64, s64, int64_t,  uint64_t,     __int128,  __int128,  __int128, INTEGER)     \
+    X(F32, f32, float,    float,        double,    double,    double,   REAL)        \
+    X(F64, f64, double,   double,       double,    double,    double,   REAL)
+
+#define CHUNK_LENGTH (1u << 30)
+
+#define IS_REAL_INTEGER false
+#define IS_REAL_REAL    true
+
+#define TO_OBJECT_INTEGER(VALUE) make_integer_from_int128((__int128) (VALUE))
+#define TO_OBJECT_REAL(VALUE)    make_real((double) (VALUE))
+
+#define FROM_OBJECT_INTEGER(TYPE, PTR) ((TYPE) number_to_long_long(PTR))
+#define FROM_OBJECT_REAL(TYPE, PTR)    ((TYPE) number_to_real(PTR))
+
+#define ACCEPTS_INTEGER(TYPE, PTR) accepts_integer(PTR, sizeof(TYPE), (TYPE) -1 < 0)
+#define ACCEPTS_REAL(TYPE, PTR)    accepts_real(PTR)
+
+
+/*
+ * Whether the object is an exact integer which fits into an integer
+ * of SIZE bytes
+ */
+static bool accepts_integer(objptr_t ptr, size_t size, bool is_signed)
+{
+    struct number buffer;
+    struct number *number;
+    unsigned long long magnitude;
+    __int128 value, limit;
+
+    if (!is_of_type(ptr, &TYPE_NUMBER)) return false;
+
+    number = number_view(ptr, &buffer);
+    switch (number->type) {
+    case NUMBER_INTEGER:
+        value = number->value.integer;
+        break;
+    case NUMBER_BIGNUM:
+        // Bignums have no leading zero limbs, longer ones don't fit
+        if (number->value.bignum.length > 2) return false;
+        magnitude = number->value.bignum.limbs[0];
+        if (number->value.bignum.length > 1) {
+            magnitude |= (unsigned long long) number->value.bignum.limbs[1] << LIMB_BITS;
+        }
+        value = number->value.bignum.negative ? -(__int128) magnitude : (__int128) magnitude;
+        break;
+    default:
+        return false;
+    }
+
+    if (is_signed) {
+        limit = (__int128) 1 << (size * 8 - 1);
+        return value >= -limit && value < limit;
+    } else {
+        return value >= 0 && value < ((__int128) 1 << (size * 8));
+    }
+}
+
+
+static bool accepts_real(objptr_t ptr)
+{
+    struct number buffer;
+
+    return is_of_type(ptr, &TYPE_NUMBER)
+        && number_view(ptr, &buffer)->type != NUMBER_COMPLEX;
+}
+
+
+// Returns EMPTY_LIST if there is no memory for a bignum
+static objptr_t make_integer_from_int128(__int128 value)
+{
+    unsigned __int128 magnitude;
+    limb_t *limbs;
+    unsigned int i;
+
+    if (value >= LLONG_MIN && value <= LLONG_MAX) {
+        return make_integer_from_long_long((long long) value);
+    }
+
+    magnitude = (value < 0) ? -(unsigned __int128) value : (unsigned __int128) value;
+    limbs = malloc(4 * sizeof(limb_t));
+    if (limbs == NULL) return EMPTY_LIST;
+    for (i = 0; i < 4; i++) {
+        limbs[i] = (limb_t) magnitude;
+        magnitude >>= LIMB_BITS;
+    }
+
+    return make_integer_from_limbs(value < 0, limbs, 4);
+}
+
+
+
+static const struct {
+    const char *tag;
+    size_t size;
+    bool is_real;
+} ELEMENT_INFO[TYPED_VECTOR_TYPE_COUNT] = {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND) \
+    [TYPED_VECTOR_##NAME] = { #TAG, sizeof(TYPE), IS_REAL_##KIND },
+    ELEMENT_TYPES(X)
+#undef X
+};
+
+
+
+void init_typed_vector(struct typed_vector *vector)
+{
+    vector->type = TYPED_VECTOR_U8;
+    vector->length = 0;
+    vector->data = NULL;
+}
+
+
+void terminate_typed_vector(struct typed_vector *vector)
+{
+    free(vector->data);
+    vector->data = NULL;
+    vector->length = 0;
+}
+
+
+bool typed_vector_eqv(struct typed_vector *v1,
+                      struct typed_vector *v2,
+                      enum eqv_strictness strictness)
+{
+    switch (strictness) {
+    case EQV_STRICT: return v1 == v2;
+    case EQ_STRICT:
+        return (v1 == v2) ||
+            (v1->length == 0 && v2->length == 0 && v1->type == v2->type);
+    case EQUAL_STRICT:
+        return (v1 == v2) ||
+            (v1->type == v2->type && v1->length == v2->length &&
+             (v1->length == 0 ||
+              memcmp(v1->data, v2->data, v1->length * ELEMENT_INFO[v1->type].size) == 0));
+    default: return false;
+    }
+}
+
+
+DEFTYPE(TYPE_TYPED_VECTOR,
+        struct typed_vector,
+        init_typed_vector,
+        terminate_typed_vector,
+        NULL,
+        NULL,
+        typed_vector_eqv);
+
+
+
+/*
+ * Kernels
+ *
+ * Plain loops over restrict pointers, which the compiler vectorizes
+ * when optimizing (-O3, or -O2 with -ftree-vectorize). Sums and dot
+ * products use four partial results, so that real ones vectorize
+ * without reassociating a single sum.
+ */
+#define ELEMENTWISE_LOOP(TYPE, WRAP, OPERATOR)                              \
+    if (b != NULL) {                                                        \
+        for (i = 0; i < length; i++)                                        \
+            out[i] = (TYPE) ((WRAP) a[i] OPERATOR (WRAP) b[i]);             \
+    } else {                                                                \
+        for (i = 0; i < length; i++)                                        \
+            out[i] = (TYPE) ((WRAP) a[i] OPERATOR (WRAP) scalar);           \
+    }
+
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND)                     \
+                                                                            \
+static SUM sum_chunk_##TAG(const TYPE *restrict data, unsigned int length)  \
+{                                                                           \
+    SUM partial[4] = { 0, 0, 0, 0 };                                        \
+    unsigned int i;                                                         \
+                                                                            \
+    for (i = 0; i + 4 <= length; i += 4) {                                  \
+        partial[0] += data[i];                                              \
+        partial[1] += data[i + 1];                                          \
+        partial[2] += data[i + 2];                                          \
+        partial[3] += data[i + 3];                                          \
+    }                                                                       \
+    for (; i < length; i++) partial[0] += data[i];                          \
+                                                                            \
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);           \
+}                                                                           \
+                                                                            \
+static DOT dot_chunk_##TAG(const TYPE *restrict a, const TYPE *restrict b,  \
+                           unsigned int length)                             \
+{                                                                           \
+    DOT partial[4] = { 0, 0, 0, 0 };                                        \
+    unsigned int i;                                                         \
+                                                                            \
+    for (i = 0; i + 4 <= length; i += 4) {                                  \
+        partial[0] += (DOT) a[i] * b[i];                                    \
+        partial[1] += (DOT) a[i + 1] * b[i + 1];                            \
+        partial[2] += (DOT) a[i + 2] * b[i + 2];                            \
+        partial[3] += (DOT) a[i + 3] * b[i + 3];                            \
+    }                                                                       \
+    for (; i < length; i++) partial[0] += (DOT) a[i] * b[i];                \
+                                                                            \
+    return (partial[0] + partial[1]) + (partial[2] + partial[3]);           \
+}                                                                           \
+                                                                            \
+static objptr_t sum_##TAG(const TYPE *data, unsigned int length)            \
+{                                                                           \
+    TOTAL total = 0;                                                        \
+    unsigned int i, count;                                                  \
+                                                                            \
+    for (i = 0; i < length; i += count) {                                   \
+        count = (length - i < CHUNK_LENGTH) ? length - i : CHUNK_LENGTH;    \
+        total += sum_chunk_##TAG(data + i, count);                          \
+    }                                                                       \
+    return TO_OBJECT_##KIND(total);                                         \
+}                                                                           \
+                                                                            \
+static objptr_t dot_##TAG(const TYPE *a, const TYPE *b, unsigned int length) \
+{                                                                           \
+    TOTAL total = 0;                                                        \
+    unsigned int i, count;                                                  \
+                                                                            \
+    for (i = 0; i < length; i += count) {                                   \
+        count = (length - i < CHUNK_LENGTH) ? length - i : CHUNK_LENGTH;    \
+        total += dot_chunk_##TAG(a + i, b + i, count);                      \
+    }                                                                       \
+    return TO_OBJECT_##KIND(total);                                         \
+}                                                                           \
+                                                                            \
+static objptr_t extreme_##TAG(const TYPE *restrict data, unsigned int length, \
+                              bool maximum)                                 \
+{                                                                           \
+    TYPE result;                                                            \
+    unsigned int i;                                                         \
+                                                                            \
+    result = data[0];                                                       \
+    if (maximum) {                                                          \
+        for (i = 1; i < length; i++)                                        \
+            result = (data[i] > result) ? data[i] : result;                 \
+    } else {                                                                \
+        for (i = 1; i < length; i++)                                        \
+            result = (data[i] < result) ? data[i] : result;                 \
+    }                                                                       \
+    return TO_OBJECT_##KIND(result);                                        \
+}                                                                           \
+                                                                            \
+static void arithmetic_##TAG(enum typed_vector_operation operation,         \
+                             TYPE *restrict out, const TYPE *restrict a,    \
+                             const TYPE *restrict b, objptr_t scalar_ptr,   \
+                             unsigned int length)                           \
+{                                                                           \
+    TYPE scalar;                                                            \
+    unsigned int i;                                                         \
+                                                                            \
+    scalar = (b == NULL) ? FROM_OBJECT_##KIND(TYPE, scalar_ptr) : 0;        \
+                                                                            \
+    switch (operation) {                                                    \
+    case TYPED_VECTOR_ADD:      ELEMENTWISE_LOOP(TYPE, WRAP, +); break;     \
+    case TYPED_VECTOR_SUBTRACT: ELEMENTWISE_LOOP(TYPE, WRAP, -); break;     \
+    case TYPED_VECTOR_MULTIPLY: ELEMENTWISE_LOOP(TYPE, WRAP, *); break;     \
+    case TYPED_VECTOR_DIVIDE:                                               \
+        if (IS_REAL_##KIND) {                                               \
+            ELEMENTWISE_LOOP(TYPE, WRAP, /);                                \
+        }                                                                   \
+        break;                                                              \
+    }                                                                       \
+}
+
+ELEMENT_TYPES(X)
+#undef X
+
+
+
+/*
+ * Makes a vector of LENGTH elements, which are FILL if the vector
+ * accepts it and zero otherwise. Returns () if there is no memory.
+ */
+objptr_t make_typed_vector(enum typed_vector_type type, unsigned int length, objptr_t fill)
+{
+    objptr_t ptr;
+    struct typed_vector *vector;
+    unsigned int filled, count;
+    size_t size;
+
+    ptr = object_allocate(&TYPE_TYPED_VECTOR);
+    if (ptr == EMPTY_LIST) return ptr;
+
+    size = ELEMENT_INFO[type].size;
+    vector = (struct typed_vector*) dereference(ptr);
+    vector->type = type;
+    vector->data = calloc((length > 0) ? length : 1, size);
+    if (vector->data == NULL) {
+        // Frees the fresh vector
+        increase_refcount(ptr);
+        decrease_refcount(ptr);
+        return EMPTY_LIST;
+    }
+    vector->length = length;
+
+    if (fill != EMPTY_LIST && length > 0) {
+        // Store the first element, then double the filled part
+        typed_vector_set(ptr, 0, fill);
+        for (filled = 1; filled < length; filled += count) {
+            count = (filled < length - filled) ? filled : length - filled;
+            memcpy((char*) vector->data + filled * size, vector->data, count * size);
+        }
+    }
+
+    return ptr;
+}
+
+
+static struct typed_vector *typed_vector_view(objptr_t ptr)
+{
+    if (is_of_type(ptr, &TYPE_TYPED_VECTOR)) {
+        return (struct typed_vector*) dereference(ptr);
+    } else {
+        return NULL;
+    }
+}
+
+
+bool is_typed_vector(objptr_t ptr, enum typed_vector_type type)
+{
+    struct typed_vector *vector;
+
+    vector = typed_vector_view(ptr);
+    return vector != NULL && vector->type == type;
+}
+
+
+const char *typed_vector_tag(enum typed_vector_type type)
+{
+    return ELEMENT_INFO[type].tag;
+}
+
+
+size_t typed_vector_element_size(enum typed_vector_type type)
+{
+    return ELEMENT_INFO[type].size;
+}
+
+
+unsigned int typed_vector_length(objptr_t ptr)
+{
+    struct typed_vector *vector;
+
+    vector = typed_vector_view(ptr);
+    return (vector != NULL) ? vector->length : 0;
+}
+
+
+objptr_t typed_vector_ref(objptr_t ptr, unsigned int index)
+{
+    struct typed_vector *vector;
+
+    vector = typed_vector_view(ptr);
+    if (vector == NULL || index >= vector->length) {
+        return EMPTY_LIST;  // TODO: Error?
+    }
+
+    switch (vector->type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND) \
+    case TYPED_VECTOR_##NAME: return TO_OBJECT_##KIND(((TYPE*) vector->data)[index]);
+        ELEMENT_TYPES(X)
+#undef X
+    default: return EMPTY_LIST;
+    }
+}
+
+
+/*
+ * Whether the object can be stored in a vector of the type: exact
+ * integers in the range of the integer types, and real numbers for
+ * f32 and f64.
+ */
+bool typed_vector_accepts(enum typed_vector_type type, objptr_t value)
+{
+    switch (type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND) \
+    case TYPED_VECTOR_##NAME: return ACCEPTS_##KIND(TYPE, value);
+        ELEMENT_TYPES(X)
+#undef X
+    default: return false;
+    }
+}
+
+
+/*
+ * Stores the value, and returns false if the index is out of range or
+ * the vector doesn't accept the value.
+ */
+bool typed_vector_set(objptr_t ptr, unsigned int index, objptr_t value)
+{
+    struct typed_vector *vector;
+
+    vector = typed_vector_view(ptr);
+    if (vector == NULL || index >= vector->length
+        || !typed_vector_accepts(vector->type, value)) {
+        return false;
+    }
+
+    switch (vector->type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND)                     \
+    case TYPED_VECTOR_##NAME:                                               \
+        ((TYPE*) vector->data)[index] = FROM_OBJECT_##KIND(TYPE, value);    \
+        break;
+        ELEMENT_TYPES(X)
+#undef X
+    default: break;
+    }
+    return true;
+}
+
+
+objptr_t typed_vector_sum(objptr_t ptr)
+{
+    struct typed_vector *vector;
+
+    vector = typed_vector_view(ptr);
+    if (vector == NULL) return EMPTY_LIST;  // TODO: Error?
+
+    switch (vector->type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND) \
+    case TYPED_VECTOR_##NAME: return sum_##TAG(vector->data, vector->length);
+        ELEMENT_TYPES(X)
+#undef X
+    default: return EMPTY_LIST;
+    }
+}
+
+
+objptr_t typed_vector_dot(objptr_t p1, objptr_t p2)
+{
+    struct typed_vector *v1, *v2;
+
+    v1 = typed_vector_view(p1);
+    v2 = typed_vector_view(p2);
+    if (v1 == NULL || v2 == NULL || v1->type != v2->type || v1->length != v2->length) {
+        return EMPTY_LIST;  // TODO: Error?
+    }
+
+    switch (v1->type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND) \
+    case TYPED_VECTOR_##NAME: return dot_##TAG(v1->data, v2->data, v1->length);
+        ELEMENT_TYPES(X)
+#undef X
+    default: return EMPTY_LIST;
+    }
+}
+
+
+static objptr_t typed_vector_extreme(objptr_t ptr, bool maximum)
+{
+    struct typed_vector *vector;
+
+    vector = typed_vector_view(ptr);
+    if (vector == NULL || vector->length == 0) return EMPTY_LIST;  // TODO: Error?
+
+    switch (vector->type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND) \
+    case TYPED_VECTOR_##NAME: return extreme_##TAG(vector->data, vector->length, maximum);
+        ELEMENT_TYPES(X)
+#undef X
+    default: return EMPTY_LIST;
+    }
+}
+
+
+objptr_t typed_vector_min(objptr_t ptr)
+{
+    return typed_vector_extreme(ptr, false);
+}
+
+
+objptr_t typed_vector_max(objptr_t ptr)
+{
+    return typed_vector_extreme(ptr, true);
+}
+
+
+/*
+ * Returns a new vector with the elementwise results of the
+ * operation. The second operand is either a vector of the same type
+ * and length, or a number used for every element.
+ */
+objptr_t typed_vector_arithmetic(enum typed_vector_operation operation,
+                                 objptr_t p1, objptr_t p2)
+{
+    objptr_t result;
+    struct typed_vector *v1, *v2, *out;
+
+    v1 = typed_vector_view(p1);
+    v2 = typed_vector_view(p2);
+    if (v1 == NULL ||
+        (v2 == NULL && !typed_vector_accepts(v1->type, p2)) ||
+        (v2 != NULL && (v2->type != v1->type || v2->length != v1->length)) ||
+        (operation == TYPED_VECTOR_DIVIDE && !ELEMENT_INFO[v1->type].is_real)) {
+        return EMPTY_LIST;  // TODO: Error?
+    }
+
+    result = make_typed_vector(v1->type, v1->length, EMPTY_LIST);
+    if (result == EMPTY_LIST) return result;
+    out = (struct typed_vector*) dereference(result);
+
+    switch (v1->type) {
+#define X(NAME, TAG, TYPE, WRAP, SUM, DOT, TOTAL, KIND)                     \
+    case TYPED_VECTOR_##NAME:                                               \
+        arithmetic_##TAG(operation, out->data, v1->data,                    \
+                         (v2 != NULL) ? v2->data : NULL, p2, v1->length);   \
+        break;
+        ELEMENT_TYPES(X)
+#undef X
+    default: break;
+    }
+
+    return result;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#ifndef TYPED_VECTOR_H_
+#define TYPED_VECTOR_H_
+
+#include <stddef.h>
+
+#include "object.h"
+
+
+/*
+ * Homogeneous numeric vectors (SRFI 4)
+ *
+ * The elements are stored as raw machine values, so the collector
+ * sees no slots. Reading an element makes a number object. Only
+ * numbers the element type can represent are stored: exact integers
+ * in its range for the integer types, and reals, which are rounded,
+ * for f32 and f64. Arithmetic on integer elements wraps around.
+ */
+
+enum typed_vector_type {
+    TYPED_VECTOR_U8,
+    TYPED_VECTOR_S8,
+    TYPED_VECTOR_U16,
+    TYPED_VECTOR_S16,
+    TYPED_VECTOR_U32,
+    TYPED_VECTOR_S32,
+    TYPED_VECTOR_U64,
+    TYPED_VECTOR_S64,
+    TYPED_VECTOR_F32,
+    TYPED_VECTOR_F64,
+    TYPED_VECTOR_TYPE_COUNT
+};
+
+
+enum typed_vector_operation {
+    TYPED_VECTOR_ADD,
+    TYPED_VECTOR_SUBTRACT,
+    TYPED_VECTOR_MULTIPLY,
+    TYPED_VECTOR_DIVIDE  // Only for f32 and f64
+};
+
+
+struct typed_vector {
+    struct object head;
+    enum typed_vector_type type;
+    unsigned int length;
+    void *data;
+};
+
+
+extern struct object_type TYPE_TYPED_VECTOR;
+
+
+objptr_t make_typed_vector(enum typed_vector_type, unsigned int, objptr_t);
+bool is_typed_vector(objptr_t, enum typed_vector_type);
+const char *typed_vector_tag(enum typed_vector_type);
+size_t typed_vector_element_size(enum typed_vector_type);
+
+unsigned int typed_vector_length(objptr_t);
+objptr_t typed_vector_ref(objptr_t, unsigned int);
+bool typed_vector_accepts(enum typed_vector_type, objptr_t);
+bool typed_vector_set(objptr_t, unsigned int, objptr_t);
+
+objptr_t typed_vector_sum(objptr_t);
+objptr_t typed_vector_dot(objptr_t, objptr_t);
+objptr_t typed_vector_min(objptr_t);
+objptr_t typed_vector_max(objptr_t);
+objptr_t typed_vector_arithmetic(enum typed_vector_operation, objptr_t, objptr_t);
+
+
+#endif
@@ -1,6 +1,7 @@
+#include <limits.h>
+#include <stdint.h>
 #include <stdlib.h>
-
-#include "character.h"
+#include <string.h>
 
 #include "vector.h"
 
@@ -8,7 +9,6 @@
 
 void init_vector(struct vector *vector)
 {
-    vector->is_string = false;
     vector->member_count = 0;
     vector->member_alloc = 0;
     vector->data = NULL;
@@ -60,8 +60,7 @@ bool vector_eqv(struct vector *v1,
     case EQ_STRICT:
 	return (v1 == v2) || (v1->member_count == 0 && v2->member_count == 0);
     case EQUAL_STRICT:
-	if ((v1->member_count != v2->member_count)
-	    || (v1->is_string != v2->is_string)) {
+	if (v1->member_count != v2->member_count) {
 	    return false;
 	}
 
@@ -89,78 +88,130 @@ DEFTYPE(TYPE_VECTOR,
 
 
 
-objptr_t make_vector(objptr_t fill, unsigned int size)
+/*
+ * Makes room for COUNT members and returns whether there was memory
+ * for them. The allocation at least doubles, so that appending stays
+ * amortized constant time.
+ */
+static bool vector_grow(struct vector *vector, size_t count)
 {
-    objptr_t vector;
-    unsigned int i;
+    objptr_t *data;
+    size_t i, alloc;
 
-    vector = object_allocate(&TYPE_VECTOR);
-    if (vector == EMPTY_LIST) return vector;
+    if (count <= vector->member_alloc) return true;
+    if (count > UINT_MAX || count > SIZE_MAX / sizeof(objptr_t)) return false;
+
+    if (vector->member_alloc == 0) {
+	// Initial size is 8
+	alloc = 8;
+    } else {
+	// Multiply size by 2
+	alloc = (size_t) vector->member_alloc * 2;
+    }
 
-    for (i = 0; i < size; i++)
+    if (alloc < count) {
+	alloc = count + 16;
+    }
+    if (alloc > UINT_MAX || alloc > SIZE_MAX / sizeof(objptr_t)) {
+	alloc = count;
+    }
+
+    data = realloc(vector->data, alloc * sizeof(objptr_t));
+    if (data == NULL) return false;
+
+    for (i = vector->member_alloc; i < alloc; i++)
     {
-	vector_set(vector, i, fill);
+	data[i] = EMPTY_LIST;
     }
 
-    return vector;
+    vector->data = data;
+    vector->member_alloc = (unsigned int) alloc;
+    return true;
 }
 
 
-objptr_t make_string(objptr_t fill, unsigned int size)
+/*
+ * Adds a reference to each of COUNT members, for members which are
+ * stored in a second place.
+ */
+static void reference_members(objptr_t *members, unsigned int count)
 {
-    objptr_t vector;
-
-    vector = make_vector(EMPTY_LIST, 0);
-    if (vector == EMPTY_LIST) return vector;
+    unsigned int i;
 
-    ((struct vector*) dereference(vector))->is_string = true;
-    return vector;
+    for (i = 0; i < count; i++)
+    {
+	increase_refcount(members[i]);
+    }
 }
 
 
-objptr_t make_string_from_c_string(const char *str)
+static void release_members(objptr_t *members, unsigned int count)
 {
-    objptr_t string;
     unsigned int i;
 
-    string = make_string(EMPTY_LIST, 0);
-    if (string == EMPTY_LIST) return string;
-
-    for (i = 0; str[i] != '\0'; i++)
+    for (i = 0; i < count; i++)
     {
-	vector_append(string, get_character((unichar_t) str[i]));
+	decrease_refcount(members[i]);
     }
-    
-    return string;
+}
+
+
+static struct vector *vector_view(objptr_t ptr)
+{
+    if (is_of_type(ptr, &TYPE_VECTOR)) {
+	return (struct vector*) dereference(ptr);
+    } else {
+	return NULL;
+    }
+}
+
+
+
+objptr_t make_vector(objptr_t fill, unsigned int size)
+{
+    objptr_t vector;
+
+    vector = object_allocate(&TYPE_VECTOR);
+    if (vector == EMPTY_LIST) return vector;
+
+    if (!vector_reserve(vector, size)) {
+	// Frees the fresh vector
+	increase_refcount(vector);
+	decrease_refcount(vector);
+	return EMPTY_LIST;
+    }
+    vector_fill(vector, fill, 0, size);
+
+    return vector;
 }
 
 
 objptr_t vector_copy(objptr_t ptr)
+{
+    return subvector(ptr, 0, vector_length(ptr));
+}
+
+
+/*
+ * Returns a new vector with the members from START up to END.
+ */
+objptr_t subvector(objptr_t ptr, unsigned int start, unsigned int end)
 {
     objptr_t copy;
     struct vector *original;
-    unsigned int i;
-
-    if (is_of_type(ptr, &TYPE_VECTOR)) {
-	original = (struct vector*) dereference(ptr);
-	
-	if (original->is_string) {
-	    copy = make_string(EMPTY_LIST, 0);
-	} else {
-	    copy = make_vector(EMPTY_LIST, 0);
-	}
 
-	if (copy == EMPTY_LIST) return copy;
+    original = vector_view(ptr);
+    if (original == NULL) return EMPTY_LIST;
 
-	for (i = 0; i < original->member_count; i++)
-	{
-	    vector_append(copy, original->data[i]);
-	}
+    copy = make_vector(EMPTY_LIST, 0);
+    if (copy == EMPTY_LIST) return copy;
 
-	return copy;
-    } else {
-	return EMPTY_LIST;
+    if (end > original->member_count) end = original->member_count;
+    if (start < end) {
+	vector_insert_range(copy, 0, ptr, start, end);
     }
+
+    return copy;
 }
 
 
@@ -183,51 +234,17 @@ objptr_t vector_get(objptr_t ptr, unsigned int index)
 
 void vector_set(objptr_t ptr, unsigned int index, objptr_t value)
 {
-    unsigned int i;
-    unsigned int growth;
     struct vector *vector;
 
     if (is_of_type(ptr, &TYPE_VECTOR)) {
 	vector = (struct vector*) dereference(ptr);
-	
-	if (index >= vector->member_alloc) {
-	    /*
-	     * Vector doesn't contain enough free slots, we have
-	     * to (re)allocate.
-	     */
-	    if (vector->member_alloc == 0) {
-		// Initial size is 8
-		growth = 8;
-	    } else {
-		// Multiply size by 2
-		growth = vector->member_alloc;
-	    }
 
-	    if ((vector->member_alloc + growth) < index) {
-		growth = (index - vector->member_alloc) + 16;
-	    }
-	    
-	    vector->data = realloc(vector->data,
-				   (vector->member_alloc + growth) * sizeof(objptr_t));
-
-	    // FIXME: Handle out of memory!
-
-	    for (i = 0; i < growth; i++)
-	    {
-		if (vector->is_string) {
-		    vector->data[vector->member_alloc + i] = get_character('\0');
-		} else {
-		    vector->data[vector->member_alloc + i] = EMPTY_LIST;
-		}
-	    }
-	    
-	    vector->member_alloc += growth;
-	}
+	if (!vector_grow(vector, (size_t) index + 1)) return;
 
 	decrease_refcount(vector->data[index]);
 	vector->data[index] = value;
 	increase_refcount(value);
-	
+
 	if (index >= vector->member_count) {
 	    vector->member_count = index + 1;
 	}
@@ -254,51 +271,209 @@ void vector_append(objptr_t ptr, objptr_t value)
 }
 
 
-void vector_insert(objptr_t ptr, unsigned int index, objptr_t value)
+/*
+ * Makes room for COUNT members without changing the length. Returns
+ * false only if there was no memory for them.
+ */
+bool vector_reserve(objptr_t ptr, unsigned int count)
+{
+    struct vector *vector;
+
+    vector = vector_view(ptr);
+    return vector == NULL || vector_grow(vector, count);
+}
+
+
+/*
+ * Stores VALUE from START up to END, extending the vector if END
+ * is past its end.
+ */
+void vector_fill(objptr_t ptr, objptr_t value, unsigned int start, unsigned int end)
 {
+    struct vector *vector;
     unsigned int i;
-    unsigned int length;
 
-    /*
-     * TODO: This is inefficient as hell!
-     */
+    vector = vector_view(ptr);
+    if (vector == NULL || start >= end) return;
 
-    length = vector_length(ptr);
-    
-    for (i = length - 1; i >= index; i--)
+    if (!vector_grow(vector, end)) return;
+
+    for (i = start; i < end; i++)
     {
-	vector_set(ptr, i + 1, vector_get(ptr, i));
+	increase_refcount(value);
+	decrease_refcount(vector->data[i]);
+	vector->data[i] = value;
     }
-    
-    vector_set(ptr, index, value);
+
+    if (end > vector->member_count) vector->member_count = end;
 }
 
 
-void vector_remove(objptr_t ptr, unsigned int index)
+/*
+ * Copies the members of SOURCE from START up to END to TARGET,
+ * starting at AT. Both may be the same vector; the ranges may
+ * overlap. TARGET is extended if needed.
+ */
+void vector_copy_range(objptr_t target_ptr, unsigned int at,
+		       objptr_t source_ptr, unsigned int start, unsigned int end)
 {
-    unsigned int i;
-    struct vector *vector;
-    
-    if (is_of_type(ptr, &TYPE_VECTOR)) {
-	vector = (struct vector*) dereference(ptr);
-	
-	if (index >= vector->member_count
-	    || vector->data == NULL) {
+    struct vector *target, *source;
+    unsigned int count, overwritten;
+
+    target = vector_view(target_ptr);
+    source = vector_view(source_ptr);
+    if (target == NULL || source == NULL) return;
+
+    if (end > source->member_count) end = source->member_count;
+    if (start >= end) return;
+    count = end - start;
+
+    if (!vector_grow(target, (size_t) at + count)) return;
+    if (at > target->member_count) {
+	// The gap stays filled with ()
+	target->member_count = at;
+    }
+
+    /*
+     * The members moved within one vector keep their references, only
+     * the ones which get a second place or lose their place change.
+     * Adding the new references first keeps members alive which are
+     * both copied and overwritten.
+     */
+    reference_members(source->data + start, count);
+    overwritten = (at + count < target->member_count) ? count : target->member_count - at;
+    release_members(target->data + at, overwritten);
+
+    memmove(target->data + at, source->data + start, count * sizeof(objptr_t));
+
+    if (at + count > target->member_count) target->member_count = at + count;
+}
+
+
+/*
+ * Inserts the members of SOURCE from START up to END before INDEX.
+ */
+void vector_insert_range(objptr_t ptr, unsigned int index,
+			 objptr_t source_ptr, unsigned int start, unsigned int end)
+{
+    struct vector *vector, *source;
+    unsigned int count;
+
+    vector = vector_view(ptr);
+    source = vector_view(source_ptr);
+    if (vector == NULL || source == NULL) return;
+
+    if (end > source->member_count) end = source->member_count;
+    if (start >= end) return;
+    count = end - start;
+
+    if (index >= vector->member_count) {
+	vector_copy_range(ptr, index, source_ptr, start, end);
+	return;
+    }
+
+    if (!vector_grow(vector, (size_t) vector->member_count + count)) return;
+
+    // Members behind INDEX move, without changing their references
+    memmove(vector->data + index + count, vector->data + index,
+	    (vector->member_count - index) * sizeof(objptr_t));
+    vector->member_count += count;
+
+    if (vector == source) {
+	// The inserted range may have moved itself
+	if (start >= index) {
+	    start += count;
+	} else if (end > index) {
+	    memmove(vector->data + index, vector->data + start,
+		    (index - start) * sizeof(objptr_t));
+	    memmove(vector->data + index + (index - start), vector->data + index + count,
+		    (end - index) * sizeof(objptr_t));
+	    reference_members(vector->data + index, count);
 	    return;
 	}
+    }
 
-	decrease_refcount(vector->data[index]);
-	for (i = index; i < vector->member_count - 1; i++)
+    memmove(vector->data + index, source->data + start, count * sizeof(objptr_t));
+    reference_members(vector->data + index, count);
+}
+
+
+void vector_insert(objptr_t ptr, unsigned int index, objptr_t value)
+{
+    struct vector *vector;
+
+    vector = vector_view(ptr);
+    if (vector == NULL) return;
+
+    if (index >= vector->member_count) {
+	vector_set(ptr, index, value);
+	return;
+    }
+
+    if (!vector_grow(vector, (size_t) vector->member_count + 1)) return;
+    memmove(vector->data + index + 1, vector->data + index,
+	    (vector->member_count - index) * sizeof(objptr_t));
+    vector->data[index] = value;
+    increase_refcount(value);
+    vector->member_count++;
+}
+
+
+/*
+ * Removes the members from START up to END.
+ */
+#define REMOVED_BUFFER_SIZE 16
+
+void vector_remove_range(objptr_t ptr, unsigned int start, unsigned int end)
+{
+    objptr_t buffer[REMOVED_BUFFER_SIZE];
+    objptr_t *removed;
+    struct vector *vector;
+    unsigned int i, count;
+
+    vector = vector_view(ptr);
+    if (vector == NULL || vector->data == NULL) return;
+
+    if (end > vector->member_count) end = vector->member_count;
+    if (start >= end) return;
+    count = end - start;
+
+    /*
+     * Close the gap before releasing the members, which may free
+     * objects that look at this vector. Without memory to hold
+     * them, the range is removed a buffer at a time from its end.
+     */
+    removed = (count <= REMOVED_BUFFER_SIZE) ? buffer : malloc(count * sizeof(objptr_t));
+    if (removed == NULL) {
+	for (; end > start; end -= count)
 	{
-	    vector->data[i] = vector->data[i + 1];
+	    count = (end - start < REMOVED_BUFFER_SIZE) ? end - start : REMOVED_BUFFER_SIZE;
+	    vector_remove_range(ptr, end - count, end);
 	}
-	vector->data[vector->member_count - 1] = EMPTY_LIST;
-	vector->member_count--;
-	
-	/*
-	 * TODO: Release memory if allocated block is to big?
-	 */
+	return;
+    }
+    memcpy(removed, vector->data + start, count * sizeof(objptr_t));
+
+    memmove(vector->data + start, vector->data + end,
+	    (vector->member_count - end) * sizeof(objptr_t));
+    vector->member_count -= count;
+    for (i = vector->member_count; i < vector->member_count + count; i++)
+    {
+	vector->data[i] = EMPTY_LIST;
     }
+
+    /*
+     * TODO: Release memory if allocated block is to big?
+     */
+
+    release_members(removed, count);
+    if (removed != buffer) free(removed);
+}
+
+
+void vector_remove(objptr_t ptr, unsigned int index)
+{
+    vector_remove_range(ptr, index, index + 1);
 }
 
 
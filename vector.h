@@ -8,7 +8,6 @@
 
 struct vector {
     struct object head;
-    bool is_string;
     unsigned int member_count;
     unsigned int member_alloc;
     objptr_t *data;
@@ -19,9 +18,8 @@ extern struct object_type TYPE_VECTOR;
 
 
 objptr_t make_vector(objptr_t, unsigned int);
-objptr_t make_string(objptr_t, unsigned int);
-objptr_t make_string_from_c_string(const char*);
 objptr_t vector_copy(objptr_t);
+objptr_t subvector(objptr_t, unsigned int, unsigned int);
 
 objptr_t vector_get(objptr_t, unsigned int);
 void vector_set(objptr_t, unsigned int, objptr_t);
@@ -30,6 +28,12 @@ void vector_append(objptr_t, objptr_t);
 void vector_insert(objptr_t, unsigned int, objptr_t);
 void vector_remove(objptr_t, unsigned int);
 
+bool vector_reserve(objptr_t, unsigned int);
+void vector_fill(objptr_t, objptr_t, unsigned int, unsigned int);
+void vector_copy_range(objptr_t, unsigned int, objptr_t, unsigned int, unsigned int);
+void vector_insert_range(objptr_t, unsigned int, objptr_t, unsigned int, unsigned int);
+void vector_remove_range(objptr_t, unsigned int, unsigned int);
+
 
 void init_vectors();
 void terminate_vectors();